@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Generates unicode_tables.h from python's own unicode database.
+
+Usage: python3 gen_unicode_tables.py > unicode_tables.h
+"""
+
+import unicodedata
+
+MAX_CODE_POINT = 0x10FFFF
+HANGUL_FIRST, HANGUL_LAST = 0xAC00, 0xD7A3
+
+
+def ranges(code_points):
+  """Collapses sorted code points into inclusive [first, last] ranges."""
+  result = []
+  for c in code_points:
+    if result and result[-1][1] == c - 1:
+      result[-1][1] = c
+    else:
+      result.append([c, c])
+  return result
+
+
+def emit(name, type_, rows, per_line):
+  print(f'constexpr {type_} {name}[] = {{')
+  for i in range(0, len(rows), per_line):
+    print('    ' + ' '.join(rows[i:i + per_line]))
+  print('};')
+  print()
+
+
+def main():
+  all_code_points = range(MAX_CODE_POINT + 1)
+  xid_start = [c for c in all_code_points if chr(c).isidentifier()]
+  xid_continue = [c for c in all_code_points
+                  if ('a' + chr(c)).isidentifier()]
+
+  # Compatibility decompositions of identifier characters. Hangul syllables
+  # are decomposed algorithmically instead.
+  decompositions = []
+  decomposition_data = []
+  for c in xid_continue:
+    if HANGUL_FIRST <= c <= HANGUL_LAST:
+      continue
+    decomposed = unicodedata.normalize('NFKD', chr(c))
+    if decomposed != chr(c):
+      decompositions.append((c, len(decomposition_data), len(decomposed)))
+      decomposition_data.extend(ord(d) for d in decomposed)
+
+  combining_classes = []
+  for c in all_code_points:
+    ccc = unicodedata.combining(chr(c))
+    if not ccc:
+      continue
+    if (combining_classes and combining_classes[-1][1] == c - 1 and
+        combining_classes[-1][2] == ccc):
+      combining_classes[-1][1] = c
+    else:
+      combining_classes.append([c, c, ccc])
+
+  # Primary composites, i.e. canonical pair decompositions that are not
+  # excluded from composition.
+  compositions = []
+  for c in all_code_points:
+    decomposition = unicodedata.decomposition(chr(c))
+    if not decomposition or decomposition.startswith('<'):
+      continue
+    parts = [int(p, 16) for p in decomposition.split()]
+    if len(parts) == 2 and unicodedata.normalize('NFC', chr(c)) == chr(c):
+      compositions.append((parts[0], parts[1], c))
+  compositions.sort()
+
+  print('// Generated by gen_unicode_tables.py from Unicode '
+        f'{unicodedata.unidata_version}. Do not edit.')
+  print()
+  print('#pragma once')
+  print()
+  print('#include <cstdint>')
+  print()
+  print('namespace unicode_tables {')
+  print('struct Range {')
+  print('  uint32_t first, last;')
+  print('};')
+  print()
+  print('struct CombiningClassRange {')
+  print('  uint32_t first, last;')
+  print('  uint8_t combining_class;')
+  print('};')
+  print()
+  print('struct Decomposition {')
+  print('  uint32_t code_point;')
+  print('  uint16_t offset;')
+  print('  uint8_t length;')
+  print('};')
+  print()
+  print('struct Composition {')
+  print('  uint32_t first, second, composite;')
+  print('};')
+  print()
+  emit('kXidStart', 'Range',
+       [f'{{0x{a:X}, 0x{b:X}}},' for a, b in ranges(xid_start)], 3)
+  emit('kXidContinue', 'Range',
+       [f'{{0x{a:X}, 0x{b:X}}},' for a, b in ranges(xid_continue)], 3)
+  emit('kCombiningClasses', 'CombiningClassRange',
+       [f'{{0x{a:X}, 0x{b:X}, {c}}},' for a, b, c in combining_classes], 3)
+  emit('kDecompositions', 'Decomposition',
+       [f'{{0x{c:X}, {o}, {n}}},' for c, o, n in decompositions], 3)
+  emit('kDecompositionData', 'uint32_t',
+       [f'0x{c:X},' for c in decomposition_data], 8)
+  emit('kCompositions', 'Composition',
+       [f'{{0x{a:X}, 0x{b:X}, 0x{c:X}}},' for a, b, c in compositions], 2)
+  print('}  // namespace unicode_tables')
+
+
+if __name__ == '__main__':
+  main()
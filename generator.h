@@ -0,0 +1,111 @@
+#pragma once
+
+// Coroutines are only available from C++20 (e.g. --cxxopt=-std=c++20), so
+// everything here is compiled out of C++17 builds.
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include "stream.h"
+
+// A coroutine that lazily generates a sequence of values, each of which is
+// produced by `co_yield`. The coroutine runs on the caller's thread, and only
+// until it yields the next value whenever Next() is called.
+//
+// Example usage:
+//
+//    Generator<int> Count(int end) {
+//      for (int i = 0; i < end; ++i) co_yield i;
+//    }
+//
+//    Generator<int> count = Count(5);
+//    while (count.Next()) std::cout << count.value();
+//
+template <typename T>
+class Generator {
+ public:
+  struct promise_type {
+    Generator get_return_object() {
+      return Generator(Handle::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+
+    // The yielded value lives in the coroutine until it is resumed.
+    std::suspend_always yield_value(std::remove_reference_t<T>& value) {
+      value_ = &value;
+      return {};
+    }
+    std::suspend_always yield_value(std::remove_reference_t<T>&& value) {
+      value_ = &value;
+      return {};
+    }
+
+    void return_void() {}
+    void unhandled_exception() { error_ = std::current_exception(); }
+
+    std::remove_reference_t<T>* value_ = nullptr;
+    std::exception_ptr error_;
+  };
+
+  Generator(Generator&& other) : handle_(std::exchange(other.handle_, {})) {}
+  Generator& operator=(Generator other) {
+    std::swap(handle_, other.handle_);
+    return *this;
+  }
+  ~Generator() {
+    if (handle_) handle_.destroy();
+  }
+
+  // Run the coroutine until it yields the next value, returning whether it
+  // did, or false once it returned. Exceptions thrown by the coroutine are
+  // rethrown, after which it is done.
+  bool Next() {
+    if (!handle_ || handle_.done()) return false;
+    handle_.resume();
+    if (handle_.promise().error_) {
+      std::rethrow_exception(std::exchange(handle_.promise().error_, nullptr));
+    }
+    return !handle_.done();
+  }
+
+  // The value last yielded, which may be moved from. Only valid after Next()
+  // returned true, and until it is next called.
+  std::remove_reference_t<T>& value() { return *handle_.promise().value_; }
+
+ private:
+  using Handle = std::coroutine_handle<promise_type>;
+
+  explicit Generator(Handle handle) : handle_(handle) {}
+
+  Handle handle_;
+};
+
+// Fills a stream with the values of a generator, driving the generator on
+// the stream's behalf (see Stream's Producer).
+//
+// Example usage:
+//
+//    Stream<int, GeneratorProducer<int>> stream(GeneratorProducer(Count(5)));
+//    StreamReader<int, GeneratorProducer<int>> reader = stream.MakeReader();
+//
+template <typename T>
+class GeneratorProducer {
+ public:
+  explicit GeneratorProducer(Generator<T> generator)
+      : generator_(std::move(generator)) {}
+
+  bool operator()(StreamSink<T>* sink) {
+    if (!generator_.Next()) return false;
+    sink->push_back(std::move(generator_.value()));
+    return true;
+  }
+
+ private:
+  Generator<T> generator_;
+};
+
+#endif  // defined(__cpp_impl_coroutine)
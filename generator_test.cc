@@ -0,0 +1,63 @@
+#include "generator.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+// Generators require C++20, so this test is only built as C++20 (see BUILD),
+// rather than silently running no tests.
+#if !defined(__cpp_impl_coroutine)
+#error "generator_test must be compiled as C++20"
+#endif
+
+namespace {
+Generator<int> Count(int end) {
+  for (int i = 0; i < end; ++i) co_yield i;
+}
+
+Generator<int> CountThenThrow(int end) {
+  for (int i = 0; i < end; ++i) co_yield i;
+  throw std::runtime_error("Done counting");
+}
+}  // namespace
+
+TEST(Generator, Next) {
+  Generator<int> count = Count(3);
+  std::vector<int> values;
+  while (count.Next()) values.push_back(count.value());
+  EXPECT_EQ(values, std::vector<int>({0, 1, 2}));
+  EXPECT_FALSE(count.Next());
+
+  // Generators that are never run, or only run partially, are destroyed.
+  Generator<int> unused = Count(3);
+  Generator<int> partial = Count(3);
+  EXPECT_TRUE(partial.Next());
+}
+
+TEST(Generator, Exception) {
+  Generator<int> count = CountThenThrow(2);
+  EXPECT_TRUE(count.Next());
+  EXPECT_TRUE(count.Next());
+  EXPECT_THROW(count.Next(), std::runtime_error);
+  EXPECT_FALSE(count.Next());
+}
+
+TEST(Generator, Stream) {
+  // Synchronously, and asynchronously.
+  for (bool async : {false, true}) {
+    Stream<int, GeneratorProducer<int>> stream(GeneratorProducer(Count(50)),
+                                               /*min_buffer_size=*/4);
+    stream.SetAsync(async);
+    StreamReader<int, GeneratorProducer<int>> reader = stream.MakeReader();
+    std::vector<int> expected;
+    for (int i = 0; i < 50; ++i) expected.push_back(i);
+    EXPECT_EQ(reader.ReadAll(), expected);
+    EXPECT_TRUE(reader.Depleted());
+  }
+
+  Stream<int, GeneratorProducer<int>> stream(
+      GeneratorProducer(CountThenThrow(2)));
+  StreamReader<int, GeneratorProducer<int>> reader = stream.MakeReader();
+  EXPECT_THROW(reader.ReadAll(), std::runtime_error);
+}
@@ -1,18 +1,34 @@
 #include "interpreter.h"
 
 Interpreter::Interpreter()
-    : lexer_(new Lexer),
-      parser_(new Parser(lexer_->TokenStream(), Parser::Mode::INTERACTIVE)) {}
+    : symbols_(std::make_shared<SymbolTable>()),
+      lexer_(new Lexer),
+      parser_(new Parser(lexer_->TokenStream(), Parser::Mode::INTERACTIVE,
+                         symbols_)) {
+  lexer_->SetSymbolTable(symbols_);
+  lexer_->SetThrowOnError(false);
+}
 
 void Interpreter::Interpret(std::string source) {
+  TryInterpret(std::move(source)).ThrowIfError();
+}
+
+Status Interpreter::TryInterpret(std::string source) {
+  lexer_->SetSource(std::move(source));
   {
-    // Debug printing.
+    // Debug printing. Reads the same lexed tokens as the parser, which are
+    // buffered until the parser reads them too.
     // TODO(erik): Remove.
-    for (const auto& token : Lex(source)) std::cout << token;
+    TokenStreamReader tokens = lexer_->TokenStream();
+    while (std::optional<Token> token = tokens.Read()) std::cout << *token;
     std::cout << "\n";
   }
 
-  lexer_->SetSource(std::move(source));
-  parser_->Parse();
+  // Lexing errors end the token stream early, so they take precedence over
+  // any parsing errors that follow from that.
+  const Status status = parser_->TryParse();
+  if (!lexer_->status().ok()) return lexer_->status();
+  if (!status.ok()) return status;
   std::cout << parser_->syntax_tree();
+  return Status();
 }
\ No newline at end of file
@@ -5,14 +5,21 @@
 
 #include "lexer.h"
 #include "parser.h"
+#include "status.h"
+#include "symbol_table.h"
 
 class Interpreter {
  public:
   Interpreter();
 
+  // Interpret `source`. Throws on errors.
   void Interpret(std::string source);
 
+  // As above, but returns errors rather than throwing them.
+  Status TryInterpret(std::string source);
+
  private:
+  SymbolTable::Ptr symbols_;
   std::unique_ptr<Lexer> lexer_;
   std::unique_ptr<Parser> parser_;
 };
\ No newline at end of file
@@ -1,75 +1,493 @@
 #include "lexer.h"
 
 #include <algorithm>
-#include <regex>
-#include <stdexcept>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "scanner.h"
+#include "unicode.h"
 
 namespace {
 // Hard coded indentation width.
 static constexpr size_t kIndentationWidth = 4u;
 
-// Regex that captures python strings (combos of single, double, triple quitos,
-// with optional leading 'f', 'r', 'u', 'b'). e.g. 'text', "text", '''text''',
-// r'text\\n more text'.
-static const std::regex kStringLiteralRegex(
-    "^(r|u|R|U|b|B|f|F)?((?:'''[^']*'''|\"\"\"[^']*\"\"\"|'[^'\\\\]*(\\\\.[^'"
-    "\\\\]*)*'|\"[^\"\\\\]*(\\\\.[^\"\\\\]*)*\"))");
-
-// Regex that captures python integers. e.g. 42, -123, 0x1A, 0b1101.
-static const std::regex kIntLiteralRegex(
-    "^([-+]?\\b(0[xX][0-9A-Fa-f]+|0[bB][01]+|[1-9][0-9]*|0)\\b)");
-
-// Regex that captures python floats. e.g. 3.14159, -0.12345, 1e5, -2.5e-3.
-static const std::regex kFloatLiteralRegex(
-    "^([-+]?\\b\\d+\\.\\d*(?:[eE][-+]?\\d+)?\\b)");
-
-// Regex that captures valid python identifiers (class names, function names,
-// variable names). Names must start with a character in a-z, A-Z, or _. Valid
-// variable names then continue with a-z, A-Z, 0-9, or additional underscores.
-// The \b ensures standalone word names. e.g. 'abc123', 'Abc123', 'aBc123',
-// '_abc123', 'abc_123'.
-static const std::regex kIdentifierRegex("^(\\b[a-zA-Z_][a-zA-Z0-9_]*\\b)");
-
 // Return whether `source` starts with `token` beginning at `idx`.
 template <typename U, typename V>
 bool MatchToken(const U& source, size_t idx, const V& token) {
   return source.compare(idx, token.size(), token) == 0;
 }
 
-// Given a list of candidate tokens that were lexed from the source code, return
-// the best match. Matches are determined by length, e.g. if the source code
-// reads "class ", matches would include {"as", "class"}, in which case "class"
-// is chosen as the desired token.
-Token& BestMatch(std::vector<Token>& tokens) {
-  return *std::max_element(tokens.begin(), tokens.end(),
-                           [](const Token& lhs, const Token& rhs) {
-                             return lhs.Length() < rhs.Length();
-                           });
+// Whether `c` can continue an identifier or keyword. Any non-ASCII byte might
+// be part of an identifier character.
+bool IsWordChar(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_' ||
+         static_cast<unsigned char>(c) >= 0x80;
 }
+
+// Whether `c` is the first byte of a multi-byte UTF-8 code point, or one of
+// the bytes continuing it.
+bool IsLeadByte(char c) {
+  return (static_cast<unsigned char>(c) & 0xC0) == 0xC0;
+}
+bool IsContinuationByte(char c) {
+  return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+// Maximum length of a UTF-8 encoded code point.
+static constexpr size_t kMaxUtf8Length = 4u;
+
+// Whether `source` is the beginning of a UTF-8 encoded code point, cut short
+// before its last byte: a lead byte followed only by continuation bytes, fewer
+// than the lead byte calls for.
+bool IsTruncatedUtf8(std::string_view source) {
+  if (source.empty()) return false;
+  const unsigned char lead = static_cast<unsigned char>(source[0]);
+  size_t length = 0u;
+  if (lead >= 0xC2 && lead <= 0xDF) length = 2u;
+  if (lead >= 0xE0 && lead <= 0xEF) length = 3u;
+  if (lead >= 0xF0 && lead <= 0xF4) length = 4u;
+  if (source.size() >= length) return false;
+  return std::all_of(source.begin() + 1, source.end(), IsContinuationByte);
+}
+
+// Minimum amount of chunked source code to have available when lexing a token,
+// enough to decide multi-word keywords, e.g. `not in` followed by a word
+// boundary.
+static constexpr size_t kMinLookahead = 8u;
+
+// Keywords that span multiple words. Each is matched as its first keyword,
+// followed by the remainder of the multi-word keyword.
+struct MultiWordKeyword {
+  Token::Type first;
+  std::string_view rest;
+  Token::Type type;
+};
+constexpr MultiWordKeyword kMultiWordKeywords[] = {
+    {Token::Type::IS, " not", Token::Type::IS_NOT},
+    {Token::Type::NOT, " in", Token::Type::NOT_IN},
+};
 }  // namespace
 
 Lexer::Lexer()
-    : tokens_([&](std::vector<Token>* buffer) { return EatChar(buffer); }) {}
+    : tokens_(TokenProducer{this}) {}
 
 Lexer::Lexer(std::string source) : Lexer() { SetSource(std::move(source)); }
 
+Lexer::Lexer(SourceBuffer::Ptr source) : Lexer() {
+  SetSource(std::move(source));
+}
+
 void Lexer::SetSource(std::string source) {
+  SetSource(SourceBuffer::FromString(std::move(source)));
+}
+
+void Lexer::SetSource(SourceBuffer::Ptr source) {
+  Reset(std::move(source));
+  ValidateUtf8(source_.size());
+  ReportError();
+}
+
+void Lexer::SetSource(ChunkReader read_chunk, size_t chunk_size) {
+  SetSource(SourceBuffer::FromString(""));
+  read_chunk_ = std::move(read_chunk);
+  chunked_ = true;
+  chunk_size_ = std::max<size_t>(chunk_size, 1u);
+}
+
+void Lexer::SetSourceFile(const std::string& path) {
+  SetSource(SourceBuffer::FromFile(path));
+}
+
+void Lexer::Reset(SourceBuffer::Ptr source) {
+  // Stop streaming tokens before changing what they are lexed from.
+  tokens_.Clear();
   idx_ = 0u;
   indentation_ = 0;
-  source_ = std::move(source);
-  tokens_.Clear();
+  buffer_ = std::move(source);
+  source_ = buffer_->text();
+  read_chunk_ = nullptr;
+  chunked_ = false;
+  window_offset_ = 0u;
+  validated_ = 0u;
+  status_ = Status();
+  pending_.Reset(buffer_);
+}
+
+void Lexer::Fail(ErrorCode code, size_t position) {
+  if (status_.ok()) status_ = Status(code, position);
+}
+
+void Lexer::ReportError() const {
+  if (throw_on_error_) status_.ThrowIfError();
+}
+
+void Lexer::ValidateUtf8(size_t end) {
+  validated_ += ScanValidUtf8(source_.substr(validated_, end - validated_));
+  if (validated_ == end) return;
+
+  // A code point at the end of the window may be completed by the next chunk.
+  if (read_chunk_ && end == source_.size() &&
+      IsTruncatedUtf8(source_.substr(validated_))) {
+    return;
+  }
+  Fail(ErrorCode::INVALID_UTF8, window_offset_ + validated_);
+}
+
+TokenStreamReader Lexer::TokenStream() { return tokens_.MakeReader(); }
+
+void Lexer::LexInto(TokenBuffer* buffer) {
+  while (read_chunk_ && status_.ok()) ReadChunk();
+  buffer->Reset(buffer_);
+  while (EatChar(buffer)) {}
+  ReportError();
 }
 
-StreamReader<Token> Lexer::TokenStream() { return tokens_.MakeReader(); }
+void Lexer::LexInto(TokenBuffer* buffer, size_t num_threads) {
+  while (read_chunk_ && status_.ok()) ReadChunk();
+  buffer->Reset(buffer_);
+
+  // Split the remaining source code into ranges of roughly equal size, each
+  // beginning at the start of a line (after its indentation).
+  std::vector<size_t> splits = {idx_};
+  for (size_t i = 1; i < num_threads; ++i) {
+    const size_t target = idx_ + (source_.size() - idx_) * i / num_threads;
+    size_t split = std::max(target, splits.back());
+    split += FindNewline(source_.substr(split));
+    split += ScanNewlines(source_.substr(split));
+    size_t tabs;
+    split += ScanIndentation(source_.substr(split), &tabs);
+    if (split < source_.size() && split > splits.back()) {
+      splits.push_back(split);
+    }
+  }
+  splits.push_back(source_.size());
+
+  // Lex all but the first range speculatively on their own threads, with
+  // their own lexers, while this lexer lexes the first range.
+  struct Range {
+    std::unique_ptr<Lexer> lexer;
+    TokenBuffer tokens;
+    std::exception_ptr error;
+    std::thread thread;
+  };
+  std::vector<Range> ranges(splits.size() - 1);
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    Range& range = ranges[i];
+    range.lexer = std::make_unique<Lexer>();
+    range.lexer->Reset(buffer_);
+    range.lexer->idx_ = splits[i];
+    range.tokens.Reset(buffer_);
+
+    // The indentation level of the range's first line.
+    size_t tabs;
+    const size_t line_start = source_.rfind('\n', splits[i] - 1) + 1;
+    const size_t length = ScanIndentation(
+        source_.substr(line_start, splits[i] - line_start), &tabs);
+    range.lexer->indentation_ =
+        ((length - tabs) + tabs * kIndentationWidth) / kIndentationWidth;
+
+    range.thread = std::thread([&range, end = splits[i + 1]] {
+      try {
+        range.lexer->LexUntil(end, &range.tokens);
+      } catch (...) {
+        range.error = std::current_exception();
+      }
+    });
+  }
+  std::exception_ptr error;
+  try {
+    LexUntil(splits[1], buffer);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  for (size_t i = 1; i < ranges.size(); ++i) ranges[i].thread.join();
+  if (error) std::rethrow_exception(error);
+
+  // Stitch ranges together. A range lexed from exactly where the previous one
+  // left off started on a token boundary, and at the indentation level
+  // assumed, since the previous range ended by consuming that range's leading
+  // newlines and indentation. Otherwise, lex the range again from where the
+  // previous one actually left off. Errors in ranges are only reported once
+  // stitched, since a range lexed under the wrong assumptions may fail where
+  // lexing it again would not.
+  for (size_t i = 1; i < ranges.size() && status_.ok(); ++i) {
+    Range& range = ranges[i];
+    if (idx_ == splits[i]) {
+      buffer->Append(range.tokens);
+      idx_ = range.lexer->idx_;
+      indentation_ = range.lexer->indentation_;
+      if (range.error) std::rethrow_exception(range.error);
+      status_ = range.lexer->status_;
+    } else {
+      LexUntil(splits[i + 1], buffer);
+    }
+  }
+  ReportError();
+}
+
+TokenEdit Lexer::Relex(const SourceEdit& edit, TokenBuffer* tokens) {
+  if (edit.offset + edit.length > source_.size()) {
+    Fail(ErrorCode::EDIT_OUT_OF_RANGE, edit.offset);
+    ReportError();
+    return {};
+  }
+  std::string source;
+  source.reserve(source_.size() - edit.length + edit.text.size());
+  source.append(source_.substr(0, edit.offset));
+  source.append(edit.text);
+  source.append(source_.substr(edit.offset + edit.length));
+  const int old_indentation = indentation_;
+
+  // The rest of the source code was validated before, so only validate the
+  // edit, along with any code points around it that the edit might split.
+  size_t valid_begin = edit.offset;
+  while (valid_begin > 0 && edit.offset - valid_begin < kMaxUtf8Length - 1 &&
+         IsContinuationByte(source[valid_begin - 1])) {
+    --valid_begin;
+  }
+  if (valid_begin > 0 && IsLeadByte(source[valid_begin - 1])) --valid_begin;
+  size_t valid_end = edit.offset + edit.text.size();
+  while (valid_end < source.size() &&
+         valid_end - edit.offset - edit.text.size() < kMaxUtf8Length - 1 &&
+         IsContinuationByte(source[valid_end])) {
+    ++valid_end;
+  }
+  const std::string_view edited =
+      std::string_view(source).substr(valid_begin, valid_end - valid_begin);
+  if (const size_t valid = ScanValidUtf8(edited); valid < edited.size()) {
+    Fail(ErrorCode::INVALID_UTF8, valid_begin + valid);
+    ReportError();
+    return {};
+  }
+
+  // Restart from the last newline before the edit, and before any string
+  // literal scan that read up to the edit. Other scans never read past the end
+  // of their line, so tokens up to there only depend on source code before
+  // the edit, and the lexer was at that newline with the indentation level
+  // implied by the preceding INDENT and DEDENT tokens. String literal scans
+  // begin at STRING tokens, and at any quote between tokens, which the lexer
+  // skips once the scan fails.
+  const std::vector<uint32_t>& offsets = tokens->offsets();
+  const size_t first_edited = std::lower_bound(offsets.begin(), offsets.end(),
+                                               edit.offset) - offsets.begin();
+  const auto reaches_edit = [&](size_t position) {
+    return IsStringLiteralTruncated(
+        source_.substr(position, edit.offset - position));
+  };
+  size_t restart = edit.offset;
+  size_t gap_begin = 0u;
+  for (size_t i = 0; i <= first_edited; ++i) {
+    const size_t gap_end = (i < first_edited ? tokens->offset(i) : edit.offset);
+    const std::string_view gap =
+        source_.substr(gap_begin, gap_end - gap_begin);
+    size_t quote = gap.find_first_of("'\"");
+    while (quote != gap.npos && !reaches_edit(gap_begin + quote)) {
+      quote = gap.find_first_of("'\"", quote + 1);
+    }
+    if (quote != gap.npos) {
+      restart = gap_begin + quote;
+      break;
+    }
+    if (i == first_edited) break;
+    if (tokens->type(i) == Token::Type::STRING && reaches_edit(gap_end)) {
+      restart = gap_end;
+      break;
+    }
+    gap_begin = gap_end + tokens->length(i);
+  }
+  size_t begin = std::lower_bound(offsets.begin(), offsets.begin() +
+                                  first_edited, restart) - offsets.begin();
+  while (begin > 0 && tokens->type(begin - 1) != Token::Type::NEWLINE) --begin;
+  if (begin > 0) --begin;
+  int indentation = 0;
+  for (size_t i = 0; i < begin; ++i) {
+    if (tokens->type(i) == Token::Type::INDENT) ++indentation;
+    if (tokens->type(i) == Token::Type::DEDENT) --indentation;
+  }
+
+  Reset(SourceBuffer::FromString(std::move(source)));
+  validated_ = source_.size();
+  idx_ = (begin > 0 ? tokens->offset(begin) : 0u);
+  indentation_ = indentation;
+
+  // Lex until a token past the edit begins where a token began before the
+  // edit, at the same indentation level. Since the lexer has no look-behind,
+  // all tokens from there on are the same as before, only offset by the edit.
+  const size_t edit_end = edit.offset + edit.text.size();
+  const int64_t delta = static_cast<int64_t>(edit.text.size()) -
+                        static_cast<int64_t>(edit.length);
+  TokenBuffer relexed(buffer_);
+  size_t old_end = begin;
+  int old_end_indentation = indentation;
+  size_t new_end = 0u;
+  bool synchronized = false;
+  bool keep_going = KeepGoing();
+  while (keep_going && !synchronized) {
+    keep_going = EatChar(&relexed);
+    for (; new_end < relexed.size() && !synchronized; ++new_end) {
+      const Token::Type type = relexed.type(new_end);
+      if (type == Token::Type::INDENT) ++indentation;
+      if (type == Token::Type::DEDENT) --indentation;
+      if (IsIndentation(type) && type != Token::Type::NEWLINE) continue;
+      if (relexed.offset(new_end) < edit_end) continue;
+
+      const size_t offset = relexed.offset(new_end) - delta;
+      while (old_end < tokens->size() &&
+             (tokens->offset(old_end) < offset ||
+              (tokens->offset(old_end) == offset &&
+               tokens->type(old_end) != Token::Type::NEWLINE &&
+               IsIndentation(tokens->type(old_end))))) {
+        if (tokens->type(old_end) == Token::Type::INDENT) ++old_end_indentation;
+        if (tokens->type(old_end) == Token::Type::DEDENT) --old_end_indentation;
+        ++old_end;
+      }
+      synchronized = old_end < tokens->size() &&
+                     tokens->offset(old_end) == offset &&
+                     old_end_indentation == indentation;
+      if (synchronized) break;
+    }
+  }
+  if (!status_.ok()) {
+    ReportError();
+    return {};
+  }
+  if (!synchronized) {
+    new_end = relexed.size();
+    old_end = tokens->size();
+  }
 
-bool Lexer::EatChar(std::vector<Token>* buffer) {
+  // Trim tokens that were lexed again without changing.
+  size_t unchanged = 0u;
+  while (unchanged < new_end && begin + unchanged < old_end &&
+         relexed.type(unchanged) == tokens->type(begin + unchanged) &&
+         relexed.offset(unchanged) == tokens->offset(begin + unchanged) &&
+         relexed.length(unchanged) == tokens->length(begin + unchanged) &&
+         relexed.offset(unchanged) + relexed.length(unchanged) <=
+             edit.offset) {
+    ++unchanged;
+  }
+
+  // Splice the lexed tokens in place of the changed tokens.
+  TokenBuffer spliced(buffer_);
+  spliced.Reserve(begin + new_end + (tokens->size() - old_end));
+  spliced.Append(*tokens, 0u, begin);
+  spliced.Append(relexed, 0u, new_end);
+  for (size_t i = old_end; i < tokens->size(); ++i) {
+    spliced.Append(tokens->type(i), tokens->offset(i) + delta,
+                   tokens->length(i), tokens->flags(i), tokens->integer(i));
+  }
+  *tokens = std::move(spliced);
+
+  idx_ = source_.size();
+  if (synchronized) indentation_ = old_indentation;
+  return {begin + unchanged, old_end, begin + new_end};
+}
+
+void Lexer::LexUntil(size_t end, TokenBuffer* buffer) {
+  while (idx_ < end && EatChar(buffer)) {}
+}
+
+bool Lexer::NeedsMoreInput() const {
+  if (!read_chunk_ || !status_.ok()) return false;
+
+  // Skip blanks as EatChar() would, then check the next token.
+  std::string_view source = source_.substr(idx_);
+  if (Position() > 0) source.remove_prefix(ScanBlanks(source));
+  if (source.size() < kMinLookahead || IsTokenTruncated(source)) return true;
+
+  // Newlines, and any indentation following them, are consumed as one run.
+  size_t tabs;
+  const size_t newlines = ScanNewlines(source);
+  if (newlines == 0 && Position() > 0) return false;
+  return newlines + ScanIndentation(source.substr(newlines), &tabs) ==
+         source.size();
+}
+
+void Lexer::ReadChunk() {
+  // A code point truncated by the end of the window is validated along with
+  // the next chunk, so it can't have been lexed past already.
+  if (validated_ < idx_) {
+    Fail(ErrorCode::INVALID_UTF8, window_offset_ + validated_);
+    return;
+  }
+
+  // Grow reads along with the remainder, so that tokens spanning many chunks
+  // are read in linear time.
+  const std::string_view remainder = source_.substr(idx_);
+  const size_t size = std::max(chunk_size_, remainder.size());
+  std::string window(remainder.size() + size, '\0');
+  remainder.copy(window.data(), remainder.size());
+  const size_t bytes = read_chunk_(window.data() + remainder.size(), size);
+  window.resize(remainder.size() + bytes);
+  if (bytes == 0) read_chunk_ = nullptr;
+
+  window_offset_ += idx_;
+  validated_ -= idx_;
+  idx_ = 0u;
+  buffer_ = SourceBuffer::FromString(std::move(window));
+  source_ = buffer_->text();
+  pending_.Reset(buffer_);
+  ValidateUtf8(source_.size());
+}
+
+bool Lexer::EatChar(StreamSink<Token>* buffer) {
+  // Make sure the next token lies entirely within the window.
+  while (NeedsMoreInput()) ReadChunk();
+
+  // Lex into the packed token buffer, then materialize tokens directly into
+  // the stream. The window is replaced as chunked source code is read, so
+  // those tokens keep their window alive themselves.
+  pending_.Clear();
+  const bool keep_going = EatChar(&pending_);
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    buffer->push_back(PendingToken(i));
+  }
+  ReportError();
+  return status_.ok() && (keep_going || read_chunk_);
+}
+
+#if defined(__cpp_impl_coroutine)
+Generator<Token> Lexer::Tokens() {
+  bool keep_going = true;
+  while (keep_going) {
+    while (NeedsMoreInput()) ReadChunk();
+    pending_.Clear();
+    keep_going = EatChar(&pending_);
+    for (size_t i = 0; i < pending_.size(); ++i) co_yield PendingToken(i);
+    ReportError();
+    keep_going = status_.ok() && (keep_going || read_chunk_);
+  }
+}
+#endif
+
+Token Lexer::PendingToken(size_t i) const {
+  Token token = pending_[i];
+  token.offset = static_cast<uint32_t>(
+      std::min<size_t>(window_offset_ + token.offset, Token::kNoOffset));
+  if (chunked_ && token.value) token.source = buffer_;
+  if (symbols_ && token.type == Token::Type::IDENTIFIER) {
+    // Identifiers are compared in NFKC, which leaves ASCII unchanged.
+    const std::string_view name = *token.value;
+    token.symbol = IsAscii(name) ? symbols_->Intern(name)
+                                 : symbols_->Intern(NormalizeNfkc(name));
+  }
+  return token;
+}
+
+bool Lexer::EatChar(TokenBuffer* buffer) {
+  // Skip blanks between tokens in bulk. Blanks at the very beginning of the
+  // source are indentation, and are left to MatchIndentation().
+  if (Position() > 0) idx_ += ScanBlanks(source_.substr(idx_));
   if (!KeepGoing()) return false;
 
   // Try to find indentation related tokens.
-  if (MatchIndentation(buffer)) return KeepGoing();
-
-  // Try to find keyword tokens.
-  if (MatchKeyword(buffer)) return KeepGoing();
+  if (MatchIndentation(buffer) || !status_.ok()) return KeepGoing();
 
   // Try to find literal tokens.
   if (MatchLiteral(buffer)) return KeepGoing();
@@ -77,67 +495,66 @@ bool Lexer::EatChar(std::vector<Token>* buffer) {
   // Try to find operator or delimiter tokens.
   if (MatchOperatorOrDelimiter(buffer)) return KeepGoing();
 
-  // Try to find identifier tokens.
-  if (MatchIdentifier(buffer)) return KeepGoing();
+  // Try to find identifier or keyword tokens.
+  if (MatchIdentifierOrKeyword(buffer)) return KeepGoing();
+
+  // Digits always begin a number, so they are part of a malformed one, e.g.
+  // `1__000` or `0o8`.
+  if (std::isdigit(static_cast<unsigned char>(source_[idx_]))) {
+    Fail(ErrorCode::INVALID_NUMBER_LITERAL, Position());
+    return false;
+  }
 
   // Couldn't find anything to match this char. Ignore it and proceed.
-  // This skips non-indentation, non-newline whitespace implicitly.
   ++idx_;
   return KeepGoing();
 }
 
-bool Lexer::MatchIndentation(std::vector<Token>* buffer) {
+bool Lexer::MatchIndentation(TokenBuffer* buffer) {
   bool matched = false;
-  bool eat_indentation = (idx_ == 0);
+  bool eat_indentation = (Position() == 0);
 
   // Check for newlines. Repeated newlines are interpreted as a single newline.
-  while (idx_ < source_.size() && source_[idx_] == '\n') {
-    if (!matched) {
-      buffer->emplace_back(Token::Type::NEWLINE);
-      eat_indentation = true;
-      matched = true;
-    }
-    ++idx_;
+  if (const size_t newlines = ScanNewlines(source_.substr(idx_))) {
+    buffer->Append(Token::Type::NEWLINE, idx_, 1u);
+    idx_ += newlines;
+    eat_indentation = true;
+    matched = true;
   }
 
   // Consume indentation from the beginning of a line.
   if (eat_indentation) {
-    size_t whitespace = 0u;
-
-    while (idx_ < source_.size()) {
-      if (source_[idx_] == ' ') {
-        whitespace += 1;
-      } else if (source_[idx_] == '\t') {
-        whitespace += kIndentationWidth;
-      } else {
-        break;
-      }
-      ++idx_;
-    }
+    size_t tabs;
+    const size_t line_start = Position();
+    const size_t length = ScanIndentation(source_.substr(idx_), &tabs);
+    const size_t whitespace = (length - tabs) + tabs * kIndentationWidth;
+    idx_ += length;
 
     // Check for errors in indentation level.
     if (whitespace % kIndentationWidth != 0) {
       // TODO(erik): Improve error messages - add amount of whitespace.
-      throw std::runtime_error("Encountered unexpected indentation");
+      Fail(ErrorCode::UNEXPECTED_INDENTATION, line_start);
+      return matched;
     }
 
     const int new_indentation = whitespace / kIndentationWidth;
     if (new_indentation < 0) {
-      throw std::runtime_error("Encountered negative indentation");
+      Fail(ErrorCode::NEGATIVE_INDENTATION, line_start);
+      return matched;
     }
 
     const int delta_indentation = new_indentation - indentation_;
     indentation_ = new_indentation;
     if (delta_indentation > 1) {
-      throw std::runtime_error(
-          "Encountered unexpected delta indentation (>1 level)");
+      Fail(ErrorCode::UNEXPECTED_DELTA_INDENTATION, line_start);
+      return matched;
     }
 
     // Insert new indent or dedent tokens.
     const Token::Type type =
         (delta_indentation < 0 ? Token::Type::DEDENT : Token::Type::INDENT);
     for (int i = 0; i < std::abs(delta_indentation); ++i) {
-      buffer->emplace_back(type);
+      buffer->Append(type, idx_, 0u);
       matched = true;
     }
   }
@@ -145,115 +562,90 @@ bool Lexer::MatchIndentation(std::vector<Token>* buffer) {
   return matched;
 }
 
-bool Lexer::MatchKeyword(std::vector<Token>* buffer) {
-  bool matched = false;
-
-  // Find keyword tokens that match at the current source location.
-  std::vector<Token> matched_tokens;
-  size_t i = static_cast<size_t>(Token::kKeywordBegin);
-  for (; i <= static_cast<size_t>(Token::kKeywordEnd); ++i) {
-    const Token::Type type = static_cast<Token::Type>(i);
-    const std::string& token = kTokenTypeToString.at(type);
-    if (MatchToken(source_, idx_, token)) {
-      // The keyword token is only a match if it is not part of a larger word.
-      // For example, we don't want to match the keyword `in` when given the
-      // substring `in_place_transpose`, which should instead be an identifier.
-      if (idx_ + token.size() < source_.size()) {
-        const char next = source_[idx_ + token.size()];
-        if (std::isalnum(next) || next == '_') continue;
-      }
-      matched_tokens.emplace_back(type);
-    }
-  }
-
-  // If multiple tokens match, choose the best match.
-  if (!matched_tokens.empty()) {
-    Token& matched_token = BestMatch(matched_tokens);
-    buffer->emplace_back(matched_token);
-    idx_ += buffer->back().Length();
-    matched = true;
+bool Lexer::MatchOperatorOrDelimiter(TokenBuffer* buffer) {
+  Token::Type type;
+  const std::string_view source = source_.substr(idx_);
+  const size_t length = ScanOperatorOrDelimiter(source, &type);
+  if (length > 0) {
+    buffer->Append(type, idx_, length);
+    idx_ += length;
   }
 
-  return matched;
+  return length > 0;
 }
 
-bool Lexer::MatchOperatorOrDelimiter(std::vector<Token>* buffer) {
-  bool matched = false;
-
-  // Find operator tokens that match at the current source location.
-  std::vector<Token> matched_tokens;
-  size_t i = static_cast<size_t>(Token::kOperatorBegin);
-  for (; i <= static_cast<size_t>(Token::kOperatorEnd); ++i) {
-    const Token::Type type = static_cast<Token::Type>(i);
-    const std::string& token = kTokenTypeToString.at(type);
-    if (MatchToken(source_, idx_, token)) {
-      matched_tokens.emplace_back(type);
-    }
+bool Lexer::MatchLiteral(TokenBuffer* buffer) {
+  Token::Type type;
+  uint8_t flags;
+  const std::string_view source = source_.substr(idx_);
+  const size_t length = ScanLiteral(source, &type, &flags);
+  if (length == 0) return false;
+
+  // Integers are converted once, while lexing. Those too large for int64_t are
+  // only flagged, and converted by the parser.
+  int64_t integer = 0;
+  if (type == Token::Type::INTEGER &&
+      !TryConvertIntegerLiteral(source.substr(0, length), &integer)) {
+    flags |= TokenBuffer::kIntegerTooBig;
   }
+  buffer->Append(type, idx_, length, flags, integer);
+  idx_ += length;
+  return true;
+}
 
-  // Find delimiter tokens that match at the current source location.
-  i = static_cast<size_t>(Token::kDelimiterBegin);
-  for (; i <= static_cast<size_t>(Token::kDelimiterEnd); ++i) {
-    const Token::Type type = static_cast<Token::Type>(i);
-    const std::string& token = kTokenTypeToString.at(type);
-    if (MatchToken(source_, idx_, token)) {
-      matched_tokens.emplace_back(type);
-    }
+bool Lexer::MatchIdentifierOrKeyword(TokenBuffer* buffer) {
+  // Scan the full word once, then classify it as either a keyword or an
+  // identifier. Keywords are only matched as whole words, so e.g. the source
+  // `in_place_transpose` is an identifier rather than the keyword `in`.
+  const std::string_view source = source_.substr(idx_);
+  const size_t length = ScanIdentifier(source);
+  if (length == 0) return false;
+
+  Token::Type type;
+  if (!LookupKeyword(source.substr(0, length), &type)) {
+    buffer->Append(Token::Type::IDENTIFIER, idx_, length);
+    idx_ += length;
+    return true;
   }
 
-  // If multiple tokens match, choose the best match.
-  if (!matched_tokens.empty()) {
-    Token& matched_token = BestMatch(matched_tokens);
-    buffer->emplace_back(matched_token);
-    idx_ += buffer->back().Length();
-    matched = true;
+  // Extend the keyword to a multi-word keyword, e.g. `is` to `is not`.
+  size_t keyword_length = length;
+  for (const auto& [first, rest, multi_word_type] : kMultiWordKeywords) {
+    if (type != first || !MatchToken(source, length, rest)) continue;
+    const size_t end = length + rest.size();
+    if (end < source.size() && IsWordChar(source[end])) continue;
+    type = multi_word_type;
+    keyword_length = end;
+    break;
   }
 
-  return matched;
+  buffer->Append(type, idx_, keyword_length);
+  idx_ += keyword_length;
+  return true;
 }
 
-bool Lexer::MatchLiteral(std::vector<Token>* buffer) {
-  std::unordered_map<Token::Type, std::regex> regexes;
-  regexes[Token::Type::STRING] = kStringLiteralRegex;
-  regexes[Token::Type::INTEGER] = kIntLiteralRegex;
-  regexes[Token::Type::FLOAT] = kFloatLiteralRegex;
-
-  std::smatch match;
-  std::string::const_iterator begin = source_.begin() + idx_;
-  std::string::const_iterator end = source_.end();
-  for (const auto& [type, regex] : regexes) {
-    if (std::regex_search(begin, end, match, regex)) {
-      idx_ += match[0].length();
-
-      Token token;
-      token.type = type;
-      token.value = match[0].str();
-      buffer->emplace_back(std::move(token));
-      return true;
-    }
+namespace {
+// Read all tokens from `lexer`. Nothing else keeps the source code alive once
+// the lexer is gone, so tokens with values keep it alive themselves.
+std::vector<Token> ReadAllTokens(Lexer* lexer) {
+  std::vector<Token> tokens = lexer->TokenStream().ReadAll();
+  for (Token& token : tokens) {
+    if (token.value) token.source = lexer->source();
   }
-
-  // No match found.
-  return false;
+  return tokens;
 }
+}  // namespace
 
-bool Lexer::MatchIdentifier(std::vector<Token>* buffer) {
-  // Search for any valid identifier.
-  std::smatch match;
-  std::string::const_iterator begin = source_.begin() + idx_;
-  std::string::const_iterator end = source_.end();
-  if (std::regex_search(begin, end, match, kIdentifierRegex)) {
-    idx_ += match[0].length();
-
-    Token token;
-    token.type = Token::Type::IDENTIFIER;
-    token.value = match[0].str();
-    buffer->emplace_back(std::move(token));
-  }
-
-  return !match.empty();
+std::vector<Token> Lex(std::string source) {
+  Lexer lexer(std::move(source));
+  return ReadAllTokens(&lexer);
 }
 
-std::vector<Token> Lex(std::string source) {
-  return Lexer(std::move(source)).TokenStream().ReadAll();
-}
\ No newline at end of file
+StatusOr<std::vector<Token>> TryLex(std::string source) {
+  Lexer lexer;
+  lexer.SetThrowOnError(false);
+  lexer.SetSource(std::move(source));
+  std::vector<Token> tokens = ReadAllTokens(&lexer);
+  if (!lexer.status().ok()) return lexer.status();
+  return tokens;
+}
@@ -3,11 +3,47 @@
 #include <functional>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "generator.h"
+#include "source_buffer.h"
+#include "status.h"
 #include "stream.h"
+#include "symbol_table.h"
 #include "token.h"
+#include "token_buffer.h"
+
+// An edit to source code, replacing `length` bytes at `offset` with `text`.
+struct SourceEdit {
+  size_t offset = 0u;
+  size_t length = 0u;
+  std::string_view text;
+};
+
+// The tokens changed by an edit to source code: tokens [begin, old_end) of the
+// tokens lexed before the edit were replaced by tokens [begin, new_end) of the
+// tokens lexed after it. Tokens before `begin` are unchanged, and tokens after
+// the replaced ones are unchanged but for being offset by the edit.
+struct TokenEdit {
+  size_t begin = 0u;
+  size_t old_end = 0u;
+  size_t new_end = 0u;
+};
+
+class Lexer;
+
+// Fills a lexer's stream of tokens, by eating the next character of source
+// code. A concrete producer rather than a type-erased callback, so that token
+// stream readers call into the lexer directly.
+struct TokenProducer {
+  Lexer* lexer;
+  bool operator()(StreamSink<Token>* sink) const;
+};
+
+// Reader of a lexer's stream of tokens.
+using TokenStreamReader = StreamReader<Token, TokenProducer>;
 
 // Lexes a given set of source lines into tokens, following
 // https://docs.python.org/3/reference/lexical_analysis.html
@@ -15,9 +51,78 @@ class Lexer {
  public:
   Lexer();
   explicit Lexer(std::string source);
+  explicit Lexer(SourceBuffer::Ptr source);
 
-  // Set the current source code to lex.
+  // Set the current source code to lex. Lexed tokens hold views into the
+  // source, which the lexer keeps alive until the next call to SetSource().
   void SetSource(std::string source);
+  void SetSource(SourceBuffer::Ptr source);
+
+  // Set the current source code to the contents of the file at `path`, which
+  // is memory mapped rather than read into memory where possible. Throws if
+  // the file cannot be read.
+  void SetSourceFile(const std::string& path);
+
+  // Set the current source code to be read in chunks of `chunk_size` bytes
+  // from `read_chunk`, e.g. `ReadChunks(STDIN_FILENO)`. Tokens are streamed
+  // from a window of the source code, holding no more than the current chunk
+  // and any unlexed remainder of the previous one. Tokens straddling chunks
+  // are read in full before being lexed. Each lexed token keeps its own window
+  // alive (see Token::source), rather than relying on the lexer to do so.
+  // Example:
+  //
+  //     Lexer lexer;
+  //     lexer.SetSource(ReadChunks(STDIN_FILENO));
+  //     TokenStreamReader stream = lexer.TokenStream();
+  //
+  static constexpr size_t kDefaultChunkSize = 64u * 1024u;
+  void SetSource(ChunkReader read_chunk,
+                 size_t chunk_size = kDefaultChunkSize);
+
+  // Intern the values of identifier tokens in `symbols` as they are streamed,
+  // populating Token::symbol. Disabled when null, which is the default.
+  void SetSymbolTable(SymbolTable::Ptr symbols) {
+    symbols_ = std::move(symbols);
+  }
+
+  // Whether to throw errors (see Status::ThrowIfError()), which is the
+  // default. Otherwise, lexing stops at the first error, which is then
+  // available from status() until the source code is set again. The token
+  // stream simply ends early, so consumers should check status() once the
+  // stream is depleted. Errors never unwind through the lexer itself either
+  // way; when throwing, they are thrown only once lexing has stopped.
+  void SetThrowOnError(bool throw_on_error) {
+    throw_on_error_ = throw_on_error;
+  }
+
+  // Whether to lex on a thread of the lexer's own, which runs ahead of
+  // consumers of the token stream (e.g. a parser) by a bounded number of
+  // tokens, rather than lexing on demand. Disabled by default. Should be set
+  // before reading from the token stream. Errors thrown while lexing are
+  // rethrown to the consumer. While streaming, status() is only valid once the
+  // stream is depleted, and identifiers are interned on the lexer's thread, so
+  // nothing else may intern them in the same symbol table meanwhile.
+  // Example:
+  //
+  //     Lexer lexer;
+  //     lexer.SetAsync(true);
+  //     lexer.SetSourceFile("large.py");
+  //     Parser parser(lexer.TokenStream());
+  //     parser.Parse();  // Parses while lexing.
+  //
+  void SetAsync(bool async) { tokens_.SetAsync(async); }
+
+  // Statistics of the token stream, if collected (see StreamStats), e.g. to
+  // size its buffer for a given consumer.
+  StreamStats TokenStreamStats() const { return tokens_.stats(); }
+
+  // The first error encountered lexing the current source code, if any.
+  const Status& status() const { return status_; }
+
+  // The source code currently being lexed. Holding on to this handle keeps
+  // the values of lexed tokens valid, even after the lexer moves on. For
+  // chunked source code, this is the current window.
+  const SourceBuffer::Ptr& source() const { return buffer_; }
 
   // Create a stream reader to read tokens from.
   // Example:
@@ -25,30 +130,124 @@ class Lexer {
   //     std::string source_code = "a = 5 * 3 + 2";
   //     Lexer lexer(std::move(source_code));
   //
-  //     StreamReader<Token> stream = lexer.TokenStream();
+  //     TokenStreamReader stream = lexer.TokenStream();
   //     while (std::optional<Token> token = stream.Read()) {
   //       ...
   //     }
   //
-  StreamReader<Token> TokenStream();
+  TokenStreamReader TokenStream();
+
+#if defined(__cpp_impl_coroutine)
+  // Lex the rest of the current source code in a coroutine, which yields
+  // tokens as it lexes them, in the same way as the token stream. This
+  // bypasses the token stream, and runs on the caller's thread. The lexer
+  // must outlive the generator, and its source code must not be set
+  // meanwhile. Errors are thrown from Generator::Next(), if enabled. Only
+  // available when compiled as C++20.
+  // Example:
+  //
+  //     Lexer lexer("a = 5 * 3 + 2");
+  //     Generator<Token> tokens = lexer.Tokens();
+  //     while (tokens.Next()) {
+  //       const Token& token = tokens.value();
+  //       ...
+  //     }
+  //
+  Generator<Token> Tokens();
+#endif
+
+  // Lex all remaining source code in bulk, replacing the contents of the
+  // provided `buffer`. This bypasses the token stream entirely. Chunked source
+  // code is read in full first.
+  // Example:
+  //
+  //     Lexer lexer("a = 5 * 3 + 2");
+  //     TokenBuffer tokens;
+  //     lexer.LexInto(&tokens);
+  //
+  void LexInto(TokenBuffer* buffer);
+
+  // As above, but lexes on up to `num_threads` threads. The source code is
+  // split into ranges at line starts, which are lexed in parallel assuming
+  // that each begins on a token boundary, with the indentation level of its
+  // first line. Ranges are then stitched together in order, and any range
+  // whose assumption does not hold (e.g. beginning within a multi-line string)
+  // is lexed again from where the preceding range left off. The resulting
+  // tokens are identical to those of a single-threaded LexInto().
+  void LexInto(TokenBuffer* buffer, size_t num_threads);
+
+  // Apply `edit` to the current source code, and update `tokens`, which must
+  // hold all tokens of the current source code (e.g. from LexInto()), to match.
+  // Only the affected part of the source code is lexed again: lexing restarts
+  // at the newline preceding the edit (or preceding any unterminated string
+  // literal that reaches the edit), and stops as soon as lexing after the edit
+  // lines up with the tokens from before the edit. Returns the range of
+  // tokens that changed. Fails if lexing fails, leaving `tokens` unchanged.
+  // Example:
+  //
+  //     Lexer lexer("a = 5\nb = 6\n");
+  //     TokenBuffer tokens;
+  //     lexer.LexInto(&tokens);
+  //
+  //     // Edit `a = 5` to `a = 50`.
+  //     TokenEdit changed = lexer.Relex({5, 0, "0"}, &tokens);
+  //
+  TokenEdit Relex(const SourceEdit& edit, TokenBuffer* tokens);
 
  private:
-  // Whether we have any more source code available to lex.
-  bool KeepGoing() const { return idx_ < source_.size(); }
+  friend struct TokenProducer;
+
+  // Whether we have any more source code available to lex, without having
+  // encountered an error.
+  bool KeepGoing() const { return idx_ < source_.size() && status_.ok(); }
+
+  // Record an error at `position` within the whole source code, unless one
+  // was already encountered. Lexing stops after the first error.
+  void Fail(ErrorCode code, size_t position);
+
+  // Throw the recorded error, if any, when throwing errors.
+  void ReportError() const;
+
+  // Position within the whole source code, across chunks.
+  size_t Position() const { return window_offset_ + idx_; }
+
+  // Whether the next token (or run of newlines and indentation) might extend
+  // past the end of the current window of chunked source code.
+  bool NeedsMoreInput() const;
+
+  // Read the next chunk of source code, replacing the current window with the
+  // unlexed remainder of the window followed by the new chunk.
+  void ReadChunk();
+
+  // Reset the lexer to the beginning of `source`, without validating it.
+  void Reset(SourceBuffer::Ptr source);
+
+  // Validate `source_` as UTF-8 from `validated_` up to `end`, failing if it
+  // is not valid. A code point truncated by the end of the current window of
+  // chunked source code is validated once the next chunk is read.
+  void ValidateUtf8(size_t end);
 
   // Increment `idx_`, eating the next character available in the provided
   // `source_` code. Populates the provided `buffer` with any new tokens
   // encountered. Returns false when we have reached the end of `source_`.
-  bool EatChar(std::vector<Token>* buffer);
+  bool EatChar(StreamSink<Token>* buffer);
+  bool EatChar(TokenBuffer* buffer);
+
+  // The `i`th token of `pending_`, as it is streamed: located within the whole
+  // source code, holding on to its window if chunked, and interned.
+  Token PendingToken(size_t i) const;
+
+  // Lex into `buffer` until reaching `end` within `source_`. The last token
+  // lexed may extend past `end`.
+  void LexUntil(size_t end, TokenBuffer* buffer);
 
   // Attempt to match various language constituents from `source_` at the
   // current `idx_`. Populates the provided `buffer` with any new tokens
   // encountered. Returns whether a match was found.
-  bool MatchIndentation(std::vector<Token>* buffer);
-  bool MatchKeyword(std::vector<Token>* buffer);
-  bool MatchOperatorOrDelimiter(std::vector<Token>* buffer);
-  bool MatchLiteral(std::vector<Token>* buffer);
-  bool MatchIdentifier(std::vector<Token>* buffer);
+  bool MatchIndentation(TokenBuffer* buffer);
+  bool MatchOperatorOrDelimiter(TokenBuffer* buffer);
+  bool MatchLiteral(TokenBuffer* buffer);
+  bool MatchIdentifierOrKeyword(TokenBuffer* buffer);
 
   // Position within `source_`.
   size_t idx_ = 0u;
@@ -56,14 +255,49 @@ class Lexer {
   // Current indentation level, in number of tab widths.
   int indentation_ = 0;
 
-  // Raw source code.
-  std::string source_;
+  // Buffer holding the source code, and a view of the raw source code. For
+  // chunked source code, these hold the current window.
+  SourceBuffer::Ptr buffer_;
+  std::string_view source_;
+
+  // Reader for the rest of chunked source code, the size of each chunk, and
+  // the position of the current window within the whole source code. The
+  // reader is null for source code that is available in full, and once
+  // chunked source code is exhausted. Whether the source code is chunked
+  // outlives the reader, since tokens from the last window still need to keep
+  // it alive.
+  ChunkReader read_chunk_;
+  bool chunked_ = false;
+  size_t chunk_size_ = kDefaultChunkSize;
+  size_t window_offset_ = 0u;
+
+  // Length of the prefix of `source_` known to be valid UTF-8.
+  size_t validated_ = 0u;
+
+  // The first error encountered, and whether to throw errors.
+  Status status_;
+  bool throw_on_error_ = true;
+
+  // Symbol table to intern identifiers in, if any.
+  SymbolTable::Ptr symbols_;
+
+  // Tokens lexed by the current EatChar() call, before being added to the
+  // stream of tokens.
+  TokenBuffer pending_;
 
   // Stream of tokens. Each EatChar() call adds an arbitrary number of new
   // tokens to the stream. Consumers pull from this stream.
-  Stream<Token> tokens_;
+  Stream<Token, TokenProducer> tokens_;
 };
 
+inline bool TokenProducer::operator()(StreamSink<Token>* sink) const {
+  return lexer->EatChar(sink);
+}
+
 // Standalone helper function that lexes the input source code to tokens in one
-// call.
-std::vector<Token> Lex(std::string source);
\ No newline at end of file
+// call. The returned tokens keep `source` alive (see Token::source). Throws on
+// errors.
+std::vector<Token> Lex(std::string source);
+
+// As above, but returns errors rather than throwing them.
+StatusOr<std::vector<Token>> TryLex(std::string source);
\ No newline at end of file
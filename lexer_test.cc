@@ -1,5 +1,8 @@
 #include "lexer.h"
 
+#include <algorithm>
+#include <sstream>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "token.h"
@@ -75,6 +78,56 @@ my_list = [1, 2, 3]
                            }));
 }
 
+TEST(Lexer, NumberLiterals) {
+  // Numbers are converted while lexing, including octal integers and digits
+  // separated by underscores. Integers too large for int64_t are only flagged
+  // as such, and left unconverted.
+  const std::string source =
+      "x = 1_000 + 0o17 - 0x_FF * 1_000.5 + 00 + 0_0 + "
+      "123456789012345678901234567890";
+  const std::vector<Token> tokens = Lex(source);
+  using Number = std::variant<std::monostate, int64_t, double>;
+  std::vector<std::pair<std::string_view, Number>> numbers;
+  for (const Token& token : tokens) {
+    if (!IsLiteral(token.type)) continue;
+    numbers.emplace_back(*token.value, token.number);
+  }
+  EXPECT_EQ(numbers, (std::vector<std::pair<std::string_view, Number>>{
+                         {"1_000", int64_t{1000}},
+                         {"0o17", int64_t{15}},
+                         {"0x_FF", int64_t{255}},
+                         {"1_000.5", 1000.5},
+                         {"00", int64_t{0}},
+                         {"0_0", int64_t{0}},
+                         {"123456789012345678901234567890", std::monostate()},
+                     }));
+
+  Lexer lexer(source);
+  TokenBuffer buffer;
+  lexer.LexInto(&buffer);
+  EXPECT_EQ(buffer.integer(2), 1000);
+  EXPECT_EQ(buffer.flags(2), 0u);
+  EXPECT_EQ(buffer.text(buffer.size() - 1), "123456789012345678901234567890");
+  EXPECT_EQ(buffer.flags(buffer.size() - 1), TokenBuffer::kIntegerTooBig);
+
+  // Runs of zeros are integers, as in python, unlike other zero-padded numbers.
+  for (const char* source : {"x = 00", "x = 0_0", "x = 000_0"}) {
+    SCOPED_TRACE(source);
+    const StatusOr<std::vector<Token>> result = TryLex(source);
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ((*result)[2].number, Number(int64_t{0}));
+  }
+
+  // Malformed numbers are errors, rather than being lexed in pieces.
+  for (const char* source : {"x = 1__000", "x = 1_", "x = 0o8", "x = 0123",
+                             "x = 1_.5", "x = 0_1", "x = 00_"}) {
+    SCOPED_TRACE(source);
+    const StatusOr<std::vector<Token>> result = TryLex(source);
+    EXPECT_EQ(result.status().code(), ErrorCode::INVALID_NUMBER_LITERAL);
+    EXPECT_EQ(result.status().offset(), 4u);
+  }
+}
+
 TEST(Lexer, ControlFlow) {
   const char* source = R"(
 if x > 10:
@@ -300,4 +353,597 @@ result = double(10)
                                {Token::Type::RIGHT_PAREN},
                                {Token::Type::NEWLINE},
                            }));
-}
\ No newline at end of file
+}
+TEST(Lexer, Keywords) {
+  const char* source = R"(
+if a is not b and c not in d or not e: pass
+in_place = not_in is None
+)";
+
+  std::cout << "Source:\n" << source << "\n";
+  EXPECT_THAT(Lex(source), testing::ContainerEq(std::vector<Token>{
+                               {Token::Type::NEWLINE},
+                               {Token::Type::IF},
+                               {Token::Type::IDENTIFIER, "a"},
+                               {Token::Type::IS_NOT},
+                               {Token::Type::IDENTIFIER, "b"},
+                               {Token::Type::AND},
+                               {Token::Type::IDENTIFIER, "c"},
+                               {Token::Type::NOT_IN},
+                               {Token::Type::IDENTIFIER, "d"},
+                               {Token::Type::OR},
+                               {Token::Type::NOT},
+                               {Token::Type::IDENTIFIER, "e"},
+                               {Token::Type::COLON},
+                               {Token::Type::PASS},
+                               {Token::Type::NEWLINE},
+                               {Token::Type::IDENTIFIER, "in_place"},
+                               {Token::Type::ASSIGN},
+                               {Token::Type::IDENTIFIER, "not_in"},
+                               {Token::Type::IS},
+                               {Token::Type::NONE},
+                               {Token::Type::NEWLINE},
+                           }));
+}
+
+TEST(Lexer, TokensViewSourceBuffer) {
+  SourceBuffer::Ptr buffer = SourceBuffer::FromString("name = 'value'");
+  std::vector<Token> tokens = Lexer(buffer).TokenStream().ReadAll();
+
+  // Token values point directly into the source buffer, which stays alive
+  // through our handle after the lexer is gone.
+  const std::string_view text = buffer->text();
+  ASSERT_EQ(tokens.size(), 3u);
+  EXPECT_EQ(tokens[0].value->data(), text.data());
+  EXPECT_EQ(*tokens[0].value, "name");
+  EXPECT_EQ(tokens[2].value->data(), text.data() + 7);
+  EXPECT_EQ(*tokens[2].value, "'value'");
+}
+
+TEST(Lexer, LexIntoTokenBuffer) {
+  const char* source = R"(
+def add(a, b):
+    return a + 3.5
+)";
+
+  Lexer lexer(source);
+  TokenBuffer tokens;
+  lexer.LexInto(&tokens);
+
+  // Bulk lexing produces the same tokens as the token stream.
+  std::vector<Token> expected = Lex(source);
+  ASSERT_EQ(tokens.size(), expected.size());
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    EXPECT_EQ(tokens[i], expected[i]) << "token " << i;
+  }
+
+  // Tokens record where they were lexed from in the source.
+  EXPECT_EQ(tokens.type(1), Token::Type::DEF);
+  EXPECT_EQ(tokens.offset(1), 1u);
+  EXPECT_EQ(tokens.length(1), 3u);
+  EXPECT_EQ(tokens.text(2), "add");
+  EXPECT_EQ(tokens.text(tokens.size() - 3), "3.5");
+  EXPECT_EQ(tokens.source(), lexer.source());
+  EXPECT_EQ(tokens[1].offset, 1u);
+  EXPECT_EQ(expected[1].offset, 1u);
+  EXPECT_EQ(expected[expected.size() - 3].offset, 31u);
+}
+
+TEST(Lexer, ChunkedSource) {
+  const std::string source = R"(
+class Person:
+    def __init__(self, name):
+        self.name = name  # Not a comment.
+
+    def greet(self):
+        if self.name is not None and self.name not in names:
+            print("""Hello,
+my name is""", self.name, 3.14159 ** -2)
+)";
+  const std::vector<Token> expected = Lex(source);
+
+  // Tokens straddling chunks are lexed in full, regardless of where chunks
+  // split the source.
+  for (size_t chunk_size : {1u, 2u, 3u, 5u, 7u, 16u, 1024u}) {
+    SCOPED_TRACE("chunk_size = " + std::to_string(chunk_size));
+    std::istringstream stream(source);
+    Lexer lexer;
+    lexer.SetSource(ReadChunks(&stream), chunk_size);
+
+    // Tokens keep their windows alive after the lexer moves on, and are at
+    // their offsets within the whole source code.
+    const std::vector<Token> tokens = lexer.TokenStream().ReadAll();
+    EXPECT_EQ(tokens, expected);
+    for (size_t i = 0; i < tokens.size() && i < expected.size(); ++i) {
+      EXPECT_EQ(tokens[i].offset, expected[i].offset) << "token " << i;
+    }
+  }
+
+  std::istringstream stream(source);
+  Lexer lexer;
+  lexer.SetSource(ReadChunks(&stream), 4u);
+  TokenBuffer tokens;
+  lexer.LexInto(&tokens);
+  ASSERT_EQ(tokens.size(), expected.size());
+  for (size_t i = 0; i < tokens.size(); ++i) EXPECT_EQ(tokens[i], expected[i]);
+}
+
+TEST(Lexer, ChunkedTokensOutliveLexer) {
+  // Tokens from every window, including the last one, keep their window alive
+  // once the lexer is gone.
+  const std::string source = "first = 'a'\nsecond = 'b' + last\n";
+  std::vector<Token> tokens;
+  {
+    std::istringstream stream(source);
+    Lexer lexer;
+    lexer.SetSource(ReadChunks(&stream), 8u);
+    tokens = lexer.TokenStream().ReadAll();
+  }
+  EXPECT_EQ(tokens, Lex(source));
+  for (const Token& token : tokens) {
+    if (!token.value) continue;
+    EXPECT_NE(token.source, nullptr) << token;
+  }
+  EXPECT_EQ(*tokens[tokens.size() - 2].value, "last");
+}
+
+TEST(Lexer, ChunkedInvalidUtf8) {
+  // Invalid UTF-8 at the end of a window is not mistaken for a code point
+  // truncated by the window, whatever the chunk size.
+  for (const std::string& source : {
+           std::string("'\n1\"=\x82'="),
+           std::string("x = 'caf\xC3\xA9'\ny = z\xFF\n"),
+           std::string("x = 'caf\xC3'\n"),
+           std::string("x = 1 # \xE2\x82\n"),
+       }) {
+    SCOPED_TRACE(testing::PrintToString(source));
+    const StatusOr<std::vector<Token>> expected = TryLex(source);
+    ASSERT_EQ(expected.status().code(), ErrorCode::INVALID_UTF8);
+    for (size_t chunk_size : {1u, 2u, 3u, 4u, 1024u}) {
+      SCOPED_TRACE("chunk_size = " + std::to_string(chunk_size));
+      std::istringstream stream(source);
+      Lexer lexer;
+      lexer.SetThrowOnError(false);
+      lexer.SetSource(ReadChunks(&stream), chunk_size);
+      lexer.TokenStream().ReadAll();
+      EXPECT_EQ(lexer.status().code(), ErrorCode::INVALID_UTF8);
+      EXPECT_EQ(lexer.status().offset(), expected.status().offset());
+    }
+  }
+
+  // Code points split across chunks are still valid.
+  const std::string source = "x = '\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80'\n";
+  for (size_t chunk_size : {1u, 2u, 3u}) {
+    std::istringstream stream(source);
+    Lexer lexer;
+    lexer.SetSource(ReadChunks(&stream), chunk_size);
+    EXPECT_EQ(lexer.TokenStream().ReadAll(), Lex(source));
+  }
+}
+
+TEST(Lexer, DeepDedent) {
+  // Dedenting many levels at once streams more tokens at once than the token
+  // stream has room for.
+  std::string source;
+  for (size_t i = 0; i < 50; ++i) source += std::string(4 * i, ' ') + "if x:\n";
+  source += std::string(4 * 50, ' ') + "y\nz\n";
+
+  Lexer lexer(source);
+  TokenBuffer buffer;
+  lexer.LexInto(&buffer);
+  const std::vector<Token> tokens = Lex(source);
+  ASSERT_EQ(tokens.size(), buffer.size());
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    EXPECT_EQ(tokens[i], buffer[i]) << "token " << i;
+  }
+  EXPECT_EQ(std::count(buffer.types().begin(), buffer.types().end(),
+                       Token::Type::DEDENT),
+            50);
+}
+
+TEST(Lexer, Async) {
+  std::string source;
+  for (size_t i = 0; i < 2000; ++i) {
+    source += "if x" + std::to_string(i) + " is not None:\n    y = 'z' + 1.5\n";
+  }
+  const std::vector<Token> expected = Lex(source);
+
+  // Tokens lexed on the lexer's own thread are the same, whether from source
+  // code available in full or in chunks.
+  Lexer lexer;
+  lexer.SetAsync(true);
+  lexer.SetSource(source);
+  EXPECT_EQ(lexer.TokenStream().ReadAll(), expected);
+  std::istringstream stream(source);
+  lexer.SetSource(ReadChunks(&stream), 64u);
+  EXPECT_EQ(lexer.TokenStream().ReadAll(), expected);
+
+  // Setting the source code again midway stops lexing the previous one.
+  lexer.SetSource(source);
+  EXPECT_TRUE(lexer.TokenStream().Read().has_value());
+  lexer.SetSource("a\n");
+  EXPECT_EQ(lexer.TokenStream().ReadAll().size(), 2u);
+
+  // Errors are thrown to the consumer, after the tokens preceding them. The
+  // reader is scoped, as readers that are left behind hold back the others.
+  lexer.SetSource(source + "a\n  b\n");
+  {
+    TokenStreamReader tokens = lexer.TokenStream();
+    for (size_t i = 0; i < expected.size() + 2; ++i) {
+      ASSERT_TRUE(tokens.Read().has_value());
+    }
+    EXPECT_THROW(tokens.Read(), std::runtime_error);
+  }
+
+  // Or end the token stream early, when not thrown.
+  lexer.SetThrowOnError(false);
+  lexer.SetSource(source + "a\n  b\n");
+  EXPECT_EQ(lexer.TokenStream().ReadAll().size(), expected.size() + 2);
+  EXPECT_EQ(lexer.status().code(), ErrorCode::UNEXPECTED_INDENTATION);
+}
+
+#if defined(__cpp_impl_coroutine)
+TEST(Lexer, Generator) {
+  std::string source;
+  for (size_t i = 0; i < 200; ++i) {
+    source += "if x" + std::to_string(i) + " is not None:\n    y = 'z' + 1.5\n";
+  }
+  const std::vector<Token> expected = Lex(source);
+
+  // Tokens yielded by the lexer's coroutine are the same as those streamed,
+  // whether from source code available in full or in chunks.
+  Lexer lexer(source);
+  std::vector<Token> tokens;
+  for (Generator<Token> generator = lexer.Tokens(); generator.Next();) {
+    tokens.push_back(generator.value());
+  }
+  EXPECT_EQ(tokens, expected);
+  std::istringstream stream(source);
+  lexer.SetSource(ReadChunks(&stream), 64u);
+  Stream<Token, GeneratorProducer<Token>> token_stream(
+      GeneratorProducer(lexer.Tokens()));
+  EXPECT_EQ(token_stream.MakeReader().ReadAll(), expected);
+
+  // Errors are thrown once the tokens preceding them are yielded.
+  lexer.SetSource("a\n  b\n");
+  Generator<Token> generator = lexer.Tokens();
+  EXPECT_TRUE(generator.Next());
+  EXPECT_TRUE(generator.Next());
+  EXPECT_THROW(generator.Next(), std::runtime_error);
+}
+#endif
+
+TEST(Lexer, ChunkedSourceUsesBoundedWindow) {
+  // Generate far more source code than fits in a single window. Chunks split
+  // lines, and tokens, at arbitrary positions.
+  const std::string line = "value = value + 1.5\n";
+  const size_t size = 100000u * line.size();
+  size_t position = 0u;
+  auto read_chunk = [&](char* data, size_t max_size) {
+    const size_t bytes = std::min(max_size, size - position);
+    for (size_t i = 0; i < bytes; ++i, ++position) {
+      data[i] = line[position % line.size()];
+    }
+    return bytes;
+  };
+
+  constexpr size_t kChunkSize = 256u;
+  Lexer lexer;
+  lexer.SetSource(read_chunk, kChunkSize);
+  TokenStreamReader stream = lexer.TokenStream();
+  size_t num_tokens = 0u;
+  size_t max_window = 0u;
+  while (std::optional<Token> token = stream.Read()) {
+    ++num_tokens;
+    max_window = std::max(max_window, lexer.source()->text().size());
+  }
+  EXPECT_EQ(num_tokens, 100000u * 6);
+  EXPECT_LE(max_window, 2 * kChunkSize);
+}
+
+TEST(Lexer, LexIntoInParallel) {
+  // Ranges split lines within multi-line strings, and at every indentation
+  // level.
+  std::string source;
+  for (int i = 0; i < 200; ++i) {
+    source += R"(
+class Person:
+    def __init__(self, name):
+        self.name = name
+        self.doc = """
+    def greet(self):
+        print('not a method')
+"""
+        self.raw = 'multi
+line'
+
+    def greet(self):
+        if self.name is not None:
+            print(f"Hello, my name is {self.name}")
+
+p = Person("Alice")
+)";
+  }
+
+  Lexer serial_lexer(source);
+  TokenBuffer serial;
+  serial_lexer.LexInto(&serial);
+
+  for (size_t num_threads : {1u, 2u, 3u, 4u, 7u, 16u, 64u}) {
+    SCOPED_TRACE("num_threads = " + std::to_string(num_threads));
+    Lexer lexer(source);
+    TokenBuffer parallel;
+    lexer.LexInto(&parallel, num_threads);
+    EXPECT_EQ(parallel.types(), serial.types());
+    EXPECT_EQ(parallel.offsets(), serial.offsets());
+    EXPECT_EQ(parallel.lengths(), serial.lengths());
+  }
+
+  // Errors are raised just as when lexing on a single thread.
+  Lexer lexer(source + "if a:\n      b\n");
+  TokenBuffer parallel;
+  EXPECT_THROW(lexer.LexInto(&parallel, 4u), std::runtime_error);
+}
+
+TEST(Lexer, Relex) {
+  std::string source;
+  for (int i = 0; i < 100; ++i) {
+    source += R"(
+class Person:
+    def __init__(self, name):
+        self.name = name
+        self.doc = """A person.
+        """
+
+    def greet(self):
+        if self.name is not None:
+            print(f"Hello, my name is {self.name}")
+
+p = Person("Alice")
+)";
+  }
+  const size_t middle = source.find("class", source.size() / 2);
+
+  struct Edit {
+    size_t offset;
+    size_t length;
+    std::string text;
+  };
+  const std::vector<Edit> edits = {
+      // Insertions, deletions and replacements within a token.
+      {source.find("Alice"), 0u, "Bob and "},
+      {source.find("greet"), 2u, ""},
+      {middle, 5u, "klass"},
+      {middle + 1, 2u, "LA"},
+      // Merging and splitting tokens.
+      {source.find("is not"), 3u, ""},
+      {source.find("is not") + 2, 1u, "_"},
+      {middle + 5, 1u, ""},
+      // Changing indentation.
+      {middle + source.substr(middle).find("            print"), 4u, ""},
+      {middle + source.substr(middle).find("        self.doc"), 0u, "    "},
+      // Opening a string, affecting everything after it.
+      {middle, 0u, "'''"},
+      // Edits at the very beginning and end.
+      {0u, 1u, "x = 1\n"},
+      {source.size(), 0u, "y = 2\n"},
+      {0u, source.size(), "z = 3"},
+  };
+
+  for (const Edit& edit : edits) {
+    SCOPED_TRACE("offset = " + std::to_string(edit.offset) + ", text = '" +
+                 edit.text + "'");
+    Lexer lexer(source);
+    TokenBuffer tokens;
+    lexer.LexInto(&tokens);
+    const TokenBuffer old_tokens = tokens;
+    const TokenEdit changed =
+        lexer.Relex({edit.offset, edit.length, edit.text}, &tokens);
+
+    // Tokens are those of the edited source code.
+    std::string edited = source;
+    edited.replace(edit.offset, edit.length, edit.text);
+    Lexer expected_lexer(edited);
+    TokenBuffer expected;
+    expected_lexer.LexInto(&expected);
+    EXPECT_EQ(lexer.source()->text(), edited);
+    EXPECT_EQ(tokens.types(), expected.types());
+    EXPECT_EQ(tokens.offsets(), expected.offsets());
+    EXPECT_EQ(tokens.lengths(), expected.lengths());
+
+    // Tokens outside of the changed range are unchanged.
+    ASSERT_LE(changed.begin, changed.old_end);
+    ASSERT_LE(changed.begin, changed.new_end);
+    EXPECT_EQ(old_tokens.size() - changed.old_end,
+              tokens.size() - changed.new_end);
+    for (size_t i = 0; i < changed.begin; ++i) {
+      EXPECT_EQ(tokens[i], old_tokens[i]);
+    }
+    for (size_t i = changed.new_end, j = changed.old_end; i < tokens.size();
+         ++i, ++j) {
+      EXPECT_EQ(tokens[i], old_tokens[j]);
+    }
+  }
+
+  // Local edits only change nearby tokens.
+  Lexer lexer(source);
+  TokenBuffer tokens;
+  lexer.LexInto(&tokens);
+  const TokenEdit changed = lexer.Relex({middle, 5u, "klass"}, &tokens);
+  EXPECT_EQ(changed.old_end - changed.begin, 1u);
+  EXPECT_EQ(changed.new_end - changed.begin, 1u);
+  EXPECT_EQ(tokens.text(changed.begin), "klass");
+
+  // Errors leave tokens unchanged.
+  const TokenBuffer old_tokens = tokens;
+  EXPECT_THROW(lexer.Relex({middle, 0u, "  "}, &tokens), std::runtime_error);
+  EXPECT_EQ(tokens.types(), old_tokens.types());
+}
+
+TEST(Lexer, RelexAfterOpenQuote) {
+  // Scanning an unterminated quote reads up to the end of the source code, so
+  // edits far after it can change how it is lexed.
+  struct Case {
+    std::string source;
+    size_t offset;
+    std::string text;
+  };
+  for (const Case& c : {
+           Case{"a = 'x\nb = 1\nc = 2\n", 17u, "'"},
+           Case{"x = \"\"\"\n    \n        '\n", 19u, "\""},
+           Case{"a = 1  # It's\nb = 2\nc = 3\n", 20u, "'"},
+       }) {
+    SCOPED_TRACE(c.source);
+    Lexer lexer(c.source);
+    TokenBuffer tokens;
+    lexer.LexInto(&tokens);
+    lexer.Relex({c.offset, 0u, c.text}, &tokens);
+
+    std::string edited = c.source;
+    edited.insert(c.offset, c.text);
+    Lexer expected_lexer(edited);
+    TokenBuffer expected;
+    expected_lexer.LexInto(&expected);
+    EXPECT_EQ(tokens.types(), expected.types());
+    EXPECT_EQ(tokens.offsets(), expected.offsets());
+    EXPECT_EQ(tokens.lengths(), expected.lengths());
+  }
+}
+
+TEST(Lexer, InternsIdentifiers) {
+  auto symbols = std::make_shared<SymbolTable>();
+  Lexer lexer("a = b + a\nb = a\n");
+  lexer.SetSymbolTable(symbols);
+
+  std::vector<SymbolId> ids;
+  for (const Token& token : lexer.TokenStream().ReadAll()) {
+    if (token.type != Token::Type::IDENTIFIER) {
+      EXPECT_EQ(token.symbol, SymbolTable::kNoSymbol);
+      continue;
+    }
+    ids.push_back(token.symbol);
+    EXPECT_EQ(symbols->Name(token.symbol), *token.value);
+  }
+  EXPECT_EQ(ids, (std::vector<SymbolId>{0, 1, 0, 1, 0}));
+  EXPECT_EQ(symbols->size(), 2u);
+}
+
+TEST(Lexer, UnicodeIdentifiers) {
+  const std::string source = "π = naïve + 変数 * x²\nif ok not in é:\n    π\n";
+  EXPECT_THAT(Lex(source), testing::ContainerEq(std::vector<Token>{
+                               {Token::Type::IDENTIFIER, "π"},
+                               {Token::Type::ASSIGN},
+                               {Token::Type::IDENTIFIER, "naïve"},
+                               {Token::Type::PLUS},
+                               {Token::Type::IDENTIFIER, "変数"},
+                               {Token::Type::MULTIPLY},
+                               {Token::Type::IDENTIFIER, "x"},
+                               {Token::Type::NEWLINE},
+                               {Token::Type::IF},
+                               {Token::Type::IDENTIFIER, "ok"},
+                               {Token::Type::NOT_IN},
+                               {Token::Type::IDENTIFIER, "é"},
+                               {Token::Type::COLON},
+                               {Token::Type::NEWLINE},
+                               {Token::Type::INDENT},
+                               {Token::Type::IDENTIFIER, "π"},
+                               {Token::Type::NEWLINE},
+                               {Token::Type::DEDENT},
+                           }));
+
+  // Code points straddling chunks are lexed in full.
+  const std::vector<Token> expected = Lex(source);
+  for (size_t chunk_size : {1u, 2u, 3u, 5u}) {
+    SCOPED_TRACE("chunk_size = " + std::to_string(chunk_size));
+    std::istringstream stream(source);
+    Lexer lexer;
+    lexer.SetSource(ReadChunks(&stream), chunk_size);
+    EXPECT_EQ(lexer.TokenStream().ReadAll(), expected);
+  }
+}
+
+TEST(Lexer, InternsNormalizedIdentifiers) {
+  // `ﬁle` and `file` are the same identifier in NFKC, as are the composed and
+  // decomposed forms of `é`.
+  auto symbols = std::make_shared<SymbolTable>();
+  Lexer lexer("ﬁle = file\né = é\n");
+  lexer.SetSymbolTable(symbols);
+
+  std::vector<SymbolId> ids;
+  for (const Token& token : lexer.TokenStream().ReadAll()) {
+    if (token.type == Token::Type::IDENTIFIER) ids.push_back(token.symbol);
+  }
+  EXPECT_EQ(ids, (std::vector<SymbolId>{0, 0, 1, 1}));
+  EXPECT_EQ(symbols->Name(0), "file");
+  EXPECT_EQ(symbols->Name(1), "é");
+}
+
+TEST(Lexer, InvalidUtf8) {
+  EXPECT_THROW(Lex("a = 'b\xFF'\n"), std::runtime_error);
+  EXPECT_THROW(Lex("a = b\xC3"), std::runtime_error);
+
+  // Invalid UTF-8 is found in chunked source code too, including at its end.
+  for (const std::string source : {"a = 'b\xFF' + c\n", "a = b\xC3"}) {
+    std::istringstream stream(source);
+    Lexer lexer;
+    lexer.SetSource(ReadChunks(&stream), 2u);
+    EXPECT_THROW(lexer.TokenStream().ReadAll(), std::runtime_error);
+  }
+
+  // Edits are validated, including where they split a code point.
+  TokenBuffer tokens;
+  Lexer lexer("a = 'é'\n");
+  lexer.LexInto(&tokens);
+  EXPECT_THROW(lexer.Relex({5u, 1u, ""}, &tokens), std::runtime_error);
+  EXPECT_THROW(lexer.Relex({0u, 0u, "\xFF"}, &tokens), std::runtime_error);
+  const TokenEdit edit = lexer.Relex({5u, 2u, "è"}, &tokens);
+  EXPECT_EQ(edit.begin, 2u);
+}
+
+TEST(Lexer, ErrorsWithoutThrowing) {
+  struct Case {
+    std::string source;
+    ErrorCode code;
+    uint32_t offset;
+  };
+  for (const Case& c : {
+           Case{"if x:\n        y\n", ErrorCode::UNEXPECTED_DELTA_INDENTATION,
+                6u},
+           Case{"a\n  b\n", ErrorCode::UNEXPECTED_INDENTATION, 2u},
+           Case{"a = 'b\xFF'\n", ErrorCode::INVALID_UTF8, 6u},
+       }) {
+    SCOPED_TRACE(c.source);
+    const StatusOr<std::vector<Token>> tokens = TryLex(c.source);
+    EXPECT_EQ(tokens.status().code(), c.code);
+    EXPECT_EQ(tokens.status().offset(), c.offset);
+    EXPECT_THROW(Lex(c.source), std::runtime_error);
+
+    Lexer lexer;
+    lexer.SetThrowOnError(false);
+    lexer.SetSource(c.source);
+    TokenBuffer buffer;
+    lexer.LexInto(&buffer);
+    EXPECT_EQ(lexer.status().code(), c.code);
+  }
+
+  const StatusOr<std::vector<Token>> tokens = TryLex("a = 5\n");
+  ASSERT_TRUE(tokens.ok());
+  EXPECT_EQ(tokens->size(), 4u);
+
+  // The token stream ends at the first error. Setting the source code again
+  // clears the error.
+  Lexer lexer;
+  lexer.SetThrowOnError(false);
+  lexer.SetSource("a = 5\n        b\n");
+  EXPECT_THAT(lexer.TokenStream().ReadAll(),
+              testing::ContainerEq(std::vector<Token>{
+                  {Token::Type::IDENTIFIER, "a"},
+                  {Token::Type::ASSIGN},
+                  {Token::Type::INTEGER, "5"},
+                  {Token::Type::NEWLINE},
+              }));
+  EXPECT_FALSE(lexer.status().ok());
+  lexer.SetSource("b\n");
+  EXPECT_TRUE(lexer.status().ok());
+  EXPECT_EQ(lexer.TokenStream().ReadAll().size(), 2u);
+}
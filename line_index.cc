@@ -0,0 +1,20 @@
+#include "line_index.h"
+
+#include <algorithm>
+
+#include "scanner.h"
+
+LineIndex::LineIndex() : line_starts_({0u}) {}
+
+LineIndex::LineIndex(std::string_view source) : LineIndex() {
+  line_starts_.reserve(source.size() / 32u + 1u);
+  FindLineStarts(source, &line_starts_);
+}
+
+SourceLocation LineIndex::Locate(uint32_t offset) const {
+  // The last line starting at or before `offset`.
+  const auto it =
+      std::upper_bound(line_starts_.begin(), line_starts_.end(), offset) - 1;
+  return {static_cast<uint32_t>(it - line_starts_.begin()) + 1u,
+          offset - *it + 1u};
+}
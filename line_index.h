@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// A line and column within source code, both counted from 1. Columns count
+// bytes rather than characters, as in python's own syntax tree.
+struct SourceLocation {
+  uint32_t line = 0u;
+  uint32_t column = 0u;
+
+  bool operator==(const SourceLocation& rhs) const {
+    return line == rhs.line && column == rhs.column;
+  }
+  bool operator!=(const SourceLocation& rhs) const { return !(*this == rhs); }
+};
+
+// Maps byte offsets within source code, such as those carried by tokens,
+// syntax tree nodes and errors, to lines and columns. The offset of the start
+// of each line is found once, newlines being scanned in bulk, so that tokens
+// and nodes need only carry a single offset, and locating one is a binary
+// search.
+//
+// Example:
+//
+//     LineIndex lines("a = 5\nb = a\n");
+//     lines.Locate(10);  // Returns {2, 5}, i.e. `a` on line 2.
+//
+class LineIndex {
+ public:
+  LineIndex();
+  explicit LineIndex(std::string_view source);
+
+  // The line and column of the byte at `offset`. Offsets past the end of the
+  // source are located on its last line.
+  SourceLocation Locate(uint32_t offset) const;
+
+  // Number of lines, counting the (possibly empty) line after a trailing
+  // newline.
+  size_t num_lines() const { return line_starts_.size(); }
+
+  // Byte offset of the start of `line`, counted from 1.
+  uint32_t line_start(size_t line) const { return line_starts_[line - 1]; }
+
+ private:
+  // Offset of the start of each line, in order.
+  std::vector<uint32_t> line_starts_;
+};
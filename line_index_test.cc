@@ -0,0 +1,48 @@
+#include "line_index.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "lexer.h"
+
+TEST(LineIndex, Locate) {
+  const LineIndex lines("a = 5\n\nif a:\n    b\n");
+  EXPECT_EQ(lines.num_lines(), 5u);
+  EXPECT_EQ(lines.line_start(1), 0u);
+  EXPECT_EQ(lines.line_start(3), 7u);
+  EXPECT_EQ(lines.Locate(0), (SourceLocation{1, 1}));
+  EXPECT_EQ(lines.Locate(5), (SourceLocation{1, 6}));
+  EXPECT_EQ(lines.Locate(6), (SourceLocation{2, 1}));
+  EXPECT_EQ(lines.Locate(10), (SourceLocation{3, 4}));
+  EXPECT_EQ(lines.Locate(17), (SourceLocation{4, 5}));
+  EXPECT_EQ(lines.Locate(19), (SourceLocation{5, 1}));
+  EXPECT_EQ(lines.Locate(100), (SourceLocation{5, 82}));
+
+  const LineIndex empty("");
+  EXPECT_EQ(empty.num_lines(), 1u);
+  EXPECT_EQ(empty.Locate(0), (SourceLocation{1, 1}));
+}
+
+TEST(LineIndex, LocateTokens) {
+  // Lines of varying length, straddling the blocks of the vectorized scan.
+  std::string source;
+  std::vector<SourceLocation> expected;
+  for (uint32_t i = 1; i <= 100; ++i) {
+    const std::string name = "x" + std::to_string(i);
+    source += name + " = " + std::string(i, '1') + "\n";
+    expected.push_back({i, 1u});
+    expected.push_back({i, static_cast<uint32_t>(name.size()) + 4u});
+  }
+
+  const LineIndex lines(source);
+  EXPECT_EQ(lines.num_lines(), 101u);
+  std::vector<SourceLocation> locations;
+  for (const Token& token : Lex(source)) {
+    if (token.type == Token::Type::IDENTIFIER ||
+        token.type == Token::Type::INTEGER) {
+      locations.push_back(lines.Locate(token.offset));
+    }
+  }
+  EXPECT_EQ(locations, expected);
+}
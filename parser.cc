@@ -1,8 +1,11 @@
 #include "parser.h"
 
 #include <optional>
+#include <variant>
 
+#include "scanner.h"
 #include "syntax_tree_node.h"
+#include "unicode.h"
 
 namespace {
 // Helper that pushes a provided value onto a provided deque.
@@ -30,277 +33,131 @@ std::decay_t<T> Pop(std::deque<T>* values) {
   values->pop_back();
   return value;
 }
+
+// The offset of `node`, or kNoOffset if there is no node.
+template <typename T>
+uint32_t OffsetOf(const std::unique_ptr<T>& node) {
+  return node ? node->offset : SyntaxTreeNode::kNoOffset;
+}
+
+// The value of an INTEGER or FLOAT token.
+ConstantValue NumberConstant(const Token& token) {
+  if (const auto* value = std::get_if<int64_t>(&token.number)) return *value;
+  if (const auto* value = std::get_if<double>(&token.number)) return *value;
+
+  // Numbers are converted while lexing, unless too large for int64_t, or the
+  // token was created some other way.
+  if (token.type == Token::Type::FLOAT) {
+    return ConvertFloatLiteral(token.value.value());
+  }
+  return std::visit([](auto value) -> ConstantValue { return value; },
+                    ConvertIntegerLiteral(token.value.value()));
+}
 }  // namespace
 
-Parser::Parser(StreamReader<Token> tokens, Mode mode)
-    : tokens_(std::move(tokens)), mode_(mode) {
+Parser::Parser(TokenBuffer tokens, Mode mode, SymbolTable::Ptr symbols)
+    : Parser(std::nullopt, mode, std::move(symbols)) {
+  buffer_ = std::move(tokens);
+}
+
+Parser::Parser(TokenStreamReader tokens, Mode mode,
+               SymbolTable::Ptr symbols)
+    : Parser(std::optional<TokenStreamReader>(std::move(tokens)), mode,
+             std::move(symbols)) {}
+
+Parser::Parser(std::optional<TokenStreamReader> tokens, Mode mode,
+               SymbolTable::Ptr symbols)
+    : tokens_(std::move(tokens)),
+      mode_(mode),
+      symbols_(symbols ? std::move(symbols)
+                       : std::make_shared<SymbolTable>()) {
+  syntax_tree_.symbols_ = symbols_;
 #if 0  // TODO(erik): Reorganize.
   // Statement rules.
-  stmt_rules_[Token::Type::DEF];  // function def
-  stmt_rules_[Token::Type::ASYNC];  // async function def, async for, async with
-  stmt_rules_[Token::Type::CLASS];  // class def
-  stmt_rules_[Token::Type::RETURN];  // return
-  stmt_rules_[Token::Type::DEL];  // delete
-  stmt_rules_[Token::Type::ASSIGN];  // assign
-  stmt_rules_[Token::Type::PLUS_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::MINUS_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::MULTIPLY_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::DIVIDE_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::FLOOR_DIVIDE_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::MODULO_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::MATMUL_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::AND_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::OR_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::XOR_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::RIGHT_SHIFT_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::LEFT_SHIFT_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::POWER_ASSIGN];  // aug assign
-  stmt_rules_[Token::Type::FOR];  // for
-  stmt_rules_[Token::Type::WHILE];  // while
-  stmt_rules_[Token::Type::IF];  // if
-  stmt_rules_[Token::Type::WITH];  // with
-  stmt_rules_[Token::Type::RAISE];  // raise
-  stmt_rules_[Token::Type::TRY];  // try, trystar
-  stmt_rules_[Token::Type::ASSERT];  // assert
-  stmt_rules_[Token::Type::IMPORT];  // import, import from
-  stmt_rules_[Token::Type::GLOBAL];  // global
-  stmt_rules_[Token::Type::NONLOCAL];  // nonlocal
-  stmt_rules_[Token::Type::PASS];  // pass
-  stmt_rules_[Token::Type::BREAK];  // break
-  stmt_rules_[Token::Type::CONTINUE];  // continue
+  kStatementRules[Token::Type::DEF];  // function def
+  kStatementRules[Token::Type::ASYNC];  // async function def, async for, async with
+  kStatementRules[Token::Type::CLASS];  // class def
+  kStatementRules[Token::Type::RETURN];  // return
+  kStatementRules[Token::Type::DEL];  // delete
+  kStatementRules[Token::Type::ASSIGN];  // assign
+  kStatementRules[Token::Type::PLUS_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::MINUS_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::MULTIPLY_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::DIVIDE_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::FLOOR_DIVIDE_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::MODULO_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::MATMUL_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::AND_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::OR_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::XOR_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::RIGHT_SHIFT_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::LEFT_SHIFT_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::POWER_ASSIGN];  // aug assign
+  kStatementRules[Token::Type::FOR];  // for
+  kStatementRules[Token::Type::WHILE];  // while
+  kStatementRules[Token::Type::IF];  // if
+  kStatementRules[Token::Type::WITH];  // with
+  kStatementRules[Token::Type::RAISE];  // raise
+  kStatementRules[Token::Type::TRY];  // try, trystar
+  kStatementRules[Token::Type::ASSERT];  // assert
+  kStatementRules[Token::Type::IMPORT];  // import, import from
+  kStatementRules[Token::Type::GLOBAL];  // global
+  kStatementRules[Token::Type::NONLOCAL];  // nonlocal
+  kStatementRules[Token::Type::PASS];  // pass
+  kStatementRules[Token::Type::BREAK];  // break
+  kStatementRules[Token::Type::CONTINUE];  // continue
 
   // Expression rules.
-  expr_rules_[Token::Type::AND];  // boolean op
-  expr_rules_[Token::Type::OR];  // boolean op
-  expr_rules_[Token::Type::NAMED_EXPR];  // named expr
-  expr_rules_[Token::Type::PLUS];  // binary op, unary op
-  expr_rules_[Token::Type::MINUS];  // binary op, unary op
-  expr_rules_[Token::Type::MULTIPLY];  // binary op, starred
-  expr_rules_[Token::Type::MATMUL]; // binary op
-  expr_rules_[Token::Type::DIVIDE];  // binary op
-  expr_rules_[Token::Type::MODULO];  // binary op
-  expr_rules_[Token::Type::POWER];  // binary op, starred
-  expr_rules_[Token::Type::LEFT_SHIFT]; // binary op
-  expr_rules_[Token::Type::RIGHT_SHIFT];  // binary op
-  expr_rules_[Token::Type::BITWISE_OR];  // binary op
-  expr_rules_[Token::Type::BITWISE_XOR];  // binary op
-  expr_rules_[Token::Type::BITWISE_AND];  // binary op
-  expr_rules_[Token::Type::FLOOR_DIVIDE];  // binary op
-  expr_rules_[Token::Type::INVERT];  // unary op
-  expr_rules_[Token::Type::NOT];  // unary op
-  expr_rules_[Token::Type::LAMBDA];  // lambda
-  expr_rules_[Token::Type::IF];  // ifexp (also a member of `stmt_rules_`).
-  expr_rules_[Token::Type::LEFT_BRACKET];  // list, listcomp, subscript
-  expr_rules_[Token::Type::LEFT_BRACE];  // dict, set, dictcomp, setcomp
-  expr_rules_[Token::Type::LEFT_PAREN];  // tuple, generatorexp, call
-  expr_rules_[Token::Type::AWAIT];  // await
-  expr_rules_[Token::Type::YIELD];  // yield, yield from
-  expr_rules_[Token::Type::EQUALS];  // compare
-  expr_rules_[Token::Type::NOT_EQUALS];  // compare
-  expr_rules_[Token::Type::LESS_THAN];  // compare
-  expr_rules_[Token::Type::LESS_EQUAL];  // compare
-  expr_rules_[Token::Type::GREATER_THAN];  // compare
-  expr_rules_[Token::Type::GREATER_EQUAL];  // compare
-  expr_rules_[Token::Type::IS];  // compare
-  expr_rules_[Token::Type::IS_NOT];  // compare
-  expr_rules_[Token::Type::NOT_IN];  // compare
-  expr_rules_[Token::Type::INTEGER];  // constant
-  expr_rules_[Token::Type::FLOAT];  //constant
-  expr_rules_[Token::Type::FALSE];  // constant
-  expr_rules_[Token::Type::TRUE];  // constant
-  expr_rules_[Token::Type::STRING]; // constant - TODO: formattedvalue / joinedstr?
-  expr_rules_[Token::Type::ATTRIBUTE];  // attribute
-  expr_rules_[Token::Type::IDENTIFIER];  // name
-  expr_rules_[Token::Type::COLON];  // slice
+  kExpressionRules[Token::Type::AND];  // boolean op
+  kExpressionRules[Token::Type::OR];  // boolean op
+  kExpressionRules[Token::Type::NAMED_EXPR];  // named expr
+  kExpressionRules[Token::Type::PLUS];  // binary op, unary op
+  kExpressionRules[Token::Type::MINUS];  // binary op, unary op
+  kExpressionRules[Token::Type::MULTIPLY];  // binary op, starred
+  kExpressionRules[Token::Type::MATMUL]; // binary op
+  kExpressionRules[Token::Type::DIVIDE];  // binary op
+  kExpressionRules[Token::Type::MODULO];  // binary op
+  kExpressionRules[Token::Type::POWER];  // binary op, starred
+  kExpressionRules[Token::Type::LEFT_SHIFT]; // binary op
+  kExpressionRules[Token::Type::RIGHT_SHIFT];  // binary op
+  kExpressionRules[Token::Type::BITWISE_OR];  // binary op
+  kExpressionRules[Token::Type::BITWISE_XOR];  // binary op
+  kExpressionRules[Token::Type::BITWISE_AND];  // binary op
+  kExpressionRules[Token::Type::FLOOR_DIVIDE];  // binary op
+  kExpressionRules[Token::Type::INVERT];  // unary op
+  kExpressionRules[Token::Type::NOT];  // unary op
+  kExpressionRules[Token::Type::LAMBDA];  // lambda
+  kExpressionRules[Token::Type::IF];  // ifexp (also a member of `kStatementRules`).
+  kExpressionRules[Token::Type::LEFT_BRACKET];  // list, listcomp, subscript
+  kExpressionRules[Token::Type::LEFT_BRACE];  // dict, set, dictcomp, setcomp
+  kExpressionRules[Token::Type::LEFT_PAREN];  // tuple, generatorexp, call
+  kExpressionRules[Token::Type::AWAIT];  // await
+  kExpressionRules[Token::Type::YIELD];  // yield, yield from
+  kExpressionRules[Token::Type::EQUALS];  // compare
+  kExpressionRules[Token::Type::NOT_EQUALS];  // compare
+  kExpressionRules[Token::Type::LESS_THAN];  // compare
+  kExpressionRules[Token::Type::LESS_EQUAL];  // compare
+  kExpressionRules[Token::Type::GREATER_THAN];  // compare
+  kExpressionRules[Token::Type::GREATER_EQUAL];  // compare
+  kExpressionRules[Token::Type::IS];  // compare
+  kExpressionRules[Token::Type::IS_NOT];  // compare
+  kExpressionRules[Token::Type::NOT_IN];  // compare
+  kExpressionRules[Token::Type::INTEGER];  // constant
+  kExpressionRules[Token::Type::FLOAT];  //constant
+  kExpressionRules[Token::Type::FALSE];  // constant
+  kExpressionRules[Token::Type::TRUE];  // constant
+  kExpressionRules[Token::Type::STRING]; // constant - TODO: formattedvalue / joinedstr?
+  kExpressionRules[Token::Type::ATTRIBUTE];  // attribute
+  kExpressionRules[Token::Type::IDENTIFIER];  // name
+  kExpressionRules[Token::Type::COLON];  // slice
 #endif
-
-  // ==, !=, <, <=, >, >=, is, is not, in, not in
-
-  // Rule for DEL token.
-  stmt_rules_[Token::Type::DEL] = [&] { ParseDeleteStatement(); };
-
-  // Rule for IF token.
-  stmt_rules_[Token::Type::IF] = [&] { ParseIfStatement(); };
-
-  // Rule for IN token.
-  expr_rules_[Token::Type::IN] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for IS token.
-  expr_rules_[Token::Type::IS] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for IS_NOT token.
-  expr_rules_[Token::Type::IS_NOT] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for NOT_IN token.
-  expr_rules_[Token::Type::NOT_IN] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for NOT token.
-  expr_rules_[Token::Type::NOT] =
-      ParseExpressionRule{.prefix = [&] { ParseUnaryOpExpression(); },
-                          .infix = nullptr,
-                          .precedence = TokenPrecedence::NOT};
-
-  // Rule for IDENTIFIER token.
-  expr_rules_[Token::Type::IDENTIFIER] =
-      ParseExpressionRule{.prefix = [&] { ParseNameExpression(); },
-                          .infix = nullptr,
-                          .precedence = TokenPrecedence::NONE};
-
-  // Rule for INTEGER token.
-  expr_rules_[Token::Type::INTEGER] =
-      ParseExpressionRule{.prefix = [&] { ParseConstantExpression(); },
-                          .infix = nullptr,
-                          .precedence = TokenPrecedence::NONE};
-
-  // Rule for FLOAT token.
-  expr_rules_[Token::Type::FLOAT] =
-      ParseExpressionRule{.prefix = [&] { ParseConstantExpression(); },
-                          .infix = nullptr,
-                          .precedence = TokenPrecedence::NONE};
-
-  // Rule for STRING token.
-  expr_rules_[Token::Type::STRING] =
-      ParseExpressionRule{.prefix = [&] { ParseConstantExpression(); },
-                          .infix = nullptr,
-                          .precedence = TokenPrecedence::NONE};
-
-  // Rule for PLUS token.
-  expr_rules_[Token::Type::PLUS] =
-      ParseExpressionRule{.prefix = [&] { ParseUnaryOpExpression(); },
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::ADD_SUBTRACT};
-
-  // Rule for MINUS token.
-  expr_rules_[Token::Type::MINUS] =
-      ParseExpressionRule{.prefix = [&] { ParseUnaryOpExpression(); },
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::ADD_SUBTRACT};
-
-  // Rule for MULTIPLY token.
-  expr_rules_[Token::Type::MULTIPLY] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::MULTIPLY_DIVIDE};
-
-  // Rule for POWER token.
-  expr_rules_[Token::Type::POWER] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::POWER};
-
-  // Rule for DIVIDE token.
-  expr_rules_[Token::Type::DIVIDE] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::MULTIPLY_DIVIDE};
-
-  // Rule for FLOOR_DIVIDE token.
-  expr_rules_[Token::Type::FLOOR_DIVIDE] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::MULTIPLY_DIVIDE};
-
-  // Rule for MODULO token.
-  expr_rules_[Token::Type::MODULO] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::MULTIPLY_DIVIDE};
-
-  // Rule for MATMUL token.
-  expr_rules_[Token::Type::MATMUL] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::MULTIPLY_DIVIDE};
-
-  // Rule for LEFT_SHIFT token.
-  expr_rules_[Token::Type::LEFT_SHIFT] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::BITWISE_SHIFT};
-
-  // Rule for RIGHT_SHIFT token.
-  expr_rules_[Token::Type::RIGHT_SHIFT] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::BITWISE_SHIFT};
-
-  // Rule for BITWISE_AND token.
-  expr_rules_[Token::Type::BITWISE_AND] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::BITWISE_AND};
-
-  // Rule for BITWISE_OR token.
-  expr_rules_[Token::Type::BITWISE_OR] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::BITWISE_OR};
-
-  // Rule for BITWISE_XOR token.
-  expr_rules_[Token::Type::BITWISE_XOR] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseBinaryOpExpression(); },
-                          .precedence = TokenPrecedence::BITWISE_XOR};
-
-  // Rule for INVERT token.
-  expr_rules_[Token::Type::INVERT] =
-      ParseExpressionRule{.prefix = [&] { ParseUnaryOpExpression(); },
-                          .infix = nullptr,
-                          .precedence = TokenPrecedence::BITWISE_NOT};
-
-  // Rule for LESS_THAN token.
-  expr_rules_[Token::Type::LESS_THAN] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for LESS_EQUAL token.
-  expr_rules_[Token::Type::LESS_EQUAL] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for GREATER_EQUAL token.
-  expr_rules_[Token::Type::GREATER_EQUAL] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for GREATER_THAN token.
-  expr_rules_[Token::Type::GREATER_THAN] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for EQUALS token.
-  expr_rules_[Token::Type::EQUALS] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for NOT_EQUALS token.
-  expr_rules_[Token::Type::NOT_EQUALS] =
-      ParseExpressionRule{.prefix = nullptr,
-                          .infix = [&] { ParseCompareExpression(); },
-                          .precedence = TokenPrecedence::COMPARISON};
-
-  // Rule for ASSIGN token.
-  stmt_rules_[Token::Type::ASSIGN] = [&] { ParseAssignStatement(); };
 }
 
-void Parser::Parse() {
+void Parser::Parse() { TryParse().ThrowIfError(); }
+
+Status Parser::TryParse() {
+  status_ = Status();
+
   // Top level node in the syntax tree corresponds to execution mode.
   if (mode_ == Mode::EXPRESSION) {
     // In EXPRESSION mode we expect a single expression.
@@ -325,45 +182,94 @@ void Parser::Parse() {
       syntax_tree_.root_ = std::move(root);
     }
   }
+
+  // Discard anything left over from a failed parse.
+  if (!status_.ok()) {
+    syntax_tree_.root_ = nullptr;
+    blocks_.clear();
+    stmts_.clear();
+    exprs_.clear();
+  }
+  return status_;
+}
+
+std::optional<Token::Type> Parser::PeekType() const {
+  if (!status_.ok()) return std::nullopt;
+  if (tokens_) {
+    std::optional<const Token*> token = tokens_->Peek();
+    if (!token) return std::nullopt;
+    return (*token)->type;
+  }
+  if (Depleted()) return std::nullopt;
+  return buffer_.type(buffer_idx_);
 }
 
-bool Parser::Peek(Token::Type type) const {
-  return !tokens_.Depleted() && (*tokens_.Peek())->type == type;
+std::optional<Token> Parser::ReadToken() const {
+  if (!status_.ok()) return std::nullopt;
+  if (tokens_) return tokens_->Read();
+  if (Depleted()) return std::nullopt;
+  return buffer_[buffer_idx_++];
 }
 
+bool Parser::AdvanceToken() const {
+  if (!status_.ok()) return false;
+  if (tokens_) return tokens_->Advance();
+  if (Depleted()) return false;
+  ++buffer_idx_;
+  return true;
+}
+
+bool Parser::Depleted() const {
+  if (!status_.ok()) return true;
+  if (tokens_) return tokens_->Depleted();
+  return buffer_idx_ >= buffer_.size();
+}
+
+bool Parser::Peek(Token::Type type) const { return PeekType() == type; }
+
 bool Parser::Match(Token::Type type) const {
   if (Peek(type)) {
-    tokens_.Advance();
+    AdvanceToken();
     return true;
   }
 
   return false;
 }
 
-void Parser::Consume(Token::Type type) const {
-  Expect(type);
-  Match(type);
+bool Parser::Consume(Token::Type type) const {
+  return Expect(type) && Match(type);
 }
 
-void Parser::Expect(Token::Type type) const {
-  std::optional<const Token*> next_token = tokens_.Peek();
-  if (!next_token.has_value()) {
-    std::string err = "Failed to match token ";
-    err += kTokenTypeToString.at(type);
-    err += " (no more tokens available).";
-    throw std::runtime_error(err);
+bool Parser::Expect(Token::Type type) const {
+  std::optional<Token::Type> next_type = PeekType();
+  if (!next_type.has_value()) {
+    Fail(Status::ExpectedToken(type, std::nullopt));
+    return false;
   }
-  if (next_token.value()->type != type) {
-    std::string err = "Failed to match token ";
-    err += kTokenTypeToString.at(type);
-    err += " (got " + kTokenTypeToString.at(next_token.value()->type) + ").";
-    throw std::runtime_error(err);
+  if (*next_type != type) {
+    Fail(Status::ExpectedToken(type, *next_type, Offset()));
+    return false;
   }
+  return true;
+}
+
+void Parser::Fail(Status status) const {
+  if (status_.ok()) status_ = status;
+}
+
+uint32_t Parser::Offset() const {
+  if (!status_.ok()) return Token::kNoOffset;
+  if (tokens_) {
+    std::optional<const Token*> token = tokens_->Peek();
+    return token ? (*token)->offset : Token::kNoOffset;
+  }
+  if (Depleted()) return Token::kNoOffset;
+  return buffer_.offset(buffer_idx_);
 }
 
 void Parser::ParseBlock() {
   // Parse statements until a dedent, or depleted.
-  while (!tokens_.Depleted() && !Match(Token::Type::DEDENT)) {
+  while (!Depleted() && !Match(Token::Type::DEDENT)) {
     ParseStatement();
   }
 
@@ -375,17 +281,21 @@ void Parser::ParseBlock() {
 }
 
 void Parser::ParseStatement() {
-  while (!tokens_.Depleted() && !Match(Token::Type::NEWLINE)) {
-    std::optional<const Token*> next_token = tokens_.Peek();
-    if (!next_token) return;
-    std::cout << **next_token;
-    auto it = stmt_rules_.find((*next_token)->type);
-    
-    if (it != stmt_rules_.end()) {
+  while (!Depleted() && !Match(Token::Type::NEWLINE)) {
+    std::optional<Token::Type> next_type = PeekType();
+    if (!next_type) return;
+    if (tokens_) {
+      std::cout << **tokens_->Peek();
+    } else {
+      std::cout << buffer_[buffer_idx_];
+    }
+    const ParseStatementRule rule =
+        kStatementRules[static_cast<size_t>(*next_type)];
+    if (rule) {
       // Apply statement rule to the token.
-      it->second();
+      (this->*rule)();
       break;
-    } 
+    }
     
     // Couldn't find a matching statement. Parse as an expression. Internally
     // this stores the expression so that subsequent statements can use it.
@@ -395,62 +305,53 @@ void Parser::ParseStatement() {
   // Parse any remaining expression into an expression statement.
   if (auto expr = Pop(&exprs_)) {
     auto stmt = std::make_unique<Expr>();
+    stmt->offset = expr->offset;
     stmt->expr = std::move(expr);
     Push(&stmts_, std::move(stmt));
   }
 }
 
 void Parser::ParseExpression(TokenPrecedence precedence) {
-  std::optional<const Token*> next_token = tokens_.Peek();
-  if (!next_token) return;
+  std::optional<Token::Type> next_type = PeekType();
+  if (!next_type) return;
 
   // Syntax error if we can't find an expression match for this token.
-  auto it = expr_rules_.find((*next_token)->type);
-  if (it == expr_rules_.end()) {
-    throw std::runtime_error("Encountered unexpected token: " +
-                             (*next_token)->DebugString());
+  const ParseExpressionRule& prefix_rule = ExpressionRule(*next_type);
+  if (!prefix_rule.prefix) {
+    Fail(Status::UnexpectedToken(*next_type, Offset()));
+    return;
   }
 
   // Apply prefix rule.
-  TokenPrecedence rule_precedence = TokenPrecedence::NONE;
-  if (const ParseExpressionRule& rule = it->second; rule.prefix) {
-    rule_precedence = rule.precedence;
-    rule.prefix();
-  } else {
-    throw std::runtime_error("Expected unexpected token: " +
-                             (*next_token)->DebugString());
-  }
+  TokenPrecedence rule_precedence = prefix_rule.precedence;
+  (this->*prefix_rule.prefix)();
 
   // Apply infix rule(s).
-  while (!tokens_.Depleted() &&
-         static_cast<int>(rule_precedence) >= static_cast<int>(precedence)) {
-    next_token = tokens_.Peek();
-    const Token::Type next_type = (*next_token)->type;
-    auto it = expr_rules_.find(next_type);
-    if (it != expr_rules_.end()) {
-      const ParseExpressionRule& rule = it->second;
-      if (rule.infix == nullptr) {
-        throw std::runtime_error("Encountered null infix for token: " +
-                                 (*next_token)->DebugString());
-      }
-      rule_precedence = rule.precedence;
-      rule.infix();
-    } else {
-      break;
+  while (static_cast<int>(rule_precedence) >= static_cast<int>(precedence)) {
+    next_type = PeekType();
+    if (!next_type) break;
+    const ParseExpressionRule& rule = ExpressionRule(*next_type);
+    if (!rule.prefix && !rule.infix) break;
+    if (!rule.infix) {
+      Fail(Status::UnexpectedToken(*next_type, Offset()));
+      return;
     }
+    rule_precedence = rule.precedence;
+    (this->*rule.infix)();
   }
 }
 
 void Parser::ParseDeleteStatement() {
   // Eat preceding DEL token.
+  auto stmt = std::make_unique<Delete>();
+  stmt->offset = Offset();
   Consume(Token::Type::DEL);
 
   puts("Parse delete statement");
 
   // Parse comma-separated list of names.
-  auto stmt = std::make_unique<Delete>();
   do {
-    Expect(Token::Type::IDENTIFIER);
+    if (!Expect(Token::Type::IDENTIFIER)) return;
     ParseNameExpression();
 
     auto expr = Pop(&exprs_);
@@ -475,6 +376,7 @@ void Parser::ParseAssignStatement() {
 
   // The final parsed expression is the value of the assignment.
   auto stmt = std::make_unique<Assign>();
+  stmt->offset = OffsetOf(exprs.front());
   stmt->value = std::move(exprs.back());
   exprs.pop_back();
 
@@ -495,9 +397,9 @@ void Parser::ParseIfStatement() {
   puts("Parse if statement");
 
   // Eat preceding IF or ELIF token.
-  tokens_.Advance();
-
   auto stmt = std::make_unique<If>();
+  stmt->offset = Offset();
+  AdvanceToken();
 
   // Parse the if test.
   ParseExpression();
@@ -546,7 +448,7 @@ void Parser::ParseIfStatement() {
 }
 
 void Parser::ParseBinaryOpExpression() {
-  std::optional<Token> token = tokens_.Read();
+  std::optional<Token> token = ReadToken();
 
   puts("Parse binary expression for token:");
   std::cout << "\t" << *token;
@@ -581,24 +483,27 @@ void Parser::ParseBinaryOpExpression() {
       case Token::Type::FLOOR_DIVIDE:
         return BinaryOpType::FLOOR_DIVIDE;
       default:
-        throw std::runtime_error("Encountered unexpected binary operation: " +
-                                 token->DebugString());
+        Fail(Status::UnexpectedToken(token->type));
+        return BinaryOpType::ADD;
     }
   }();
+  if (!status_.ok()) return;
 
   expr->lhs = Pop(&exprs_);
-  ParseExpression(expr_rules_[token->type].precedence);
+  expr->offset = OffsetOf(expr->lhs);
+  ParseExpression(ExpressionRule(token->type).precedence);
   expr->rhs = Pop(&exprs_);
   Push(&exprs_, std::move(expr));
 }
 
 void Parser::ParseUnaryOpExpression() {
-  std::optional<Token> token = tokens_.Read();
+  std::optional<Token> token = ReadToken();
 
   puts("Parse unary expression for token:");
   std::cout << "\t" << *token;
 
   auto expr = std::make_unique<UnaryOp>();
+  expr->offset = token->offset;
   expr->op_type = [&]() {
     switch (token->type) {
       case Token::Type::PLUS:
@@ -610,12 +515,13 @@ void Parser::ParseUnaryOpExpression() {
       case Token::Type::INVERT:
         return UnaryOpType::INVERT;
       default:
-        throw std::runtime_error("Encountered unexpected unary operation: " +
-                                 token->DebugString());
+        Fail(Status::UnexpectedToken(token->type));
+        return UnaryOpType::POSITIVE;
     }
   }();
+  if (!status_.ok()) return;
 
-  ParseExpression(expr_rules_[token->type].precedence);
+  ParseExpression(ExpressionRule(token->type).precedence);
   expr->operand = Pop(&exprs_);
   Push(&exprs_, std::move(expr));
 }
@@ -625,14 +531,15 @@ void Parser::ParseCompareExpression() {
 
   auto expr = std::make_unique<Compare>();
   expr->lhs = Pop(&exprs_);
+  expr->offset = OffsetOf(expr->lhs);
 
   // Keep matching comparison operators until we can't anymore. For example,
   // the expression 'a < b >= c not in d' has 3 comparison ops ('<', '>=',
   // 'not in'), and 3 comparators ('b', 'c', 'd').
-  while (!tokens_.Depleted()) {
-    std::optional<const Token*> op_token = tokens_.Peek();
+  while (!Depleted()) {
+    std::optional<Token::Type> op_type = PeekType();
     bool matched = true;
-    switch ((*op_token)->type) {
+    switch (*op_type) {
       case Token::Type::EQUALS:
         expr->ops.emplace_back(CompareOpType::EQUALS);
         break;
@@ -669,7 +576,7 @@ void Parser::ParseCompareExpression() {
     }
 
     if (!matched) break;
-    tokens_.Advance();
+    AdvanceToken();
 
     // Parse the comparator expression (after the comparison operator).
     ParseExpression(TokenPrecedence::COMPARISON);
@@ -678,30 +585,36 @@ void Parser::ParseCompareExpression() {
 
   // Make sure that we had at least one comparator on the right hand side.
   if (expr->ops.empty() || expr->comparators.empty()) {
-    throw std::runtime_error(
-        "Encountered comparison token, but found no comparator.");
+    Fail(Status(ErrorCode::MISSING_COMPARATOR, Offset()));
+    return;
   }
 
   Push(&exprs_, std::move(expr));
 }
 
 void Parser::ParseConstantExpression() {
-  std::optional<Token> token = tokens_.Read();
+  std::optional<Token> token = ReadToken();
 
   puts("Parse constant expression for token:");
   std::cout << "\t" << *token;
 
   auto expr = std::make_unique<Constant>();
+  expr->offset = token->offset;
   expr->value = [&]() -> ConstantValue {
     switch (token->type) {
-      case Token::Type::INTEGER: {
-        return std::stoi(token->value.value());
-      }
+      case Token::Type::INTEGER:
       case Token::Type::FLOAT: {
-        return std::stod(token->value.value());
+        return NumberConstant(*token);
       }
       case Token::Type::STRING: {
-        return token->value.value();
+        // Keep the raw literal, deferring decoding until it is needed. Flags
+        // are computed while lexing, unless the token was created some other
+        // way.
+        const std::string_view raw = token->value.value();
+        return StringLiteral(raw,
+                             token->source ? token->string_flags
+                                           : StringLiteral::ScanFlags(raw),
+                             token->source);
       }
       default:
         return NoneType();
@@ -712,13 +625,21 @@ void Parser::ParseConstantExpression() {
 }
 
 void Parser::ParseNameExpression() {
-  std::optional<Token> token = tokens_.Read();
+  std::optional<Token> token = ReadToken();
 
   puts("Parse name expression for token:");
   std::cout << "\t" << *token;
 
+  // Identifiers are compared in NFKC, which leaves ASCII unchanged.
   auto expr = std::make_unique<Name>();
-  expr->id = std::move(token->value.value());
+  expr->offset = token->offset;
+  SymbolId id = token->symbol;
+  if (id == SymbolTable::kNoSymbol) {
+    const std::string_view name = token->value.value();
+    id = IsAscii(name) ? symbols_->Intern(name)
+                       : symbols_->Intern(NormalizeNfkc(name));
+  }
+  expr->id = Identifier(id, symbols_.get());
   expr->ctx_type = ExprContextType::LOAD;
   Push(&exprs_, std::move(expr));
 }
\ No newline at end of file
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <array>
 #include <deque>
-#include <functional>
-#include <unordered_map>
+#include <optional>
 
+#include "lexer.h"
+#include "status.h"
 #include "stream.h"
+#include "symbol_table.h"
 #include "syntax_tree.h"
 #include "token.h"
+#include "token_buffer.h"
 
 // https://docs.python.org/3/reference/expressions.html#operator-precedence
 enum class TokenPrecedence : int {
@@ -30,9 +34,13 @@ enum class TokenPrecedence : int {
   COMPREHENSION,    // (x,...), [x,...], {x:y,...}, {x,...}
 };
 
+class Parser;
+
 // Pratt parsing rules, following:
 // https://journal.stuffwithstuff.com/2011/03/19/pratt-parsers-expression-parsing-made-easy/
-using ParseStatementRule = std::function<void()>;
+// Rules are parser member functions, looked up by token type in constant
+// tables (see Parser::kStatementRules and Parser::kExpressionRules).
+using ParseStatementRule = void (Parser::*)();
 
 // Our PrefixRule and InfixRule type aliases correspond to the PrefixParselet
 // and InfixParselet concepts.
@@ -43,7 +51,7 @@ struct ParseExpressionRule {
   //     - `-` is the prefix token
   //     - `(a + b)` is the next expression from the parser
   //
-  using PrefixRule = std::function<void()>;
+  using PrefixRule = void (Parser::*)();
   // An infix parser eats an lhs node, and an infix token, and applies their
   // combination to the next expression from the parser. E.g.
   //  source: `a + b`
@@ -51,7 +59,7 @@ struct ParseExpressionRule {
   //    - `+` is the infix token
   //    - `b` is the next expression from the parser
   //
-  using InfixRule = std::function<void()>;
+  using InfixRule = void (Parser::*)();
 
   PrefixRule prefix = nullptr;
   InfixRule infix = nullptr;
@@ -66,16 +74,44 @@ class Parser {
     EXPRESSION    // Parse a single expression.
   };
 
-  explicit Parser(StreamReader<Token> tokens, Mode mode = Mode::MODULE);
+  // Parse tokens pulled from a token stream. Identifiers are interned in
+  // `symbols`, or in a symbol table of the parser's own if null. Tokens that
+  // were already interned while lexing (see Lexer::SetSymbolTable) must have
+  // been interned in the same symbol table.
+  explicit Parser(TokenStreamReader tokens, Mode mode = Mode::MODULE,
+                  SymbolTable::Ptr symbols = nullptr);
+
+  // Parse tokens from a packed token buffer, by index.
+  explicit Parser(TokenBuffer tokens, Mode mode = Mode::MODULE,
+                  SymbolTable::Ptr symbols = nullptr);
 
-  // Parse all remaining source code.
+  // Parse all remaining source code. Throws on errors.
   void Parse();
 
+  // As above, but returns errors rather than throwing them. Parsing stops at
+  // the first error, without unwinding: once an error is recorded, the parser
+  // treats the tokens as depleted, so that each parse function returns as soon
+  // as it next checks for tokens. Errors thrown by the token stream (see
+  // Lexer::SetThrowOnError()) are not caught.
+  Status TryParse();
+
   // Access the parsed syntax tree.
   const SyntaxTree& syntax_tree() const& { return syntax_tree_; }
   SyntaxTree&& syntax_tree() && { return std::move(syntax_tree_); }
 
  private:
+  Parser(std::optional<TokenStreamReader> tokens, Mode mode,
+         SymbolTable::Ptr symbols);
+
+  // Token access, from either the token stream or the token buffer. These
+  // follow the semantics of the corresponding StreamReader methods, except
+  // that peeking only returns the type of the next token, so that tokens in
+  // the token buffer are only materialized once read.
+  std::optional<Token::Type> PeekType() const;
+  std::optional<Token> ReadToken() const;
+  bool AdvanceToken() const;
+  bool Depleted() const;
+
   // Returns whether the next token matches the provided type.
   bool Peek(Token::Type type) const;
 
@@ -83,12 +119,19 @@ class Parser {
   bool Match(Token::Type type) const;
 
   // Checks that the next token is of the provided type, then consumes it.
-  // Throws an exception if the token's type did not match.
-  void Consume(Token::Type type) const;
+  // Fails if the token's type did not match. Returns whether it matched.
+  bool Consume(Token::Type type) const;
+
+  // Fails if the next token does not exist, or does not match the provided
+  // type. Returns whether it matched.
+  bool Expect(Token::Type type) const;
 
-  // Throws an exception if the next token does not exist, or does not match
-  // the provided type.
-  void Expect(Token::Type type) const;
+  // Record an error, unless one was already recorded.
+  void Fail(Status status) const;
+
+  // Byte offset of the next token within the source code, or kNoOffset if
+  // unknown or depleted.
+  uint32_t Offset() const;
 
   // Parse a block, consisting of a sequence of statements. Each block
   // corresponds to one single scope, separated by indentation.
@@ -144,12 +187,24 @@ class Parser {
   // void ParseSliceExpression();
 
   // A stream of tokens generated from source code, which are converted
-  // to statements and expressions in the syntax tree when read.
-  mutable StreamReader<Token> tokens_;
+  // to statements and expressions in the syntax tree when read. Unset when
+  // parsing from `buffer_` instead.
+  mutable std::optional<TokenStreamReader> tokens_;
+
+  // Alternatively, a buffer of tokens, and the index of the next token to
+  // read from it.
+  TokenBuffer buffer_;
+  mutable size_t buffer_idx_ = 0u;
 
   // Top-level execution mode.
   Mode mode_;
 
+  // The first error encountered while parsing, if any.
+  mutable Status status_;
+
+  // Symbol table that identifiers are interned in.
+  SymbolTable::Ptr symbols_;
+
   // The syntax tree. Incrementally built from `tokens_`.
   SyntaxTree syntax_tree_;
 
@@ -165,7 +220,69 @@ class Parser {
   // Previously parsed expressions that do not belong to a statement yet.
   std::deque<ExpressionNode::Ptr> exprs_;
 
-  // TODO(erik): Change to array? Likewise for other maps keyed on token type.
-  std::unordered_map<Token::Type, ParseStatementRule> stmt_rules_;
-  std::unordered_map<Token::Type, ParseExpressionRule> expr_rules_;
+  // Rules for tokens that begin statements, and for tokens within
+  // expressions, indexed by token type. Rules are null for other tokens.
+  static constexpr std::array<ParseStatementRule, Token::kNumTypes>
+      kStatementRules = [] {
+        std::array<ParseStatementRule, Token::kNumTypes> rules = {};
+        auto set = [&](Token::Type type, ParseStatementRule rule) {
+          rules[static_cast<size_t>(type)] = rule;
+        };
+        using Type = Token::Type;
+        set(Type::DEL, &Parser::ParseDeleteStatement);
+        set(Type::IF, &Parser::ParseIfStatement);
+        set(Type::ASSIGN, &Parser::ParseAssignStatement);
+        return rules;
+      }();
+  static constexpr std::array<ParseExpressionRule, Token::kNumTypes>
+      kExpressionRules = [] {
+        std::array<ParseExpressionRule, Token::kNumTypes> rules = {};
+        auto set = [&](Token::Type type, ParseExpressionRule rule) {
+          rules[static_cast<size_t>(type)] = rule;
+        };
+        const auto name = &Parser::ParseNameExpression;
+        const auto constant = &Parser::ParseConstantExpression;
+        const auto unary = &Parser::ParseUnaryOpExpression;
+        const auto binary = &Parser::ParseBinaryOpExpression;
+        const auto compare = &Parser::ParseCompareExpression;
+        using Type = Token::Type;
+        using Precedence = TokenPrecedence;
+
+        set(Type::IN, {nullptr, compare, Precedence::COMPARISON});
+        set(Type::IS, {nullptr, compare, Precedence::COMPARISON});
+        set(Type::IS_NOT, {nullptr, compare, Precedence::COMPARISON});
+        set(Type::NOT_IN, {nullptr, compare, Precedence::COMPARISON});
+        set(Type::NOT, {unary, nullptr, Precedence::NOT});
+        set(Type::IDENTIFIER, {name, nullptr, Precedence::NONE});
+        set(Type::INTEGER, {constant, nullptr, Precedence::NONE});
+        set(Type::FLOAT, {constant, nullptr, Precedence::NONE});
+        set(Type::STRING, {constant, nullptr, Precedence::NONE});
+        set(Type::PLUS, {unary, binary, Precedence::ADD_SUBTRACT});
+        set(Type::MINUS, {unary, binary, Precedence::ADD_SUBTRACT});
+        set(Type::MULTIPLY, {nullptr, binary, Precedence::MULTIPLY_DIVIDE});
+        set(Type::POWER, {nullptr, binary, Precedence::POWER});
+        set(Type::DIVIDE, {nullptr, binary, Precedence::MULTIPLY_DIVIDE});
+        set(Type::FLOOR_DIVIDE,
+            {nullptr, binary, Precedence::MULTIPLY_DIVIDE});
+        set(Type::MODULO, {nullptr, binary, Precedence::MULTIPLY_DIVIDE});
+        set(Type::MATMUL, {nullptr, binary, Precedence::MULTIPLY_DIVIDE});
+        set(Type::LEFT_SHIFT, {nullptr, binary, Precedence::BITWISE_SHIFT});
+        set(Type::RIGHT_SHIFT, {nullptr, binary, Precedence::BITWISE_SHIFT});
+        set(Type::BITWISE_AND, {nullptr, binary, Precedence::BITWISE_AND});
+        set(Type::BITWISE_OR, {nullptr, binary, Precedence::BITWISE_OR});
+        set(Type::BITWISE_XOR, {nullptr, binary, Precedence::BITWISE_XOR});
+        set(Type::INVERT, {unary, nullptr, Precedence::BITWISE_NOT});
+        set(Type::LESS_THAN, {nullptr, compare, Precedence::COMPARISON});
+        set(Type::LESS_EQUAL, {nullptr, compare, Precedence::COMPARISON});
+        set(Type::GREATER_EQUAL, {nullptr, compare, Precedence::COMPARISON});
+        set(Type::GREATER_THAN, {nullptr, compare, Precedence::COMPARISON});
+        set(Type::EQUALS, {nullptr, compare, Precedence::COMPARISON});
+        set(Type::NOT_EQUALS, {nullptr, compare, Precedence::COMPARISON});
+        return rules;
+      }();
+
+  // The expression rule for `type`.
+  static const ParseExpressionRule& ExpressionRule(Token::Type type) {
+    return kExpressionRules[static_cast<size_t>(type)];
+  }
 };
\ No newline at end of file
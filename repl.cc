@@ -5,6 +5,7 @@
 #include <termios.h>
 
 #include "interpreter.h"
+#include "line_index.h"
 #include "version.h"
 
 namespace {
@@ -122,13 +123,10 @@ void ProcessStatement(Interpreter* interpreter,
   for (auto& line : *lines) statement += std::move(line) + "\n";
   lines->clear();
 
-  // Interpret user input.
-  try {
-    interpreter->Interpret(statement);
-  } catch (const std::exception& ex) {
-    std::cerr << "Caught exception:\n\t" << ex.what();
-    throw ex;
-    // TODO(erik): Handle exceptions.
+  // Interpret user input, reporting any errors without giving up.
+  const Status status = interpreter->TryInterpret(statement);
+  if (!status.ok()) {
+    std::cerr << "Error:\n\t" << status.Message(LineIndex(statement)) << "\n";
   }
 }
 }  // namespace
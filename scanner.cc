@@ -0,0 +1,895 @@
+#include "scanner.h"
+
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "string_literal.h"
+#include "token.h"
+#include "unicode.h"
+
+namespace {
+// Character classes. Every byte of source code maps to exactly one class, and
+// DFA transitions are defined on classes rather than on raw bytes, which keeps
+// the transition tables small.
+enum CharClass : uint8_t {
+  kZero,          // 0
+  kOne,           // 1
+  kOctalDigit,    // 2-7
+  kDigit,         // 8, 9
+  kLetterB,       // b, B (binary prefix, hex digit, string prefix)
+  kLetterE,       // e, E (exponent, hex digit)
+  kLetterF,       // f, F (hex digit, string prefix)
+  kLetterO,       // o, O (octal prefix)
+  kLetterX,       // x, X (hex prefix)
+  kHexLetter,     // a, c, d, A, C, D
+  kPrefixLetter,  // r, u, R, U (string prefix)
+  kUnderscore,    // _ (digit separator)
+  kLetter,        // All other letters.
+  kDot,           // .
+  kSign,          // +, -
+  kSingleQuote,   // '
+  kDoubleQuote,   // "
+  kBackslash,     // (backslash)
+  kNewline,       // \n, \r
+  kOther,         // Everything else.
+  kNumCharClasses,
+};
+
+// Mapping from byte to character class.
+constexpr std::array<CharClass, 256> kCharClasses = [] {
+  std::array<CharClass, 256> classes = {};
+  for (int c = 0; c < 256; ++c) classes[c] = kOther;
+  for (int c = 'a'; c <= 'z'; ++c) classes[c] = kLetter;
+  for (int c = 'A'; c <= 'Z'; ++c) classes[c] = kLetter;
+  for (int c = '2'; c <= '7'; ++c) classes[c] = kOctalDigit;
+  classes['8'] = classes['9'] = kDigit;
+  for (char c : {'a', 'c', 'd', 'A', 'C', 'D'}) classes[c] = kHexLetter;
+  for (char c : {'r', 'u', 'R', 'U'}) classes[c] = kPrefixLetter;
+  classes['0'] = kZero;
+  classes['1'] = kOne;
+  classes['b'] = classes['B'] = kLetterB;
+  classes['e'] = classes['E'] = kLetterE;
+  classes['f'] = classes['F'] = kLetterF;
+  classes['o'] = classes['O'] = kLetterO;
+  classes['x'] = classes['X'] = kLetterX;
+  classes['_'] = kUnderscore;
+  classes['.'] = kDot;
+  classes['+'] = classes['-'] = kSign;
+  classes['\''] = kSingleQuote;
+  classes['"'] = kDoubleQuote;
+  classes['\\'] = kBackslash;
+  classes['\n'] = classes['\r'] = kNewline;
+  return classes;
+}();
+
+CharClass ClassOf(char c) {
+  return kCharClasses[static_cast<unsigned char>(c)];
+}
+
+// Word characters are [a-zA-Z0-9_], matching the regex `\w` class.
+bool IsWordClass(CharClass cls) { return cls <= kLetter; }
+
+bool IsAsciiByte(char c) { return static_cast<unsigned char>(c) < 0x80; }
+
+// Groups of character classes used to build transition tables.
+constexpr std::initializer_list<CharClass> kDecimalDigits = {
+    kZero, kOne, kOctalDigit, kDigit};
+constexpr std::initializer_list<CharClass> kBinaryDigits = {kZero, kOne};
+constexpr std::initializer_list<CharClass> kOctalDigits = {kZero, kOne,
+                                                           kOctalDigit};
+constexpr std::initializer_list<CharClass> kHexDigits = {
+    kZero, kOne, kOctalDigit, kDigit, kLetterB, kLetterE, kLetterF,
+    kHexLetter};
+constexpr std::initializer_list<CharClass> kLetters = {
+    kLetterB, kLetterE, kLetterF, kLetterO, kLetterX, kHexLetter,
+    kPrefixLetter, kUnderscore, kLetter};
+constexpr std::initializer_list<CharClass> kWordChars = {
+    kZero, kOne, kOctalDigit, kDigit, kLetterB, kLetterE, kLetterF,
+    kLetterO, kLetterX, kHexLetter, kPrefixLetter, kUnderscore, kLetter};
+constexpr std::initializer_list<CharClass> kStringPrefixes = {
+    kLetterB, kLetterF, kPrefixLetter};
+
+// A deterministic finite automaton over character classes. State 0 is the
+// reject state (no further match possible), and state 1 is the start state.
+constexpr uint8_t kReject = 0;
+constexpr uint8_t kStart = 1;
+constexpr size_t kMaxStates = 32;
+
+struct Dfa {
+  // Transition table, indexed by [state][char class].
+  uint8_t next[kMaxStates][kNumCharClasses] = {};
+
+  // Whether each state is an accepting state, and if so, the type of token
+  // that it accepts.
+  bool accepting[kMaxStates] = {};
+  Token::Type accepted_type[kMaxStates] = {};
+
+  // Whether each state marks matches passing through it, e.g. escapes within
+  // string literals.
+  bool marking[kMaxStates] = {};
+
+  // Whether matches must also end on a word boundary, i.e. a trailing `\b`.
+  bool word_boundary = false;
+
+  // Helpers to populate the transition table.
+  constexpr void Set(uint8_t from, std::initializer_list<CharClass> classes,
+                     uint8_t to) {
+    for (CharClass cls : classes) next[from][cls] = to;
+  }
+  constexpr void SetAll(uint8_t from, uint8_t to) {
+    for (size_t cls = 0; cls < kNumCharClasses; ++cls) next[from][cls] = to;
+  }
+  constexpr void Accept(uint8_t state, Token::Type type) {
+    accepting[state] = true;
+    accepted_type[state] = type;
+  }
+};
+
+// Number literal DFA, deciding between integers and floats. Digits may be
+// separated by single underscores. Equivalent to the regexes (tried in order):
+//   [-+]?\d(_?\d)*\.(\d(_?\d)*)?([eE][-+]?\d(_?\d)*)?\b               (float)
+//   [-+]?(0[xX](_?[0-9A-Fa-f])+|0[oO](_?[0-7])+|0[bB](_?[01])+|
+//         [1-9](_?\d)*|0(_?0)*)\b                                   (integer)
+constexpr Dfa kNumberDfa = [] {
+  enum : uint8_t {
+    kSigned = 2,
+    kLeadingZero,
+    kZeros,
+    kZerosSeparator,
+    kZeroPadded,
+    kZeroPaddedSeparator,
+    kDecimal,
+    kDecimalSeparator,
+    kHexPrefix,
+    kHex,
+    kHexSeparator,
+    kOctPrefix,
+    kOct,
+    kOctSeparator,
+    kBinPrefix,
+    kBin,
+    kBinSeparator,
+    kPoint,
+    kFraction,
+    kFractionSeparator,
+    kExpMark,
+    kExpSign,
+    kExponent,
+    kExponentSeparator,
+  };
+  static_assert(kExponentSeparator < kMaxStates);
+
+  Dfa dfa;
+  dfa.Set(kStart, {kSign}, kSigned);
+  dfa.Set(kStart, {kZero}, kLeadingZero);
+  dfa.Set(kStart, {kOne, kOctalDigit, kDigit}, kDecimal);
+  dfa.Set(kSigned, {kZero}, kLeadingZero);
+  dfa.Set(kSigned, {kOne, kOctalDigit, kDigit}, kDecimal);
+
+  // Digits, each optionally preceded by a single underscore, e.g. `1_000`.
+  // Underscores are rejected anywhere else, e.g. `1__000` or `1_`.
+  auto digits = [&](uint8_t from, std::initializer_list<CharClass> classes,
+                    uint8_t to, uint8_t separator) {
+    dfa.Set(from, classes, to);
+    dfa.Set(from, {kUnderscore}, separator);
+    dfa.Set(to, classes, to);
+    dfa.Set(to, {kUnderscore}, separator);
+    dfa.Set(separator, classes, to);
+  };
+
+  // Integers. A leading zero may only be followed by a hex, octal or binary
+  // prefix, by more zeros, or else by a fraction (e.g. '00' and '0_0' are
+  // integers, '0123' is not, but '0123.4' is a float).
+  dfa.Set(kLeadingZero, {kLetterX}, kHexPrefix);
+  dfa.Set(kLeadingZero, {kLetterO}, kOctPrefix);
+  dfa.Set(kLeadingZero, {kLetterB}, kBinPrefix);
+  digits(kLeadingZero, {kZero}, kZeros, kZerosSeparator);
+  dfa.Set(kLeadingZero, {kOne, kOctalDigit, kDigit}, kZeroPadded);
+  dfa.Set(kZeros, {kOne, kOctalDigit, kDigit}, kZeroPadded);
+  dfa.Set(kZerosSeparator, {kOne, kOctalDigit, kDigit}, kZeroPadded);
+  digits(kZeroPadded, kDecimalDigits, kZeroPadded, kZeroPaddedSeparator);
+  digits(kDecimal, kDecimalDigits, kDecimal, kDecimalSeparator);
+  digits(kHexPrefix, kHexDigits, kHex, kHexSeparator);
+  digits(kOctPrefix, kOctalDigits, kOct, kOctSeparator);
+  digits(kBinPrefix, kBinaryDigits, kBin, kBinSeparator);
+
+  // Floats.
+  dfa.Set(kLeadingZero, {kDot}, kPoint);
+  dfa.Set(kZeros, {kDot}, kPoint);
+  dfa.Set(kZeroPadded, {kDot}, kPoint);
+  dfa.Set(kDecimal, {kDot}, kPoint);
+  dfa.Set(kPoint, kDecimalDigits, kFraction);
+  digits(kFraction, kDecimalDigits, kFraction, kFractionSeparator);
+  dfa.Set(kPoint, {kLetterE}, kExpMark);
+  dfa.Set(kFraction, {kLetterE}, kExpMark);
+  dfa.Set(kExpMark, {kSign}, kExpSign);
+  dfa.Set(kExpMark, kDecimalDigits, kExponent);
+  dfa.Set(kExpSign, kDecimalDigits, kExponent);
+  digits(kExponent, kDecimalDigits, kExponent, kExponentSeparator);
+
+  for (uint8_t state : {kLeadingZero, kZeros, kDecimal, kHex, kOct, kBin}) {
+    dfa.Accept(state, Token::Type::INTEGER);
+  }
+  dfa.Accept(kPoint, Token::Type::FLOAT);
+  dfa.Accept(kFraction, Token::Type::FLOAT);
+  dfa.Accept(kExponent, Token::Type::FLOAT);
+  dfa.word_boundary = true;
+  return dfa;
+}();
+
+// String literal DFA. Strings have an optional single character prefix
+// (r, u, b, f), and are quoted by one of ', ", ''', or """. Single quoted
+// strings may contain escapes (a backslash followed by any character other
+// than a newline). Triple quoted strings end at the first unescaped closing
+// triple quote.
+constexpr Dfa kStringDfa = [] {
+  enum : uint8_t {
+    kPrefix = 2,
+    // Single quoted strings, e.g. 'text'.
+    kSingleOpen,
+    kSingleEmpty,
+    kSingleBody,
+    kSingleEscape,
+    kSingleClose,
+    kTripleSingleBody,
+    kTripleSingleEscape,
+    kTripleSingleEnd1,
+    kTripleSingleEnd2,
+    kTripleSingleClose,
+    // Double quoted strings, e.g. "text".
+    kDoubleOpen,
+    kDoubleEmpty,
+    kDoubleBody,
+    kDoubleEscape,
+    kDoubleClose,
+    kTripleDoubleBody,
+    kTripleDoubleEscape,
+    kTripleDoubleEnd1,
+    kTripleDoubleEnd2,
+    kTripleDoubleClose,
+  };
+  static_assert(kTripleDoubleClose < kMaxStates);
+
+  Dfa dfa;
+  dfa.Set(kStart, kStringPrefixes, kPrefix);
+  dfa.Set(kStart, {kSingleQuote}, kSingleOpen);
+  dfa.Set(kStart, {kDoubleQuote}, kDoubleOpen);
+  dfa.Set(kPrefix, {kSingleQuote}, kSingleOpen);
+  dfa.Set(kPrefix, {kDoubleQuote}, kDoubleOpen);
+
+  // Transitions are identical for both quote types, modulo the quote itself.
+  struct Quoted {
+    CharClass quote;
+    uint8_t open, empty, body, escape, close;
+    uint8_t triple_body, triple_escape, triple_end1, triple_end2, triple_close;
+  };
+  for (const Quoted& q :
+       {Quoted{kSingleQuote, kSingleOpen, kSingleEmpty, kSingleBody,
+               kSingleEscape, kSingleClose, kTripleSingleBody,
+               kTripleSingleEscape, kTripleSingleEnd1, kTripleSingleEnd2,
+               kTripleSingleClose},
+        Quoted{kDoubleQuote, kDoubleOpen, kDoubleEmpty, kDoubleBody,
+               kDoubleEscape, kDoubleClose, kTripleDoubleBody,
+               kTripleDoubleEscape, kTripleDoubleEnd1, kTripleDoubleEnd2,
+               kTripleDoubleClose}}) {
+    // Opening quote. Two quotes in a row is either an empty string, or the
+    // beginning of a triple quoted string.
+    dfa.SetAll(q.open, q.body);
+    dfa.Set(q.open, {q.quote}, q.empty);
+    dfa.Set(q.open, {kBackslash}, q.escape);
+    dfa.Set(q.empty, {q.quote}, q.triple_body);
+
+    // Single quoted body.
+    dfa.SetAll(q.body, q.body);
+    dfa.Set(q.body, {q.quote}, q.close);
+    dfa.Set(q.body, {kBackslash}, q.escape);
+    dfa.SetAll(q.escape, q.body);
+    dfa.Set(q.escape, {kNewline}, kReject);
+
+    // Triple quoted body.
+    for (uint8_t state : {q.triple_body, q.triple_end1, q.triple_end2}) {
+      dfa.SetAll(state, q.triple_body);
+      dfa.Set(state, {kBackslash}, q.triple_escape);
+    }
+    dfa.SetAll(q.triple_escape, q.triple_body);
+    dfa.Set(q.triple_body, {q.quote}, q.triple_end1);
+    dfa.Set(q.triple_end1, {q.quote}, q.triple_end2);
+    dfa.Set(q.triple_end2, {q.quote}, q.triple_close);
+
+    dfa.marking[q.escape] = true;
+    dfa.marking[q.triple_escape] = true;
+    dfa.Accept(q.empty, Token::Type::STRING);
+    dfa.Accept(q.close, Token::Type::STRING);
+    dfa.Accept(q.triple_close, Token::Type::STRING);
+  }
+  return dfa;
+}();
+
+// Identifier DFA, equivalent to the regex:
+//   [a-zA-Z_][a-zA-Z0-9_]*
+constexpr Dfa kIdentifierDfa = [] {
+  enum : uint8_t { kIdentifier = 2 };
+  Dfa dfa;
+  dfa.Set(kStart, kLetters, kIdentifier);
+  dfa.Set(kIdentifier, kWordChars, kIdentifier);
+  dfa.Accept(kIdentifier, Token::Type::IDENTIFIER);
+  return dfa;
+}();
+
+// Whether a token type is a single word keyword. Multi-word keywords (e.g.
+// `is not`) are recognized by the lexer, as a sequence of single word
+// keywords.
+constexpr bool IsSingleWordKeyword(size_t type) {
+  return type >= Token::kKeywordBegin && type <= Token::kKeywordEnd &&
+         kTokenStrings[type].find(' ') == std::string_view::npos;
+}
+
+// Perfect hash over the single word keywords: no two keywords share a slot.
+// The hash only reads the first character, the last character, and the length
+// of a word, so hashing an identifier is O(1) regardless of its length.
+constexpr size_t kNumKeywordSlots = 128u;
+constexpr size_t KeywordHash(std::string_view word) {
+  return (static_cast<unsigned char>(word.front()) +
+          static_cast<unsigned char>(word.back()) + 19u * word.size()) %
+         kNumKeywordSlots;
+}
+
+// Mapping from hash slot to keyword token type + 1, or 0 if the slot is empty.
+constexpr std::array<uint8_t, kNumKeywordSlots> kKeywordSlots = [] {
+  std::array<uint8_t, kNumKeywordSlots> slots = {};
+  for (size_t type = 0; type < Token::kNumTypes; ++type) {
+    if (!IsSingleWordKeyword(type)) continue;
+    slots[KeywordHash(kTokenStrings[type])] = static_cast<uint8_t>(type + 1);
+  }
+  return slots;
+}();
+
+// Verify at compile time that the keyword hash is perfect, i.e. that every
+// keyword can be found in its own slot.
+constexpr bool IsPerfectKeywordHash() {
+  for (size_t type = 0; type < Token::kNumTypes; ++type) {
+    if (!IsSingleWordKeyword(type)) continue;
+    if (kKeywordSlots[KeywordHash(kTokenStrings[type])] != type + 1) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(IsPerfectKeywordHash(), "Keyword hash has collisions");
+
+// Operators and delimiters, grouped by their first character. Each group is
+// ordered longest first, so the first candidate that matches is the maximal
+// munch (e.g. '**=' rather than '**' or '*'). No operator or delimiter is
+// longer than three characters, so a match reads at most two characters of
+// lookahead past the first.
+constexpr size_t kMaxOperatorLength = 3u;
+constexpr size_t kMaxOperatorCandidates = 4u;
+struct OperatorCandidates {
+  uint8_t size = 0u;
+  Token::Type types[kMaxOperatorCandidates] = {};
+};
+
+constexpr bool IsOperatorOrDelimiter(size_t type) {
+  return (type >= Token::kOperatorBegin && type <= Token::kOperatorEnd) ||
+         (type >= Token::kDelimiterBegin && type <= Token::kDelimiterEnd);
+}
+
+constexpr std::array<OperatorCandidates, 256> kOperatorCandidates = [] {
+  std::array<OperatorCandidates, 256> table = {};
+  for (size_t type = 0; type < Token::kNumTypes; ++type) {
+    if (!IsOperatorOrDelimiter(type)) continue;
+    const std::string_view string = kTokenStrings[type];
+    OperatorCandidates& candidates =
+        table[static_cast<unsigned char>(string.front())];
+
+    // Insert, keeping the candidates sorted by decreasing length.
+    size_t i = candidates.size++;
+    for (; i > 0; --i) {
+      const Token::Type prev = candidates.types[i - 1];
+      if (kTokenStrings[static_cast<size_t>(prev)].size() >= string.size()) {
+        break;
+      }
+      candidates.types[i] = prev;
+    }
+    candidates.types[i] = static_cast<Token::Type>(type);
+  }
+  return table;
+}();
+
+// Verify at compile time that the operator table is within bounds.
+constexpr bool IsValidOperatorTable() {
+  for (size_t type = 0; type < Token::kNumTypes; ++type) {
+    if (IsOperatorOrDelimiter(type) &&
+        kTokenStrings[type].size() > kMaxOperatorLength) {
+      return false;
+    }
+  }
+  for (const OperatorCandidates& candidates : kOperatorCandidates) {
+    if (candidates.size > kMaxOperatorCandidates) return false;
+  }
+  return true;
+}
+static_assert(IsValidOperatorTable(), "Operator table out of bounds");
+
+// Bytes matched by the bulk scanners.
+constexpr char kBlanks[] = {' ', '\t', '\r', '\v', '\f'};
+constexpr char kIndentation[] = {' ', '\t'};
+constexpr char kNewlines[] = {'\n'};
+
+// Bitmask with bit `i` set iff the `i`th byte of the next block of bytes at
+// `data` is one of `chars` (BlockMask), or is not ASCII (NonAsciiMask). Blocks
+// are 32 bytes with AVX2, and 16 bytes with SSE2.
+#if defined(__AVX2__)
+constexpr size_t kBlockSize = 32u;
+
+template <size_t N>
+uint32_t BlockMask(const char* data, const char (&chars)[N]) {
+  const __m256i block =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  __m256i matches = _mm256_setzero_si256();
+  for (char c : chars) {
+    matches = _mm256_or_si256(matches,
+                              _mm256_cmpeq_epi8(block, _mm256_set1_epi8(c)));
+  }
+  return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+}
+
+uint32_t NonAsciiMask(const char* data) {
+  const __m256i block =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  return static_cast<uint32_t>(_mm256_movemask_epi8(block));
+}
+#elif defined(__SSE2__)
+constexpr size_t kBlockSize = 16u;
+
+template <size_t N>
+uint32_t BlockMask(const char* data, const char (&chars)[N]) {
+  const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  __m128i matches = _mm_setzero_si128();
+  for (char c : chars) {
+    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(c)));
+  }
+  return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+}
+
+uint32_t NonAsciiMask(const char* data) {
+  const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  return static_cast<uint32_t>(_mm_movemask_epi8(block));
+}
+#endif
+
+template <size_t N>
+bool IsOneOf(char c, const char (&chars)[N]) {
+  for (char other : chars) {
+    if (c == other) return true;
+  }
+  return false;
+}
+
+// Length of the prefix of `source` whose bytes are all in `chars` if `in` is
+// true, or all not in `chars` otherwise.
+template <size_t N>
+size_t Span(std::string_view source, const char (&chars)[N], bool in) {
+  size_t idx = 0u;
+#if defined(__AVX2__) || defined(__SSE2__)
+  constexpr uint32_t kFullMask =
+      static_cast<uint32_t>((uint64_t{1} << kBlockSize) - 1);
+  for (; idx + kBlockSize <= source.size(); idx += kBlockSize) {
+    uint32_t mask = BlockMask(source.data() + idx, chars);
+    if (in) mask = ~mask & kFullMask;
+    if (mask != 0) return idx + __builtin_ctz(mask);
+  }
+#endif
+  while (idx < source.size() && IsOneOf(source[idx], chars) == in) ++idx;
+  return idx;
+}
+
+// Length of the prefix of `source` whose bytes are all ASCII.
+size_t SpanAscii(std::string_view source) {
+  size_t idx = 0u;
+#if defined(__AVX2__) || defined(__SSE2__)
+  for (; idx + kBlockSize <= source.size(); idx += kBlockSize) {
+    const uint32_t mask = NonAsciiMask(source.data() + idx);
+    if (mask != 0) return idx + __builtin_ctz(mask);
+  }
+#endif
+  while (idx < source.size() && IsAsciiByte(source[idx])) ++idx;
+  return idx;
+}
+
+// Whether there is a word boundary between `source[idx - 1]` and
+// `source[idx]`, treating the end of `source` as a non-word character.
+bool IsWordBoundary(std::string_view source, size_t idx) {
+  const bool prev = IsWordClass(ClassOf(source[idx - 1]));
+  const bool next = idx < source.size() && IsWordClass(ClassOf(source[idx]));
+  return prev != next;
+}
+
+// Run the DFA over `source`, returning the length of the longest accepted
+// prefix (or 0 if no prefix is accepted). On a match, populates `type` with
+// the type of token accepted, and `marked` (if not null) with whether the
+// match passed through a marking state.
+size_t Run(const Dfa& dfa, std::string_view source, Token::Type* type,
+           bool* marked = nullptr) {
+  size_t match = 0u;
+  uint8_t state = kStart;
+  bool marking = false;
+  for (size_t idx = 0u; idx < source.size();) {
+    state = dfa.next[state][ClassOf(source[idx])];
+    if (state == kReject) break;
+    ++idx;
+    marking |= dfa.marking[state];
+    if (dfa.accepting[state] &&
+        (!dfa.word_boundary || IsWordBoundary(source, idx))) {
+      match = idx;
+      *type = dfa.accepted_type[state];
+      if (marked) *marked = marking;
+    }
+  }
+  return match;
+}
+
+// Whether the DFA rejects `source` before reaching its end, i.e. whether more
+// source code could not change the match.
+bool Rejects(const Dfa& dfa, std::string_view source) {
+  uint8_t state = kStart;
+  for (char c : source) {
+    state = dfa.next[state][ClassOf(c)];
+    if (state == kReject) return true;
+  }
+  return false;
+}
+
+// Match an identifier. ASCII identifiers are matched by the identifier DFA
+// alone, and identifiers containing other characters are matched one code
+// point at a time from the first non-ASCII byte. Populates `truncated` with
+// whether the identifier might extend past the end of `source`.
+size_t MatchIdentifier(std::string_view source, bool* truncated) {
+  Token::Type type;
+  size_t idx = Run(kIdentifierDfa, source, &type);
+  if (idx == source.size() || IsAsciiByte(source[idx])) {
+    *truncated = (idx == source.size());
+    return idx;
+  }
+
+  *truncated = false;
+  while (idx < source.size()) {
+    if (IsAsciiByte(source[idx])) {
+      if (!IsWordClass(ClassOf(source[idx]))) return idx;
+      ++idx;
+      continue;
+    }
+    char32_t c;
+    const size_t length = DecodeUtf8(source.substr(idx), &c);
+    if (length == 0) {
+      // The rest of the code point may follow `source`.
+      *truncated = source.size() - idx < 4u;
+      return idx;
+    }
+    if (!(idx == 0 ? IsXidStart(c) : IsXidContinue(c))) return idx;
+    idx += length;
+  }
+  *truncated = true;
+  return idx;
+}
+
+// Strip the sign from a number literal, returning whether it was negative.
+bool StripSign(std::string_view* literal) {
+  if (literal->empty() ||
+      (literal->front() != '-' && literal->front() != '+')) {
+    return false;
+  }
+  const bool negative = literal->front() == '-';
+  literal->remove_prefix(1);
+  return negative;
+}
+
+// Strip underscores between digits, e.g. `1_000` to `1000`. Uses `storage` for
+// the stripped literal, only if there are any underscores.
+std::string_view StripUnderscores(std::string_view literal,
+                                  std::string* storage) {
+  if (literal.find('_') == std::string_view::npos) return literal;
+  for (char c : literal) {
+    if (c != '_') storage->push_back(c);
+  }
+  return *storage;
+}
+
+std::runtime_error InvalidLiteral(std::string_view literal) {
+  return std::runtime_error("Encountered invalid number literal: " +
+                            std::string(literal));
+}
+
+// Convert the digits of an integer in the given base, which are too large for
+// a uint64_t, to decimal digits. Digits are accumulated in base 10^9 limbs,
+// least significant first.
+std::string ToDecimalDigits(std::string_view digits, int base) {
+  constexpr uint32_t kLimbBase = 1000000000u;
+  std::vector<uint32_t> limbs = {0u};
+  for (char c : digits) {
+    uint32_t digit;
+    std::from_chars(&c, &c + 1, digit, base);
+    uint64_t carry = digit;
+    for (uint32_t& limb : limbs) {
+      const uint64_t value = uint64_t{limb} * base + carry;
+      limb = value % kLimbBase;
+      carry = value / kLimbBase;
+    }
+    if (carry > 0) limbs.push_back(carry);
+  }
+
+  std::string decimal = std::to_string(limbs.back());
+  for (size_t i = limbs.size() - 1; i-- > 0;) {
+    const std::string limb = std::to_string(limbs[i]);
+    decimal.append(9 - limb.size(), '0');
+    decimal.append(limb);
+  }
+  return decimal;
+}
+}  // namespace
+
+size_t ScanLiteral(std::string_view source, Token::Type* type) {
+  uint8_t flags;
+  return ScanLiteral(source, type, &flags);
+}
+
+size_t ScanLiteral(std::string_view source, Token::Type* type,
+                   uint8_t* flags) {
+  *flags = 0u;
+  if (source.empty()) return 0u;
+
+  // Dispatch on the first character. Quotes and string prefixes begin string
+  // literals, while digits and signs begin number literals.
+  switch (ClassOf(source[0])) {
+    case kSingleQuote:
+    case kDoubleQuote:
+    case kLetterB:
+    case kLetterF:
+    case kPrefixLetter: {
+      // Escapes are found along the way, and a prefix is a single character.
+      bool escapes = false;
+      const size_t length = Run(kStringDfa, source, type, &escapes);
+      if (length == 0) return 0u;
+      *flags = StringLiteral::ScanFlags(source.substr(0, 1));
+      if (escapes) *flags |= StringLiteral::kEscapes;
+      return length;
+    }
+    case kZero:
+    case kOne:
+    case kOctalDigit:
+    case kDigit:
+    case kSign:
+      return Run(kNumberDfa, source, type);
+    default:
+      return 0u;
+  }
+}
+
+size_t ScanStringLiteral(std::string_view source) {
+  Token::Type type;
+  return Run(kStringDfa, source, &type);
+}
+
+size_t ScanNumberLiteral(std::string_view source, Token::Type* type) {
+  return Run(kNumberDfa, source, type);
+}
+
+size_t ScanIdentifier(std::string_view source) {
+  bool truncated;
+  return MatchIdentifier(source, &truncated);
+}
+
+bool LookupKeyword(std::string_view word, Token::Type* type) {
+  if (word.empty()) return false;
+  const uint8_t slot = kKeywordSlots[KeywordHash(word)];
+  if (slot == 0 || kTokenStrings[slot - 1] != word) return false;
+  *type = static_cast<Token::Type>(slot - 1);
+  return true;
+}
+
+size_t ScanOperatorOrDelimiter(std::string_view source, Token::Type* type) {
+  if (source.empty()) return 0u;
+
+  // Dispatch on the first character.
+  const OperatorCandidates& candidates =
+      kOperatorCandidates[static_cast<unsigned char>(source[0])];
+  for (size_t i = 0; i < candidates.size; ++i) {
+    const std::string_view string =
+        kTokenStrings[static_cast<size_t>(candidates.types[i])];
+    if (source.substr(0, string.size()) == string) {
+      *type = candidates.types[i];
+      return string.size();
+    }
+  }
+  return 0u;
+}
+
+bool IsTokenTruncated(std::string_view source) {
+  if (source.size() < kMaxOperatorLength || !Rejects(kStringDfa, source) ||
+      !Rejects(kNumberDfa, source)) {
+    return true;
+  }
+  bool truncated;
+  MatchIdentifier(source, &truncated);
+  return truncated;
+}
+
+bool IsStringLiteralTruncated(std::string_view source) {
+  return !Rejects(kStringDfa, source);
+}
+
+size_t ScanBlanks(std::string_view source) {
+  return Span(source, kBlanks, true);
+}
+
+size_t ScanNewlines(std::string_view source) {
+  return Span(source, kNewlines, true);
+}
+
+size_t ScanIndentation(std::string_view source, size_t* tabs) {
+  const size_t length = Span(source, kIndentation, true);
+  *tabs = 0u;
+  for (char c : source.substr(0, length)) *tabs += (c == '\t');
+  return length;
+}
+
+size_t FindNewline(std::string_view source) {
+  return Span(source, kNewlines, false);
+}
+
+void FindLineStarts(std::string_view source,
+                    std::vector<uint32_t>* line_starts) {
+  size_t idx = 0u;
+#if defined(__AVX2__) || defined(__SSE2__)
+  for (; idx + kBlockSize <= source.size(); idx += kBlockSize) {
+    for (uint32_t mask = BlockMask(source.data() + idx, kNewlines); mask != 0;
+         mask &= mask - 1) {
+      line_starts->push_back(
+          static_cast<uint32_t>(idx + __builtin_ctz(mask) + 1));
+    }
+  }
+#endif
+  for (; idx < source.size(); ++idx) {
+    if (IsOneOf(source[idx], kNewlines)) {
+      line_starts->push_back(static_cast<uint32_t>(idx + 1));
+    }
+  }
+}
+
+size_t ScanValidUtf8(std::string_view source) {
+  size_t idx = 0u;
+  while (idx < source.size()) {
+    idx += SpanAscii(source.substr(idx));
+    while (idx < source.size() && !IsAsciiByte(source[idx])) {
+      char32_t c;
+      const size_t length = DecodeUtf8(source.substr(idx), &c);
+      if (length == 0) return idx;
+      idx += length;
+    }
+  }
+  return idx;
+}
+
+bool TryConvertIntegerLiteral(std::string_view literal, int64_t* value) {
+  const bool negative = StripSign(&literal);
+  int base = 10;
+  if (literal.size() > 2 && literal[0] == '0') {
+    switch (literal[1]) {
+      case 'x':
+      case 'X':
+        base = 16;
+        break;
+      case 'o':
+      case 'O':
+        base = 8;
+        break;
+      case 'b':
+      case 'B':
+        base = 2;
+        break;
+    }
+    if (base != 10) literal.remove_prefix(2);
+  }
+  if (literal.empty()) return false;
+
+  // Accumulate digits, skipping underscores, as long as the magnitude fits. It
+  // may be up to 2^63 - 1 when positive, and up to 2^63 when negative.
+  const uint64_t max_magnitude =
+      uint64_t{std::numeric_limits<int64_t>::max()} + negative;
+  uint64_t magnitude = 0u;
+  for (char c : literal) {
+    if (c == '_') continue;
+    const int lower = std::tolower(static_cast<unsigned char>(c));
+    const int digit = std::isdigit(lower) ? lower - '0'
+                      : std::isalpha(lower) ? lower - 'a' + 10
+                                            : base;
+    if (digit >= base || magnitude > (max_magnitude - digit) / base) {
+      return false;
+    }
+    magnitude = magnitude * base + digit;
+  }
+  *value = negative ? static_cast<int64_t>(0u - magnitude)
+                    : static_cast<int64_t>(magnitude);
+  return true;
+}
+
+std::variant<int64_t, BigInt> ConvertIntegerLiteral(std::string_view literal) {
+  int64_t value;
+  if (TryConvertIntegerLiteral(literal, &value)) return value;
+
+  const std::string_view original = literal;
+  const bool negative = StripSign(&literal);
+  std::string storage;
+  literal = StripUnderscores(literal, &storage);
+
+  int base = 10;
+  if (literal.size() > 2 && literal[0] == '0') {
+    switch (literal[1]) {
+      case 'x':
+      case 'X':
+        base = 16;
+        break;
+      case 'o':
+      case 'O':
+        base = 8;
+        break;
+      case 'b':
+      case 'B':
+        base = 2;
+        break;
+    }
+    if (base != 10) literal.remove_prefix(2);
+  }
+
+  uint64_t magnitude;
+  const char* end = literal.data() + literal.size();
+  const auto [ptr, error] =
+      std::from_chars(literal.data(), end, magnitude, base);
+  if (ptr != end || (error != std::errc() &&
+                     error != std::errc::result_out_of_range)) {
+    throw InvalidLiteral(original);
+  }
+
+  // Magnitudes up to 2^63 - 1 fit when positive, and up to 2^63 when negative.
+  constexpr uint64_t kMaxMagnitude = std::numeric_limits<int64_t>::max();
+  if (error == std::errc() && magnitude <= kMaxMagnitude + negative) {
+    return negative ? static_cast<int64_t>(0u - magnitude)
+                    : static_cast<int64_t>(magnitude);
+  }
+  return BigInt{(negative ? "-" : "") + ToDecimalDigits(literal, base)};
+}
+
+double ConvertFloatLiteral(std::string_view literal) {
+  const std::string_view original = literal;
+  const bool negative = StripSign(&literal);
+  std::string storage;
+  literal = StripUnderscores(literal, &storage);
+
+  double value;
+  const char* end = literal.data() + literal.size();
+  const auto [ptr, error] = std::from_chars(literal.data(), end, value);
+  if (ptr != end || !std::isdigit(static_cast<unsigned char>(literal[0]))) {
+    throw InvalidLiteral(original);
+  }
+
+  // Values too large or too small to represent become infinity or zero, as in
+  // python. This is rare enough to leave to strtod().
+  if (error == std::errc::result_out_of_range) {
+    value = std::strtod(std::string(literal).c_str(), nullptr);
+  }
+  return negative ? -value : value;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "token.h"
+#include "types.h"
+
+// Table-driven scanners for the lexical constituents of python source. Each
+// scanner attempts a match at the very beginning of `source`, and returns the
+// length of the match, or 0 if there was no match. Scanners never allocate.
+//
+// Example:
+//
+//     Token::Type type;
+//     ScanLiteral("0x1A + 2", &type);  // Returns 4, type is INTEGER.
+//     ScanLiteral("3.14 + 2", &type);  // Returns 4, type is FLOAT.
+//     ScanIdentifier("abc123 = 5");    // Returns 6.
+//     ScanIdentifier("\xCF\x80 = 3.14");  // Returns 2 (UTF-8 for pi).
+//     ScanStringLiteral("'oops");      // Returns 0 (unterminated).
+//     LookupKeyword("while", &type);   // Returns true, type is WHILE.
+//     ScanOperatorOrDelimiter("**=", &type);  // Returns 3, type is
+//                                             // POWER_ASSIGN.
+//
+// Whitespace is scanned in bulk, 16 or 32 bytes at a time using SSE2 or AVX2
+// when compiled with support for either, and one byte at a time otherwise.
+//
+//     size_t tabs;
+//     ScanBlanks(" \t x = 1");         // Returns 3.
+//     ScanIndentation("\t  pass", &tabs);  // Returns 3, tabs is 1.
+//     FindNewline("x = 1\ny = 2");      // Returns 5.
+//
+//     std::vector<uint32_t> line_starts;
+//     FindLineStarts("x = 1\ny = 2\n", &line_starts);  // Appends 6, 12.
+//
+
+// Match any literal, dispatching on the first character of `source` to either
+// the string or the number scanner. Populates `type` on a match.
+size_t ScanLiteral(std::string_view source, Token::Type* type);
+
+// As above, but also populates `flags` with the flags of a string literal (see
+// StringLiteral::Flags), found while scanning it, or 0 for other literals.
+size_t ScanLiteral(std::string_view source, Token::Type* type,
+                   uint8_t* flags);
+
+// Match a string literal, e.g. 'text', "text", '''text''', r'text\\n'.
+size_t ScanStringLiteral(std::string_view source);
+
+// Match an integer or float literal, e.g. 42, -123, 0x1A, 0o17, 0b1101, 1_000,
+// 3.14159, 2.5e-3. Populates `type` with either INTEGER or FLOAT on a match.
+size_t ScanNumberLiteral(std::string_view source, Token::Type* type);
+
+// Convert an integer literal, e.g. 42, -123, 0x1A, 0b1101, 0o17 or 1_000, to
+// its value. Integers too large for int64_t are converted to a BigInt. Throws
+// if `literal` is not an integer literal.
+std::variant<int64_t, BigInt> ConvertIntegerLiteral(std::string_view literal);
+
+// Convert an integer literal to its value as above, without allocating.
+// Returns false if `literal` is too large for int64_t, or is not an integer
+// literal.
+bool TryConvertIntegerLiteral(std::string_view literal, int64_t* value);
+
+// Convert a float literal, e.g. 3.14159, -0.12345, 2.5e-3 or 1_000.5, to its
+// value. Throws if `literal` is not a float literal.
+double ConvertFloatLiteral(std::string_view literal);
+
+// Match an identifier, e.g. 'abc123', '_abc123', 'abc_123', or any other
+// UTF-8 encoded identifier that begins with an XID_Start character (or '_'),
+// and continues with XID_Continue characters. ASCII identifiers are matched
+// as quickly as if no other characters were allowed.
+size_t ScanIdentifier(std::string_view source);
+
+// Classify a complete word as a keyword, using a compile time perfect hash
+// over the keyword set. Returns whether `word` is a single word keyword (e.g.
+// `not`, but not `not in`), populating `type` if so.
+bool LookupKeyword(std::string_view word, Token::Type* type);
+
+// Match the longest operator or delimiter, e.g. '**=' rather than '**' or '*'.
+// Populates `type` on a match.
+size_t ScanOperatorOrDelimiter(std::string_view source, Token::Type* type);
+
+// Whether a token beginning at the start of `source` might extend past its
+// end, i.e. whether any scanner reaches the end of `source` before deciding on
+// a match. Lexers reading source code in chunks read more before scanning when
+// this is true.
+bool IsTokenTruncated(std::string_view source);
+
+// As above, but only for the string literal scanner, which unlike the others
+// may read past the end of a line, e.g. for an unterminated quote. Lexers that
+// lex part of some source code again must restart before any string literal
+// scan that read up to that part.
+bool IsStringLiteralTruncated(std::string_view source);
+
+// Match a run of blanks, i.e. spaces, tabs, carriage returns, vertical tabs
+// and form feeds. None of these ever begin a token.
+size_t ScanBlanks(std::string_view source);
+
+// Match a run of newlines.
+size_t ScanNewlines(std::string_view source);
+
+// Match a run of indentation, i.e. spaces and tabs. Populates `tabs` with the
+// number of tabs within the run.
+size_t ScanIndentation(std::string_view source, size_t* tabs);
+
+// Find the position of the first newline in `source`, or `source.size()` if
+// there is none.
+size_t FindNewline(std::string_view source);
+
+// Append the position following each newline in `source`, i.e. the start of
+// each line but the first, to `line_starts`. Unlike the scanners, this visits
+// all of `source`, finding every newline within a block at once.
+void FindLineStarts(std::string_view source,
+                    std::vector<uint32_t>* line_starts);
+
+// Match the longest prefix of `source` that is valid UTF-8. Runs of ASCII are
+// skipped in bulk, like whitespace, and only other characters are decoded.
+size_t ScanValidUtf8(std::string_view source);
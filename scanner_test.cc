@@ -0,0 +1,429 @@
+#include "scanner.h"
+
+#include <cstdint>
+#include <limits>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+// Reference regexes, which the lexer used prior to the DFA scanners, extended
+// with octal integers and underscores between digits. The scanners must
+// produce identical matches.
+const std::regex kStringLiteralRegex(
+    "^(r|u|R|U|b|B|f|F)?((?:'''[^']*'''|\"\"\"[^\"]*\"\"\"|'[^'\\\\]*(\\\\.[^'"
+    "\\\\]*)*'|\"[^\"\\\\]*(\\\\.[^\"\\\\]*)*\"))");
+const std::regex kIntLiteralRegex(
+    "^([-+]?\\b(0[xX](_?[0-9A-Fa-f])+|0[oO](_?[0-7])+|0[bB](_?[01])+|"
+    "[1-9](_?[0-9])*|0(_?0)*)\\b)");
+const std::regex kFloatLiteralRegex(
+    "^([-+]?\\b\\d(_?\\d)*\\.(\\d(_?\\d)*)?(?:[eE][-+]?\\d(_?\\d)*)?\\b)");
+const std::regex kIdentifierRegex("^(\\b[a-zA-Z_][a-zA-Z0-9_]*\\b)");
+
+size_t RegexMatchLength(const std::string& source, size_t idx,
+                        const std::regex& regex) {
+  std::smatch match;
+  if (!std::regex_search(source.begin() + idx, source.end(), match, regex)) {
+    return 0u;
+  }
+  return match[0].length();
+}
+
+// Check that each scanner agrees with its reference regex at every position
+// within `source`.
+void ExpectParity(const std::string& source) {
+  for (size_t idx = 0; idx < source.size(); ++idx) {
+    const std::string_view view = std::string_view(source).substr(idx);
+    SCOPED_TRACE("source = '" + source + "', idx = " + std::to_string(idx));
+    EXPECT_EQ(ScanStringLiteral(view),
+              RegexMatchLength(source, idx, kStringLiteralRegex));
+
+    // Numbers are matched as floats first, then as integers.
+    Token::Type type;
+    const size_t number_length = ScanNumberLiteral(view, &type);
+    if (size_t length = RegexMatchLength(source, idx, kFloatLiteralRegex)) {
+      EXPECT_EQ(number_length, length);
+      EXPECT_EQ(type, Token::Type::FLOAT);
+    } else if (length = RegexMatchLength(source, idx, kIntLiteralRegex);
+               length > 0) {
+      EXPECT_EQ(number_length, length);
+      EXPECT_EQ(type, Token::Type::INTEGER);
+    } else {
+      EXPECT_EQ(number_length, 0u);
+    }
+    EXPECT_EQ(ScanIdentifier(view),
+              RegexMatchLength(source, idx, kIdentifierRegex));
+  }
+}
+}  // namespace
+
+TEST(Scanner, LexerTestParity) {
+  // Sources from lexer_test.cc.
+  const std::vector<std::string> sources = {
+      R"(result = 3 + 5 * 2)",
+      R"(
+def add(a, b):
+    return a + b
+)",
+      R"(
+message = "Hello, World!"
+my_list = [1, 2, 3]
+)",
+      R"(
+if x > 10:
+    print("x is greater than 10")
+else:
+    print("x is less than or equal to 10")
+)",
+      R"(
+class Person:
+    def __init__(self, name):
+        self.name = name
+
+    def greet(self):
+        print(f"Hello, my name is {self.name}")
+
+p = Person("Alice")
+p.greet()
+)",
+      R"(
+class CustomException(Exception):
+    pass
+
+try:
+    value = int("not_an_integer")
+except ValueError as e:
+    raise CustomException("Invalid value") from e
+)",
+      R"(
+numbers = [1, 2, 3, 4, 5]
+squared_numbers = [x ** 2 for x in numbers if x % 2 == 0]
+double = lambda x: x * 2
+result = double(10)
+)",
+  };
+  for (const std::string& source : sources) ExpectParity(source);
+}
+
+TEST(Scanner, LiteralParity) {
+  const std::vector<std::string> sources = {
+      // Integers.
+      "0 7 42 -123 +5 0x1A 0XfF 0b1101 0B0 0123 12abc 0x 0b2 0xg 1_000",
+      // Floats.
+      "3.14159 -0.12345 +2.5e-3 1.e5 3. 3.x 3.14x 1.5E+10 2.5e 2.5e+ 1.2.3",
+      "0.5 00.5 0123.4 0123 0x1.5 0b1.5 1e5 -x +.5",
+      // Octal integers, and underscores between digits.
+      "0o17 0O7 0o8 0o 0o_7 0x_1F 0b_1 1_000 1__000 1_ _1 0_1 0_1.5",
+      "1_000.000_1 1_.5 1._5 1.5_ 1.5e1_0 1.5e_10 1.5_e10 0o1_7 0b1_ 0o_",
+      // Zero-padded integers.
+      "00 0_0 000_0 0_00 00_ 0__0 00x1 0_0.5 001 0_01 00_1.5",
+      // Strings.
+      R"('text' "text" '' "" '''text''' """text""" 'a\'b' "a\"b" 'a\\')",
+      R"(r'raw' u"uni" b'bytes' f"fmt {x}" R'' B"" x'no' rb'no')",
+      "'unterminated \"unterminated '''unterminated \"\"\"unterminated",
+      "'line\\\ncontinuation' 'multi\nline'",
+      // Identifiers.
+      "abc123 Abc123 aBc123 _abc123 abc_123 __init__ _ a1b2c3",
+  };
+  for (const std::string& source : sources) ExpectParity(source);
+}
+
+TEST(Scanner, TripleQuotedStrings) {
+  // Triple quoted strings end at the first closing triple quote, and may
+  // contain other quote characters.
+  EXPECT_EQ(ScanStringLiteral(R"('''it's''' + 1)"), 10u);
+  EXPECT_EQ(ScanStringLiteral(R"("""say "hi"""" + 1)"), 13u);
+  EXPECT_EQ(ScanStringLiteral(R"("""a""" + """b""")"), 7u);
+  EXPECT_EQ(ScanStringLiteral("'''multi\nline'''"), 16u);
+  EXPECT_EQ(ScanStringLiteral(R"('''escaped \''' quote''')"), 24u);
+}
+
+TEST(Scanner, LiteralDispatch) {
+  Token::Type type;
+  EXPECT_EQ(ScanLiteral("3.14", &type), 4u);
+  EXPECT_EQ(type, Token::Type::FLOAT);
+  EXPECT_EQ(ScanLiteral("314", &type), 3u);
+  EXPECT_EQ(type, Token::Type::INTEGER);
+  EXPECT_EQ(ScanLiteral("0b101", &type), 5u);
+  EXPECT_EQ(type, Token::Type::INTEGER);
+  EXPECT_EQ(ScanLiteral("f'{x}'", &type), 6u);
+  EXPECT_EQ(type, Token::Type::STRING);
+  EXPECT_EQ(ScanLiteral("'text'", &type), 6u);
+  EXPECT_EQ(type, Token::Type::STRING);
+
+  // Prefix letters that do not begin a string are not literals.
+  EXPECT_EQ(ScanLiteral("foo", &type), 0u);
+  EXPECT_EQ(ScanLiteral("", &type), 0u);
+  EXPECT_EQ(ScanLiteral(" 3", &type), 0u);
+}
+
+TEST(Scanner, LiteralFlags) {
+  // String literal flags are found while scanning, and match those of the
+  // scanned literal.
+  Token::Type type;
+  uint8_t flags;
+  for (const char* literal : {"'text'", R"(r'\d+')", R"(b"a\tb")", "f'{x}'",
+                              "U'''a\\\nb'''", "''", R"('\'')"}) {
+    SCOPED_TRACE(literal);
+    EXPECT_EQ(ScanLiteral(literal, &type, &flags),
+              std::string_view(literal).size());
+    EXPECT_EQ(flags, StringLiteral::ScanFlags(literal));
+  }
+
+  // Escapes past the end of the match are not part of the literal.
+  EXPECT_EQ(ScanLiteral(R"('''\n)", &type, &flags), 2u);
+  EXPECT_EQ(flags, 0u);
+  EXPECT_EQ(ScanLiteral("42", &type, &flags), 2u);
+  EXPECT_EQ(flags, 0u);
+}
+
+TEST(Scanner, Keywords) {
+  // Every keyword string is recognized as its own type.
+  for (size_t i = Token::kKeywordBegin; i <= Token::kKeywordEnd; ++i) {
+    const auto expected = static_cast<Token::Type>(i);
+    if (expected == Token::Type::IS_NOT || expected == Token::Type::NOT_IN) {
+      continue;
+    }
+    Token::Type type;
+    ASSERT_TRUE(LookupKeyword(Token(expected).String(), &type));
+    EXPECT_EQ(type, expected);
+  }
+
+  // Identifiers that are not keywords.
+  Token::Type type;
+  for (const char* word : {"", "a", "an", "andd", "AND", "none", "is not",
+                           "not in", "x", "whilee", "yiel", "classy"}) {
+    EXPECT_FALSE(LookupKeyword(word, &type)) << word;
+  }
+}
+
+TEST(Scanner, OperatorsAndDelimiters) {
+  // Every operator and delimiter string is matched in full as its own type.
+  for (size_t i = 0; i < Token::kNumTypes; ++i) {
+    const auto expected = static_cast<Token::Type>(i);
+    if (!IsOperator(expected) && !IsDelimiter(expected)) continue;
+    const std::string_view string = Token(expected).String();
+    Token::Type type;
+    ASSERT_EQ(ScanOperatorOrDelimiter(string, &type), string.size());
+    EXPECT_EQ(type, expected);
+  }
+
+  // Maximal munch, reading no further than the longest operator.
+  Token::Type type;
+  EXPECT_EQ(ScanOperatorOrDelimiter("**=2", &type), 3u);
+  EXPECT_EQ(type, Token::Type::POWER_ASSIGN);
+  EXPECT_EQ(ScanOperatorOrDelimiter("***", &type), 2u);
+  EXPECT_EQ(type, Token::Type::POWER);
+  EXPECT_EQ(ScanOperatorOrDelimiter("//=", &type), 3u);
+  EXPECT_EQ(type, Token::Type::FLOOR_DIVIDE_ASSIGN);
+  EXPECT_EQ(ScanOperatorOrDelimiter(">>=", &type), 3u);
+  EXPECT_EQ(type, Token::Type::RIGHT_SHIFT_ASSIGN);
+  EXPECT_EQ(ScanOperatorOrDelimiter("->x", &type), 2u);
+  EXPECT_EQ(type, Token::Type::ANNOTATE);
+  EXPECT_EQ(ScanOperatorOrDelimiter(":=", &type), 2u);
+  EXPECT_EQ(type, Token::Type::NAMED_EXPR);
+  EXPECT_EQ(ScanOperatorOrDelimiter(": =", &type), 1u);
+  EXPECT_EQ(type, Token::Type::COLON);
+  EXPECT_EQ(ScanOperatorOrDelimiter("<", &type), 1u);
+  EXPECT_EQ(type, Token::Type::LESS_THAN);
+
+  // Not operators.
+  EXPECT_EQ(ScanOperatorOrDelimiter("", &type), 0u);
+  EXPECT_EQ(ScanOperatorOrDelimiter("!", &type), 0u);
+  EXPECT_EQ(ScanOperatorOrDelimiter("a+", &type), 0u);
+}
+
+TEST(Scanner, Whitespace) {
+  Token::Type type;
+  size_t tabs;
+  EXPECT_EQ(ScanBlanks(" \t\r\v\f x"), 6u);
+  EXPECT_EQ(ScanBlanks("\n "), 0u);
+  EXPECT_EQ(ScanBlanks(""), 0u);
+  EXPECT_EQ(ScanNewlines("\n\n\n x"), 3u);
+  EXPECT_EQ(ScanNewlines(" \n"), 0u);
+  EXPECT_EQ(ScanIndentation("\t  \tpass", &tabs), 4u);
+  EXPECT_EQ(tabs, 2u);
+  EXPECT_EQ(ScanIndentation("\r pass", &tabs), 0u);
+  EXPECT_EQ(tabs, 0u);
+  EXPECT_EQ(FindNewline("x = 1\ny = 2"), 5u);
+  EXPECT_EQ(FindNewline("x = 1"), 5u);
+  std::vector<uint32_t> line_starts = {0u};
+  FindLineStarts("x = 1\n\ny = 2\n", &line_starts);
+  EXPECT_EQ(line_starts, (std::vector<uint32_t>{0u, 6u, 7u, 13u}));
+
+  // Blanks never begin a token.
+  for (char c : {' ', '\t', '\r', '\v', '\f'}) {
+    const std::string blank(1, c);
+    EXPECT_EQ(ScanLiteral(blank, &type), 0u);
+    EXPECT_EQ(ScanIdentifier(blank), 0u);
+    EXPECT_EQ(ScanOperatorOrDelimiter(blank, &type), 0u);
+  }
+}
+
+TEST(Scanner, LongWhitespace) {
+  // Runs of every length, straddling the block boundaries of the vectorized
+  // scanners.
+  for (size_t length = 0; length < 100; ++length) {
+    for (size_t offset = 0; offset < 3; ++offset) {
+      SCOPED_TRACE("length = " + std::to_string(length) +
+                   ", offset = " + std::to_string(offset));
+      const std::string prefix(offset, 'x');
+      size_t tabs;
+
+      std::string blanks;
+      for (size_t i = 0; i < length; ++i) blanks += " \t\r\v\f"[i % 5];
+      EXPECT_EQ(ScanBlanks(blanks + "x" + blanks), length);
+      EXPECT_EQ(ScanBlanks(blanks + "\n"), length);
+      EXPECT_EQ(ScanBlanks(blanks), length);
+
+      EXPECT_EQ(ScanNewlines(std::string(length, '\n') + " \n"), length);
+
+      std::string indentation;
+      for (size_t i = 0; i < length; ++i) indentation += (i % 3 ? ' ' : '\t');
+      EXPECT_EQ(ScanIndentation(indentation + "\r" + indentation, &tabs),
+                length);
+      EXPECT_EQ(tabs, (length + 2) / 3);
+
+      EXPECT_EQ(FindNewline(prefix + std::string(length, ' ') + "\n\n"),
+                offset + length);
+      EXPECT_EQ(FindNewline(prefix + std::string(length, ' ')),
+                offset + length);
+
+      // Every third byte is a newline.
+      std::string lines = prefix;
+      std::vector<uint32_t> expected;
+      for (size_t i = 0; i < length; ++i) {
+        lines += (i % 3 == 2 ? '\n' : 'x');
+        if (i % 3 == 2) expected.push_back(lines.size());
+      }
+      std::vector<uint32_t> line_starts;
+      FindLineStarts(lines, &line_starts);
+      EXPECT_EQ(line_starts, expected);
+    }
+  }
+}
+
+TEST(Scanner, ConvertIntegerLiteral) {
+  using Value = std::variant<int64_t, BigInt>;
+  EXPECT_EQ(ConvertIntegerLiteral("0"), Value(int64_t{0}));
+  EXPECT_EQ(ConvertIntegerLiteral("42"), Value(int64_t{42}));
+  EXPECT_EQ(ConvertIntegerLiteral("-123"), Value(int64_t{-123}));
+  EXPECT_EQ(ConvertIntegerLiteral("+5"), Value(int64_t{5}));
+  EXPECT_EQ(ConvertIntegerLiteral("0x1A"), Value(int64_t{26}));
+  EXPECT_EQ(ConvertIntegerLiteral("0XfF"), Value(int64_t{255}));
+  EXPECT_EQ(ConvertIntegerLiteral("0b1101"), Value(int64_t{13}));
+  EXPECT_EQ(ConvertIntegerLiteral("0o17"), Value(int64_t{15}));
+  EXPECT_EQ(ConvertIntegerLiteral("1_000_000"), Value(int64_t{1000000}));
+  EXPECT_EQ(ConvertIntegerLiteral("0xFFFF_FFFF"), Value(int64_t{4294967295}));
+
+  // Limits of int64_t.
+  EXPECT_EQ(ConvertIntegerLiteral("9223372036854775807"),
+            Value(int64_t{9223372036854775807}));
+  EXPECT_EQ(ConvertIntegerLiteral("-9223372036854775808"),
+            Value(std::numeric_limits<int64_t>::min()));
+
+  // Beyond the limits of int64_t.
+  EXPECT_EQ(ConvertIntegerLiteral("9223372036854775808"),
+            Value(BigInt{"9223372036854775808"}));
+  EXPECT_EQ(ConvertIntegerLiteral("-9223372036854775809"),
+            Value(BigInt{"-9223372036854775809"}));
+  EXPECT_EQ(ConvertIntegerLiteral("123456789012345678901234567890"),
+            Value(BigInt{"123456789012345678901234567890"}));
+  EXPECT_EQ(ConvertIntegerLiteral("0x1_0000_0000_0000_0000"),
+            Value(BigInt{"18446744073709551616"}));
+  EXPECT_EQ(ConvertIntegerLiteral("-0b1" + std::string(100, '0')),
+            Value(BigInt{"-1267650600228229401496703205376"}));
+
+  for (const char* literal : {"", "-", "0x", "1.5", "12abc", "0xg", "abc"}) {
+    EXPECT_THROW(ConvertIntegerLiteral(literal), std::runtime_error)
+        << literal;
+  }
+
+  // Conversion without allocating fails for integers beyond int64_t.
+  int64_t value;
+  EXPECT_TRUE(TryConvertIntegerLiteral("0x7FFF_FFFF_FFFF_FFFF", &value));
+  EXPECT_EQ(value, std::numeric_limits<int64_t>::max());
+  EXPECT_TRUE(TryConvertIntegerLiteral("-9223372036854775808", &value));
+  EXPECT_EQ(value, std::numeric_limits<int64_t>::min());
+  EXPECT_TRUE(TryConvertIntegerLiteral("0o1_7", &value));
+  EXPECT_EQ(value, 15);
+  EXPECT_FALSE(TryConvertIntegerLiteral("9223372036854775808", &value));
+  EXPECT_FALSE(TryConvertIntegerLiteral("-0x8000_0000_0000_0001", &value));
+  EXPECT_FALSE(TryConvertIntegerLiteral("0b1" + std::string(64, '0'), &value));
+  EXPECT_FALSE(TryConvertIntegerLiteral("0xg", &value));
+}
+
+TEST(Scanner, ConvertFloatLiteral) {
+  EXPECT_EQ(ConvertFloatLiteral("3.14159"), 3.14159);
+  EXPECT_EQ(ConvertFloatLiteral("-0.12345"), -0.12345);
+  EXPECT_EQ(ConvertFloatLiteral("+2.5e-3"), 2.5e-3);
+  EXPECT_EQ(ConvertFloatLiteral("1.e5"), 1e5);
+  EXPECT_EQ(ConvertFloatLiteral("3."), 3.0);
+  EXPECT_EQ(ConvertFloatLiteral("1.5E+10"), 1.5e10);
+  EXPECT_EQ(ConvertFloatLiteral("1_000.5"), 1000.5);
+
+  // Values beyond the range of double.
+  EXPECT_EQ(ConvertFloatLiteral("1.5e400"),
+            std::numeric_limits<double>::infinity());
+  EXPECT_EQ(ConvertFloatLiteral("-1.5e400"),
+            -std::numeric_limits<double>::infinity());
+  EXPECT_EQ(ConvertFloatLiteral("1.5e-400"), 0.0);
+
+  for (const char* literal : {"", "-", ".", "inf", "nan", "1.5x", "x1.5"}) {
+    EXPECT_THROW(ConvertFloatLiteral(literal), std::runtime_error) << literal;
+  }
+}
+
+TEST(Scanner, UnicodeIdentifiers) {
+  EXPECT_EQ(ScanIdentifier("π = 3.14"), 2u);
+  EXPECT_EQ(ScanIdentifier("naïve_2 = 1"), 8u);
+  EXPECT_EQ(ScanIdentifier("変数+1"), 6u);
+  EXPECT_EQ(ScanIdentifier("_ñ"), 3u);
+  EXPECT_EQ(ScanIdentifier("\uFB01le"), 5u);
+  EXPECT_EQ(ScanIdentifier("e\u0301"), 3u);
+
+  // Only XID_Start characters begin identifiers, and only XID_Continue
+  // characters continue them.
+  EXPECT_EQ(ScanIdentifier("\u0301e"), 0u);
+  EXPECT_EQ(ScanIdentifier("²"), 0u);
+  EXPECT_EQ(ScanIdentifier("x²"), 1u);
+  EXPECT_EQ(ScanIdentifier("a→b"), 1u);
+  EXPECT_EQ(ScanIdentifier("a\u00A0b"), 1u);
+
+  // Invalid UTF-8 ends an identifier.
+  EXPECT_EQ(ScanIdentifier("ab\xFF"), 2u);
+  EXPECT_EQ(ScanIdentifier("ab\xC3(c"), 2u);
+
+  // Identifiers truncated within a code point might continue.
+  EXPECT_TRUE(IsTokenTruncated("abc\xC3"));
+  EXPECT_TRUE(IsTokenTruncated("変数"));
+  EXPECT_FALSE(IsTokenTruncated("変数 = 1"));
+  EXPECT_FALSE(IsTokenTruncated("abc\xC3\xA9 = 1"));
+}
+
+TEST(Scanner, ValidUtf8) {
+  EXPECT_EQ(ScanValidUtf8(""), 0u);
+  const std::string valid = "a = 'é' + '変数' + '😀'";
+  EXPECT_EQ(ScanValidUtf8(valid), valid.size());
+  EXPECT_EQ(ScanValidUtf8("ab\xFF"), 2u);
+  EXPECT_EQ(ScanValidUtf8("ab\x80"), 2u);
+  EXPECT_EQ(ScanValidUtf8("ab\xC3"), 2u);
+  EXPECT_EQ(ScanValidUtf8("ab\xC3\xA9\xA9"), 4u);
+  EXPECT_EQ(ScanValidUtf8("ab\xC0\xAF"), 2u);          // Overlong.
+  EXPECT_EQ(ScanValidUtf8("ab\xED\xA0\x80"), 2u);      // Surrogate.
+  EXPECT_EQ(ScanValidUtf8("ab\xF4\x90\x80\x80"), 2u);  // Beyond U+10FFFF.
+
+  // Invalid bytes at every position, straddling the block boundaries of the
+  // vectorized scanner.
+  for (size_t length = 0; length < 100; ++length) {
+    SCOPED_TRACE("length = " + std::to_string(length));
+    const std::string ascii(length, 'x');
+    EXPECT_EQ(ScanValidUtf8(ascii), length);
+    EXPECT_EQ(ScanValidUtf8(ascii + "\xFF" + ascii), length);
+    EXPECT_EQ(ScanValidUtf8("é" + ascii + "\xFF"), length + 2);
+  }
+}
@@ -0,0 +1,110 @@
+#include "source_buffer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+// Size of each read when reading unmappable files.
+static constexpr size_t kReadSize = 64u * 1024u;
+
+std::runtime_error Error(const std::string& message) {
+  return std::runtime_error(message + ": " + std::strerror(errno));
+}
+
+// Read up to `size` bytes from `fd`, retrying on interrupts.
+size_t Read(int fd, char* data, size_t size) {
+  while (true) {
+    const ssize_t bytes = read(fd, data, size);
+    if (bytes >= 0) return bytes;
+    if (errno != EINTR) throw Error("Failed to read file");
+  }
+}
+}  // namespace
+
+/*static*/ SourceBuffer::Ptr SourceBuffer::FromString(std::string source) {
+  std::shared_ptr<SourceBuffer> buffer(new SourceBuffer);
+  buffer->storage_ = std::move(source);
+  buffer->text_ = buffer->storage_;
+  return buffer;
+}
+
+/*static*/ SourceBuffer::Ptr SourceBuffer::FromView(std::string_view source) {
+  std::shared_ptr<SourceBuffer> buffer(new SourceBuffer);
+  buffer->text_ = source;
+  return buffer;
+}
+
+/*static*/ SourceBuffer::Ptr SourceBuffer::FromFile(const std::string& path) {
+  const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) throw Error("Failed to open " + path);
+
+  try {
+    Ptr buffer = FromFd(fd);
+    close(fd);
+    return buffer;
+  } catch (...) {
+    close(fd);
+    throw;
+  }
+}
+
+/*static*/ SourceBuffer::Ptr SourceBuffer::FromFd(int fd) {
+  std::shared_ptr<SourceBuffer> buffer(new SourceBuffer);
+
+  // Map regular files from the current offset onwards. Mappings must begin at
+  // a page boundary, so map from the page containing the offset.
+  struct stat info;
+  if (fstat(fd, &info) < 0) throw Error("Failed to stat file");
+  const off_t offset =
+      S_ISREG(info.st_mode) ? lseek(fd, 0, SEEK_CUR) : off_t{-1};
+  if (offset >= 0 && offset < info.st_size) {
+    const off_t page_offset = offset - offset % sysconf(_SC_PAGESIZE);
+    const size_t size = info.st_size - page_offset;
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd,
+                         page_offset);
+    if (mapping != MAP_FAILED) {
+      // Lexing reads the source front to back, so have the kernel read ahead
+      // aggressively. This is purely advisory, so failures are ignored.
+      madvise(mapping, size, MADV_SEQUENTIAL);
+      buffer->mapping_ = mapping;
+      buffer->mapping_size_ = size;
+      buffer->text_ = std::string_view(static_cast<const char*>(mapping), size)
+                          .substr(offset - page_offset);
+      lseek(fd, info.st_size, SEEK_SET);
+      return buffer;
+    }
+  }
+
+  // Otherwise fall back to reading until the end of the file.
+  size_t size = 0u;
+  while (true) {
+    buffer->storage_.resize(size + kReadSize);
+    const size_t bytes = Read(fd, buffer->storage_.data() + size, kReadSize);
+    if (bytes == 0) break;
+    size += bytes;
+  }
+  buffer->storage_.resize(size);
+  buffer->text_ = buffer->storage_;
+  return buffer;
+}
+
+SourceBuffer::~SourceBuffer() {
+  if (mapping_ != nullptr) munmap(mapping_, mapping_size_);
+}
+
+ChunkReader ReadChunks(int fd) {
+  return [fd](char* data, size_t size) { return Read(fd, data, size); };
+}
+
+ChunkReader ReadChunks(std::istream* stream) {
+  return [stream](char* data, size_t size) -> size_t {
+    stream->read(data, size);
+    return stream->gcount();
+  };
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+// An immutable buffer of source code, shared through a reference counted
+// handle. Tokens lexed from a source buffer do not own their text. Rather, they
+// hold views into the buffer, which remain valid for as long as any handle to
+// the buffer is alive. Holders of such tokens (e.g. the lexer, or a parser
+// building a syntax tree) keep the buffer alive by holding on to a handle.
+//
+// Example:
+//
+//     SourceBuffer::Ptr buffer = SourceBuffer::FromString("a = 5");
+//     Lexer lexer(buffer);
+//     ...
+//
+class SourceBuffer {
+ public:
+  using Ptr = std::shared_ptr<const SourceBuffer>;
+
+  // Create a buffer that owns the provided source code.
+  static Ptr FromString(std::string source);
+
+  // Create a buffer that views source code owned by the caller. The caller
+  // must keep `source` alive for as long as the buffer, or any token lexed
+  // from it, is in use.
+  static Ptr FromView(std::string_view source);
+
+  // Create a buffer holding the contents of the file at `path`. Regular files
+  // are mapped read-only into memory rather than copied, and are unmapped once
+  // the last handle to the buffer is released. Throws if the file cannot be
+  // read.
+  static Ptr FromFile(const std::string& path);
+
+  // Create a buffer holding the remaining contents of the open file descriptor
+  // `fd`, e.g. STDIN_FILENO. Regular files are mapped as in FromFile(), while
+  // pipes, terminals and other unmappable files are read until end of file.
+  // Does not close `fd`. Throws if the file cannot be read.
+  static Ptr FromFd(int fd);
+
+  SourceBuffer(const SourceBuffer&) = delete;
+  SourceBuffer& operator=(const SourceBuffer&) = delete;
+  ~SourceBuffer();
+
+  // The source code held by this buffer.
+  std::string_view text() const { return text_; }
+
+  // Whether the source code is memory mapped from a file.
+  bool mapped() const { return mapping_ != nullptr; }
+
+ private:
+  SourceBuffer() = default;
+
+  // Owned source code. Empty for buffers that view external source code.
+  std::string storage_;
+
+  // Memory mapped source code, if any, and the size of the mapping.
+  void* mapping_ = nullptr;
+  size_t mapping_size_ = 0u;
+
+  // View of the source code, into either `storage_`, `mapping_` or external
+  // memory.
+  std::string_view text_;
+};
+
+// Reads the next chunk of source code into `data`, which has room for `size`
+// bytes. Returns the number of bytes read, which is 0 only once the source code
+// is exhausted. Used to lex source code of unknown length, e.g. from a pipe or
+// a socket, without holding all of it in memory.
+using ChunkReader = std::function<size_t(char* data, size_t size)>;
+
+// Read chunks from the open file descriptor `fd`, which is not closed. Throws
+// if the file cannot be read.
+ChunkReader ReadChunks(int fd);
+
+// Read chunks from `stream`, which must outlive the reader.
+ChunkReader ReadChunks(std::istream* stream);
@@ -0,0 +1,142 @@
+#include "source_buffer.h"
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+#include "lexer.h"
+
+namespace {
+// A temporary file holding the provided contents, deleted on destruction.
+class TempFile {
+ public:
+  explicit TempFile(const std::string& contents) {
+    char path[] = "/tmp/source_buffer_test_XXXXXX";
+    const int fd = mkstemp(path);
+    EXPECT_GE(fd, 0);
+    EXPECT_EQ(write(fd, contents.data(), contents.size()),
+              static_cast<ssize_t>(contents.size()));
+    close(fd);
+    path_ = path;
+  }
+  ~TempFile() { std::remove(path_.c_str()); }
+
+  const std::string& path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+}  // namespace
+
+TEST(SourceBuffer, FromString) {
+  SourceBuffer::Ptr buffer = SourceBuffer::FromString("a = 5");
+  EXPECT_EQ(buffer->text(), "a = 5");
+  EXPECT_FALSE(buffer->mapped());
+}
+
+TEST(SourceBuffer, FromFile) {
+  const std::string source = "def add(a, b):\n    return a + b\n";
+  TempFile file(source);
+
+  SourceBuffer::Ptr buffer = SourceBuffer::FromFile(file.path());
+  EXPECT_EQ(buffer->text(), source);
+  EXPECT_TRUE(buffer->mapped());
+
+  // Empty files have nothing to map.
+  TempFile empty("");
+  buffer = SourceBuffer::FromFile(empty.path());
+  EXPECT_EQ(buffer->text(), "");
+  EXPECT_FALSE(buffer->mapped());
+
+  EXPECT_THROW(SourceBuffer::FromFile("/nonexistent/file.py"),
+               std::runtime_error);
+}
+
+TEST(SourceBuffer, FromFdReadsRemainingContents) {
+  // Large enough to span several pages.
+  std::string source;
+  while (source.size() < 3 * 4096) source += "value = value + 1\n";
+  TempFile file(source);
+
+  const int fd = open(file.path().c_str(), O_RDONLY);
+  ASSERT_GE(fd, 0);
+  ASSERT_EQ(lseek(fd, 5000, SEEK_SET), 5000);
+  SourceBuffer::Ptr buffer = SourceBuffer::FromFd(fd);
+  EXPECT_EQ(buffer->text(), source.substr(5000));
+  EXPECT_TRUE(buffer->mapped());
+  close(fd);
+}
+
+TEST(SourceBuffer, FromPipe) {
+  // Pipes cannot be mapped, and are read instead.
+  std::string source;
+  while (source.size() < 32 * 1024) source += "x = [1, 2, 3]\n";
+
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  ASSERT_EQ(write(fds[1], source.data(), source.size()),
+            static_cast<ssize_t>(source.size()));
+  close(fds[1]);
+
+  SourceBuffer::Ptr buffer = SourceBuffer::FromFd(fds[0]);
+  EXPECT_EQ(buffer->text(), source);
+  EXPECT_FALSE(buffer->mapped());
+  close(fds[0]);
+}
+
+TEST(SourceBuffer, LexFromFile) {
+  const std::string source = "message = 'Hello, World!'\n";
+  TempFile file(source);
+
+  Lexer lexer;
+  lexer.SetSourceFile(file.path());
+  std::vector<Token> tokens = lexer.TokenStream().ReadAll();
+  EXPECT_EQ(tokens, Lex(source));
+
+  // Token values view the mapped file.
+  const std::string_view text = lexer.source()->text();
+  const std::string_view value = *tokens[0].value;
+  EXPECT_EQ(value, "message");
+  EXPECT_GE(value.data(), text.data());
+  EXPECT_LE(value.data() + value.size(), text.data() + text.size());
+}
+
+TEST(SourceBuffer, LexKeepsSourceAlive) {
+  // Tokens outlive both the lexer and the temporary source code.
+  const std::vector<Token> tokens = Lex(std::string("name = 'value' + 5\n"));
+  ASSERT_EQ(tokens.size(), 6u);
+  for (const Token& token : tokens) {
+    if (!token.value) continue;
+    ASSERT_NE(token.source, nullptr);
+    const std::string_view text = token.source->text();
+    EXPECT_GE(token.value->data(), text.data());
+    EXPECT_LE(token.value->data() + token.value->size(),
+              text.data() + text.size());
+  }
+  EXPECT_EQ(*tokens[0].value, "name");
+  EXPECT_EQ(*tokens[2].value, "'value'");
+}
+
+TEST(SourceBuffer, ReadChunks) {
+  const std::string source = "x = [1, 2, 3]\n";
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  ASSERT_EQ(write(fds[1], source.data(), source.size()),
+            static_cast<ssize_t>(source.size()));
+  close(fds[1]);
+
+  // Read in chunks smaller than the source code.
+  ChunkReader read_chunk = ReadChunks(fds[0]);
+  std::string chunks;
+  char chunk[4];
+  while (size_t bytes = read_chunk(chunk, sizeof(chunk))) {
+    EXPECT_LE(bytes, sizeof(chunk));
+    chunks.append(chunk, bytes);
+  }
+  EXPECT_EQ(chunks, source);
+  close(fds[0]);
+}
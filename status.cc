@@ -0,0 +1,91 @@
+#include "status.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+uint32_t ToOffset(size_t offset) {
+  return static_cast<uint32_t>(std::min<size_t>(offset, Status::kNoOffset));
+}
+
+std::string TypeString(uint8_t type) {
+  return std::string(Token(static_cast<Token::Type>(type)).String());
+}
+}  // namespace
+
+Status::Status(ErrorCode code, size_t offset)
+    : code_(code), offset_(ToOffset(offset)) {}
+
+Status Status::UnexpectedToken(Token::Type found, size_t offset) {
+  Status status(ErrorCode::UNEXPECTED_TOKEN, offset);
+  status.found_ = static_cast<uint8_t>(found);
+  return status;
+}
+
+Status Status::ExpectedToken(Token::Type expected,
+                             std::optional<Token::Type> found, size_t offset) {
+  Status status(ErrorCode::EXPECTED_TOKEN, offset);
+  status.expected_ = static_cast<uint8_t>(expected);
+  if (found) status.found_ = static_cast<uint8_t>(*found);
+  return status;
+}
+
+std::string Status::Message() const {
+  if (ok()) return "";
+  std::string message = Description();
+  if (offset_ != kNoOffset) message += " at byte " + std::to_string(offset_);
+  return message + ".";
+}
+
+std::string Status::Message(const LineIndex& lines) const {
+  if (ok()) return "";
+  std::string message = Description();
+  if (offset_ != kNoOffset) {
+    const SourceLocation location = lines.Locate(offset_);
+    message += " at line " + std::to_string(location.line) + ", column " +
+               std::to_string(location.column);
+  }
+  return message + ".";
+}
+
+std::string Status::Description() const {
+  std::string message;
+  switch (code_) {
+    case ErrorCode::OK:
+      break;
+    case ErrorCode::INVALID_UTF8:
+      message = "Encountered invalid UTF-8";
+      break;
+    case ErrorCode::INVALID_NUMBER_LITERAL:
+      message = "Encountered invalid number literal";
+      break;
+    case ErrorCode::UNEXPECTED_INDENTATION:
+      message = "Encountered unexpected indentation";
+      break;
+    case ErrorCode::NEGATIVE_INDENTATION:
+      message = "Encountered negative indentation";
+      break;
+    case ErrorCode::UNEXPECTED_DELTA_INDENTATION:
+      message = "Encountered unexpected delta indentation (>1 level)";
+      break;
+    case ErrorCode::EDIT_OUT_OF_RANGE:
+      message = "Encountered edit out of range of source code";
+      break;
+    case ErrorCode::UNEXPECTED_TOKEN:
+      message = "Encountered unexpected token " + TypeString(found_);
+      break;
+    case ErrorCode::EXPECTED_TOKEN:
+      message = "Failed to match token " + TypeString(expected_);
+      message += (found_ == kNoType ? " (no more tokens available)"
+                                    : " (got " + TypeString(found_) + ")");
+      break;
+    case ErrorCode::MISSING_COMPARATOR:
+      message = "Encountered comparison token, but found no comparator";
+      break;
+  }
+  return message;
+}
+
+void Status::ThrowIfError() const {
+  if (!ok()) throw std::runtime_error(Message());
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "line_index.h"
+#include "token.h"
+
+// Kinds of errors encountered while lexing or parsing source code.
+enum class ErrorCode : uint8_t {
+  OK,
+  INVALID_UTF8,                  // Source code is not valid UTF-8.
+  INVALID_NUMBER_LITERAL,        // Digits that begin no number, e.g. `1__0`.
+  UNEXPECTED_INDENTATION,        // Not a multiple of the indentation width.
+  NEGATIVE_INDENTATION,          // Dedented past the first column.
+  UNEXPECTED_DELTA_INDENTATION,  // Indented by more than one level at once.
+  EDIT_OUT_OF_RANGE,             // Edit lies outside of the source code.
+  UNEXPECTED_TOKEN,              // Token cannot begin or continue the parse.
+  EXPECTED_TOKEN,                // Some other token (or any token) expected.
+  MISSING_COMPARATOR,            // Comparison operator without a comparator.
+};
+
+// The outcome of lexing or parsing: either OK, or the first error encountered.
+// An error is a compact code, along with the byte offset in the source code
+// that it was encountered at and the token types involved, if known. Messages
+// are only built on request, so errors are cheap to report, and to discard.
+//
+// Example:
+//
+//     StatusOr<std::vector<Token>> tokens = TryLex("if x:\n        y\n");
+//     if (!tokens.ok()) {
+//       std::cerr << tokens.status().Message();  // "Encountered unexpected
+//                                                 // delta indentation..."
+//     }
+//
+class Status {
+ public:
+  // Placeholder for errors at an unknown offset.
+  static constexpr uint32_t kNoOffset = UINT32_MAX;
+
+  // OK.
+  Status() = default;
+
+  // An error of the given kind, e.g. Status(ErrorCode::INVALID_UTF8, 12).
+  explicit Status(ErrorCode code, size_t offset = kNoOffset);
+
+  // An UNEXPECTED_TOKEN error for a token of type `found`.
+  static Status UnexpectedToken(Token::Type found, size_t offset = kNoOffset);
+
+  // An EXPECTED_TOKEN error for a token of type `expected`, where a token of
+  // type `found` was found, or none at all.
+  static Status ExpectedToken(Token::Type expected,
+                              std::optional<Token::Type> found,
+                              size_t offset = kNoOffset);
+
+  bool ok() const { return code_ == ErrorCode::OK; }
+  ErrorCode code() const { return code_; }
+  uint32_t offset() const { return offset_; }
+
+  // Human readable description of the error, e.g. "Failed to match token ':'
+  // (got 'x') at byte 5.". Empty if OK.
+  std::string Message() const;
+
+  // As above, but locating the error by line and column within the source
+  // code indexed by `lines`, e.g. "... at line 2, column 5.".
+  std::string Message(const LineIndex& lines) const;
+
+  // Throw the error as a std::runtime_error, with Message() as its
+  // description. Does nothing if OK.
+  void ThrowIfError() const;
+
+ private:
+  // Placeholder for token types that are not part of the error.
+  static constexpr uint8_t kNoType = UINT8_MAX;
+
+  // Description of the error, without its location.
+  std::string Description() const;
+
+  ErrorCode code_ = ErrorCode::OK;
+  uint8_t expected_ = kNoType;
+  uint8_t found_ = kNoType;
+  uint32_t offset_ = kNoOffset;
+};
+
+// Either a value, or the error that prevented computing it.
+template <typename T>
+class StatusOr {
+ public:
+  StatusOr(T value) : value_(std::move(value)) {}
+  StatusOr(Status status) : status_(status) {}
+
+  bool ok() const { return status_.ok(); }
+  const Status& status() const { return status_; }
+
+  // Access the value. Must be ok().
+  T& value() & { return *value_; }
+  const T& value() const& { return *value_; }
+  T&& value() && { return *std::move(value_); }
+  T& operator*() & { return *value_; }
+  const T& operator*() const& { return *value_; }
+  T* operator->() { return &*value_; }
+  const T* operator->() const { return &*value_; }
+
+ private:
+  Status status_;
+  std::optional<T> value_;
+};
@@ -0,0 +1,66 @@
+#include "status.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "gtest/gtest.h"
+
+TEST(Status, Ok) {
+  const Status status;
+  EXPECT_TRUE(status.ok());
+  EXPECT_EQ(status.code(), ErrorCode::OK);
+  EXPECT_EQ(status.offset(), Status::kNoOffset);
+  EXPECT_EQ(status.Message(), "");
+  EXPECT_NO_THROW(status.ThrowIfError());
+}
+
+TEST(Status, Messages) {
+  EXPECT_EQ(Status(ErrorCode::UNEXPECTED_INDENTATION, 12u).Message(),
+            "Encountered unexpected indentation at byte 12.");
+  EXPECT_EQ(Status(ErrorCode::INVALID_UTF8).Message(),
+            "Encountered invalid UTF-8.");
+  EXPECT_EQ(Status::UnexpectedToken(Token::Type::LEFT_PAREN, 4u).Message(),
+            "Encountered unexpected token ( at byte 4.");
+  EXPECT_EQ(Status::ExpectedToken(Token::Type::COLON, Token::Type::NEWLINE)
+                .Message(),
+            "Failed to match token : (got " +
+                std::string(Token(Token::Type::NEWLINE).String()) + ").");
+  EXPECT_EQ(Status::ExpectedToken(Token::Type::COLON, std::nullopt).Message(),
+            "Failed to match token : (no more tokens available).");
+
+  // Errors located by line and column.
+  const LineIndex lines("a = 1\nb = (\n");
+  EXPECT_EQ(Status::UnexpectedToken(Token::Type::LEFT_PAREN, 10u)
+                .Message(lines),
+            "Encountered unexpected token ( at line 2, column 5.");
+  EXPECT_EQ(Status(ErrorCode::INVALID_UTF8).Message(lines),
+            "Encountered invalid UTF-8.");
+  EXPECT_EQ(Status().Message(lines), "");
+
+  // Offsets beyond 32 bits are unknown.
+  EXPECT_EQ(Status(ErrorCode::INVALID_UTF8, size_t{1} << 40).offset(),
+            Status::kNoOffset);
+}
+
+TEST(Status, ThrowIfError) {
+  try {
+    Status(ErrorCode::MISSING_COMPARATOR, 3u).ThrowIfError();
+    FAIL() << "Expected an exception";
+  } catch (const std::runtime_error& error) {
+    EXPECT_EQ(std::string(error.what()),
+              "Encountered comparison token, but found no comparator at byte "
+              "3.");
+  }
+}
+
+TEST(Status, StatusOr) {
+  StatusOr<std::string> value = std::string("abc");
+  ASSERT_TRUE(value.ok());
+  EXPECT_EQ(*value, "abc");
+  EXPECT_EQ(value->size(), 3u);
+  EXPECT_EQ(std::move(value).value(), "abc");
+
+  const StatusOr<std::string> error = Status(ErrorCode::EDIT_OUT_OF_RANGE);
+  EXPECT_FALSE(error.ok());
+  EXPECT_EQ(error.status().code(), ErrorCode::EDIT_OUT_OF_RANGE);
+}
@@ -1,23 +1,44 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <cstdint>
 #include <functional>
+#include <mutex>
 #include <optional>
-#include <queue>
+#include <thread>
 #include <utility>
 #include <vector>
 
 // A simple unidirectional stream that allows consumers to pull from producers.
-// NOTE(erik): This is currently synchronous.
+// Streams are synchronous unless made asynchronous (see Stream::SetAsync()).
 //
 // Example usage:
 //
 //    // User defines a callback that generates new values on request.
 //    Stream<Foo>::FillCallback = [](std::vector<Foo>* fill_me) -> bool { ... };
 //
+//    // Alternatively, the callback appends values directly to the stream.
+//    Stream<Foo>::SinkCallback = [](StreamSink<Foo>* sink) -> bool { ... };
+//
 //    // Create a stream and a reader.
 //    Stream<Foo> stream(fill_callback, /*min_buffer_size=*/10);
 //    StreamReader<Foo> reader = stream.MakeReader();
 //
+//    // So that filling the stream does not go through a type-erased callback,
+//    // the producer may instead be a template parameter of the stream, and of
+//    // its readers.
+//    struct FooProducer {
+//      bool operator()(StreamSink<Foo>* sink) { ... }
+//    };
+//    Stream<Foo, FooProducer> stream(FooProducer{}, /*min_buffer_size=*/10);
+//    StreamReader<Foo, FooProducer> reader = stream.MakeReader();
+//
 //    // Users can now request values from the stream as long as they are able
 //    // to be produced. This internally calls the FillCallback until the
 //    // producer is depleted.
@@ -28,42 +49,166 @@
 //    std::vector<Foo> values = reader.ReadAll();
 //
 template <typename T>
+class StreamSink;
+
+// Whether streams collect statistics (see StreamStats), which is only when
+// compiled with STREAM_STATS defined, e.g. `bazel build --copt=-DSTREAM_STATS`.
+// Otherwise, collecting them is compiled out entirely. Must be the same for
+// all translation units.
+#if defined(STREAM_STATS)
+inline constexpr bool kStreamStats = true;
+#else
+inline constexpr bool kStreamStats = false;
+#endif
+
+// Statistics of a stream since it was made, for sizing its buffer (see
+// Stream::Stream()). All zero unless collected (see kStreamStats).
+struct StreamStats {
+  // Histograms have power of two buckets: bucket 0 counts zeros, and bucket
+  // `i` counts values in [2^(i-1), 2^i). The last bucket counts all larger
+  // values as well.
+  static constexpr size_t kBuckets = 16u;
+  using Histogram = std::array<uint64_t, kBuckets>;
+  static size_t Bucket(size_t value) {
+    size_t bucket = 0u;
+    while (value > 0u && bucket < kBuckets - 1) value >>= 1, ++bucket;
+    return bucket;
+  }
+
+  // Number of times readers ran out of values and filled the stream, and the
+  // time they spent doing so, including waiting for asynchronous producers.
+  uint64_t fills = 0u;
+  std::chrono::nanoseconds fill_time{0};
+
+  // Number of values buffered for a reader whenever it peeked at or read
+  // from the stream.
+  Histogram occupancy = {};
+
+  // Number of calls to the producer, the number of values produced by each,
+  // and the time spent in the producer.
+  uint64_t producer_calls = 0u;
+  uint64_t produced = 0u;
+  Histogram values_per_call = {};
+  std::chrono::nanoseconds producer_time{0};
+
+  // The most values the stream ever buffered at once.
+  size_t peak_occupancy = 0u;
+};
+
+// Type-erased producer of values for a stream, which appends values to the
+// stream and returns false once the producer is finished. The default, so
+// that streams of different producers have the same type.
+template <typename T>
+using AnyProducer = std::function<bool(StreamSink<T>*)>;
+
+template <typename T, typename Producer = AnyProducer<T>>
 class Stream;
 
+// A view of the next values in a stream, which are not necessarily contiguous
+// in the stream's ring buffer. Valid until the stream is next read from.
 template <typename T>
+class StreamWindow {
+ public:
+  StreamWindow(const std::vector<T>* ring, size_t begin, size_t size)
+      : ring_(ring), begin_(begin), size_(size) {}
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0u; }
+
+  // The `i`th next value, where `i` must be less than size().
+  const T& operator[](size_t i) const {
+    return (*ring_)[(begin_ + i) & (ring_->size() - 1)];
+  }
+
+ private:
+  const std::vector<T>* ring_;
+  size_t begin_;
+  size_t size_;
+};
+
+// Reads values from a stream. A stream may have any number of readers, each
+// with its own position in the stream. Readers are made by the stream (see
+// Stream::MakeReader()), or by copying another reader at its position. Values
+// are buffered until all readers have read past them, so that one pass of the
+// producer feeds several consumers, but a reader that falls behind holds back
+// the others. Asynchronous streams do not grow their buffer, so readers may
+// only run ahead of the reader furthest behind by as many values as the
+// buffer holds. Readers must not outlive their stream, and all readers of a
+// stream must be used from the same thread.
+template <typename T, typename Producer = AnyProducer<T>>
 class StreamReader {
  public:
-  StreamReader(Stream<T>* stream) : stream_(stream) {}
+  StreamReader(Stream<T, Producer>* stream)
+      : stream_(stream), id_(stream->AddReader(stream->Head())) {}
+  StreamReader(const StreamReader& other)
+      : stream_(other.stream_),
+        id_(stream_->AddReader(stream_->cursors_[other.id_])) {}
+  StreamReader(StreamReader&& other)
+      : stream_(other.stream_), id_(std::exchange(other.id_, kNoReader)) {}
+  StreamReader& operator=(StreamReader other) {
+    std::swap(stream_, other.stream_);
+    std::swap(id_, other.id_);
+    return *this;
+  }
+  ~StreamReader() {
+    if (id_ != kNoReader) stream_->RemoveReader(id_);
+  }
 
   // Peek at the next element in the stream without consuming it.
-  // Returns nullopt if the stream was depleted.
+  // Returns nullopt if the stream was depleted. The element is only valid
+  // until the stream is next read from.
   std::optional<const T*> Peek() {
-    stream_->Fill();
-    if (!Empty()) return &stream_->stream_.front();
-    return std::nullopt;
+    if (!Fill(1u)) return std::nullopt;
+    return &stream_->Front(id_);
   }
 
-  // Read the next element from the stream, consuming it.
+  // Peek at the `k`th next element in the stream (where Peek() is the 0th),
+  // without consuming any. Returns nullopt if the stream is depleted before
+  // then. Asynchronous streams only look ahead as far as their buffer holds,
+  // so `k` must be less than twice the stream's min buffer size, unless the
+  // stream is depleted before then (which is asserted).
+  std::optional<const T*> PeekN(size_t k) {
+    if (!Fill(k + 1)) return std::nullopt;
+    return &Window(k + 1)[k];
+  }
+
+  // View the next `count` elements in the stream, or fewer if the stream is
+  // depleted before then, without consuming them. As for PeekN(), `count`
+  // must not exceed twice the min buffer size of asynchronous streams.
+  StreamWindow<T> Window(size_t count) {
+    Fill(count);
+    return {&stream_->ring_, stream_->cursors_[id_],
+            std::min(count, stream_->Size(id_))};
+  }
+
+  // Read the next element from the stream, consuming it. The element is
+  // copied if other readers have yet to read it, and moved otherwise.
   // Returns nullopt if the stream was depleted.
   std::optional<T> Read() {
-    stream_->Fill();
-    if (!Empty()) {
-      T value = std::move(stream_->stream_.front());
-      stream_->stream_.pop();
-      return value;
+    if (!Fill(1u)) return std::nullopt;
+    return stream_->Take(id_);
+  }
+
+  // Read up to `count` elements from the stream into `values`, consuming
+  // them. Returns the number of elements read, which is less than `count`
+  // only if the stream was depleted.
+  size_t ReadBatch(T* values, size_t count) {
+    size_t read = 0u;
+    while (read < count && Fill(1u)) {
+      const size_t available = std::min(count - read, stream_->Size(id_));
+      for (size_t i = 0; i < available; ++i) {
+        values[read++] = stream_->Take(id_);
+      }
     }
-    return std::nullopt;
+    return read;
   }
 
   // Consume the next element in the stream (without reading it).
   // Returns false if the stream was depleted.
   bool Advance() {
-    stream_->Fill();
-    if (!Empty()) {
-      stream_->stream_.pop();
-      return true;
-    }
-    return false;
+    if (!Fill(1u)) return false;
+    stream_->Pop(id_);
+    return true;
   }
 
   // Helper that reads all remaining values from the stream into a vector.
@@ -75,71 +220,447 @@ class StreamReader {
 
   // Is the producer finished?
   bool Finished() const { return stream_->Finished(); }
+  // Has this reader read all values buffered in the stream?
+  bool Empty() const { return stream_->Empty(id_); }
+  // Is the stream depleted for this reader? i.e. the producer is finished and
+  // this reader has read all values.
+  bool Depleted() const { return Finished() && Empty(); }
+
+  // Statistics of the stream (see Stream::stats()).
+  StreamStats stats() const { return stream_->stats(); }
+
+ protected:
+  // Ensure that at least `count` values are buffered for this reader, unless
+  // the stream is depleted before then, only calling into the stream if fewer
+  // are. Returns whether they are.
+  bool Fill(size_t count) {
+    if constexpr (kStreamStats) {
+      ++stream_->stats_.occupancy[StreamStats::Bucket(stream_->Size(id_))];
+    }
+    if (stream_->Size(id_) >= count) return true;
+    stream_->Fill(id_, count);
+    return stream_->Size(id_) >= count;
+  }
+
+  // Placeholder id of moved-from readers.
+  static constexpr size_t kNoReader = SIZE_MAX;
+
+  Stream<T, Producer>* stream_;
+  size_t id_;
+};
+
+#include <stdio.h>
+// The values buffered by a stream, in a ring buffer whose size is a power of
+// two. Holds the values from index `head_` up to `tail_` (modulo the size of
+// the ring), where `head_` is the position of the reader furthest behind.
+// Asynchronous streams use it as a bounded single-producer single-consumer
+// queue: only readers advance `head_`, and only the producer thread advances
+// `tail_`, each publishing the slots it is done with to the other. Shared by
+// streams of all producers of `T`.
+template <typename T>
+class StreamQueue {
+ public:
+  // Is the producer finished?
+  bool Finished() const { return finished_.load(std::memory_order_acquire); }
   // Is the remaining stream buffer empty?
-  bool Empty() const { return stream_->Empty(); }
+  bool Empty() const {
+    return tail_.load(std::memory_order_acquire) == Head();
+  }
   // Is the stream depleted? i.e. the producer is finished and the buffer is
   // empty.
-  bool Depleted() const { return stream_->Depleted(); }
+  bool Depleted() const { return Finished() && Empty(); }
+
+  // A snapshot of the statistics of the stream. Asynchronous streams update
+  // them on the producer thread, so they are only valid once the stream is
+  // finished, or cleared.
+  StreamStats stats() const { return stats_; }
 
  protected:
-  Stream<T>* stream_;
+  template <typename, typename>
+  friend class StreamReader;
+  friend class StreamSink<T>;
+
+  // Placeholder cursor of reader ids that are not in use.
+  static constexpr size_t kNoCursor = SIZE_MAX;
+
+  explicit StreamQueue(size_t min_buffer_size) {
+    size_t capacity = 1u;
+    while (capacity < 2 * min_buffer_size) capacity *= 2;
+    ring_.resize(capacity);
+  }
+
+  size_t Head() const { return head_.load(std::memory_order_relaxed); }
+
+  // Number of values in the stream.
+  size_t Size() const { return tail_.load(std::memory_order_acquire) - Head(); }
+
+  // Number of values reader `id` has yet to read.
+  size_t Size(size_t id) const {
+    return tail_.load(std::memory_order_acquire) - cursors_[id];
+  }
+  bool Empty(size_t id) const { return Size(id) == 0u; }
+
+  // Index of the `i`th slot from the beginning of the ring buffer.
+  size_t Slot(size_t i) const { return i & (ring_.size() - 1); }
+
+  // Add a reader at `cursor`, returning its id.
+  size_t AddReader(size_t cursor) {
+    for (size_t id = 0; id < cursors_.size(); ++id) {
+      if (cursors_[id] == kNoCursor) {
+        cursors_[id] = cursor;
+        return id;
+      }
+    }
+    cursors_.push_back(cursor);
+    return cursors_.size() - 1;
+  }
+
+  // Remove reader `id`, releasing the values only it had yet to read.
+  void RemoveReader(size_t id) {
+    cursors_[id] = kNoCursor;
+    Release();
+  }
+
+  // The next value for reader `id`, which must not be empty.
+  T& Front(size_t id) { return ring_[Slot(cursors_[id])]; }
+
+  // Consume the next value for reader `id`, which must not be empty. Moves the
+  // value out of the stream if no other reader has yet to read it.
+  T Take(size_t id) {
+    const size_t cursor = cursors_[id];
+    bool shared = false;
+    for (size_t other = 0; other < cursors_.size(); ++other) {
+      shared |= other != id && cursors_[other] <= cursor;
+    }
+    T value = shared ? Front(id) : std::move(Front(id));
+    Pop(id);
+    return value;
+  }
+
+  // Skip the next value for reader `id`, which must not be empty.
+  void Pop(size_t id) {
+    if (cursors_[id]++ == Head()) Release();
+  }
+
+  // Remove values that all readers have read past, releasing anything they
+  // hold on to. Values are kept while there are no readers.
+  void Release() {
+    size_t min = kNoCursor;
+    for (const size_t cursor : cursors_) min = std::min(min, cursor);
+    if (min == kNoCursor) return;
+    size_t head = Head();
+    for (; head < min; ++head) ring_[Slot(head)] = T();
+    head_.store(head, std::memory_order_release);
+    if (async_) Notify();
+  }
+
+  // Remove all values from the stream, moving readers to its beginning.
+  void Reset() {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    for (size_t i = Head(); i < tail; ++i) ring_[Slot(i)] = T();
+    for (size_t& cursor : cursors_) {
+      if (cursor != kNoCursor) cursor = 0u;
+    }
+    head_.store(0u, std::memory_order_relaxed);
+    tail_.store(0u, std::memory_order_relaxed);
+    finished_.store(false, std::memory_order_relaxed);
+  }
+
+  // Add a value to the back of the stream. Synchronous streams grow the ring
+  // buffer if it is full, while asynchronous streams wait for the reader to
+  // make room, dropping the value if the stream is stopped meanwhile.
+  void Push(T value) {
+    if (!async_) {
+      if (Full()) Grow();
+    } else if (Full()) {
+      // Let readers know that the producer waits for them, until they make
+      // room, before producing any more.
+      blocked_.store(true, std::memory_order_relaxed);
+      Notify();
+      Wait([this] { return !Full() || stop_.load(std::memory_order_relaxed); });
+      blocked_.store(false, std::memory_order_relaxed);
+      if (stop_.load(std::memory_order_relaxed)) return;
+    }
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    ring_[Slot(tail)] = std::move(value);
+    tail_.store(tail + 1, std::memory_order_release);
+    if (async_) Notify();
+  }
+
+  // Whether the ring buffer is full.
+  bool Full() const {
+    return tail_.load(std::memory_order_relaxed) -
+               head_.load(std::memory_order_acquire) ==
+           ring_.size();
+  }
+
+  // Whether the producer of an asynchronous stream waits for readers to make
+  // room in the full ring buffer. It is only cleared before producing more, so
+  // readers that see the producer's latest values also see it cleared.
+  bool Blocked() const {
+    return Size() == ring_.size() && blocked_.load(std::memory_order_relaxed);
+  }
+
+  // Double the capacity of the ring buffer of a synchronous stream. Values
+  // keep their indices, so readers keep their positions.
+  void Grow() {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    std::vector<T> ring(2 * ring_.size());
+    for (size_t i = Head(); i < tail; ++i) {
+      ring[i & (ring.size() - 1)] = std::move(ring_[Slot(i)]);
+    }
+    ring_ = std::move(ring);
+  }
+
+  // Block until `done()` holds, waiting for the other end of an asynchronous
+  // stream to Notify() of its progress. Waiters are counted so that notifying
+  // is cheap while nobody waits, and the fences make sure that either the
+  // waiter sees the progress, or the notifier sees the waiter.
+  template <typename Predicate>
+  void Wait(Predicate done) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiters_.fetch_add(1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    progress_.wait(lock, done);
+    waiters_.fetch_sub(1u, std::memory_order_relaxed);
+  }
+
+  // Wake up the other end of an asynchronous stream, if it is waiting for
+  // progress made by this end.
+  void Notify() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) == 0u) return;
+    { std::lock_guard<std::mutex> lock(mutex_); }
+    progress_.notify_all();
+  }
+
+  std::vector<T> ring_;
+  std::atomic<size_t> head_ = 0u;
+  std::atomic<size_t> tail_ = 0u;
+
+  // Statistics, only collected if enabled (see kStreamStats).
+  StreamStats stats_;
+
+  // Index of the next value to read for each reader, by reader id, or
+  // kNoCursor for ids not in use.
+  std::vector<size_t> cursors_;
+
+  // Whether the producer is finished. It is possible for the producer to be
+  // finished producing values while the stream buffer is still non-empty.
+  std::atomic<bool> finished_ = false;
+
+  // Whether the stream is filled asynchronously, whether its producer thread
+  // has been asked to stop, and whether it is blocked (see Blocked()).
+  bool async_ = false;
+  std::atomic<bool> stop_ = false;
+  std::atomic<bool> blocked_ = false;
+
+  // For the reader and producer thread of an asynchronous stream to wait for
+  // each other (see Wait()).
+  std::mutex mutex_;
+  std::condition_variable progress_;
+  std::atomic<size_t> waiters_ = 0u;
 };
 
-#include <stdio.h>
-// A simple synchronous pull stream.
+// Appends values produced by a stream's producer directly into the free span
+// of the stream's ring buffer. For synchronous streams, the ring buffer only
+// grows if a single fill produces more values than there is room for. For
+// asynchronous streams, appending waits for the reader to make room.
 template <typename T>
-class Stream {
+class StreamSink {
+ public:
+  explicit StreamSink(StreamQueue<T>* queue) : queue_(queue) {}
+
+  // Append a value to the stream.
+  void push_back(T value) { queue_->Push(std::move(value)); }
+  template <typename... Args>
+  void emplace_back(Args&&... args) {
+    queue_->Push(T(std::forward<Args>(args)...));
+  }
+
+ private:
+  StreamQueue<T>* queue_;
+};
+
+// A simple pull stream, buffering values in a ring buffer. Synchronous by
+// default, filling the stream on the reader's thread when it is read from.
+// Asynchronous streams instead fill the stream on a producer thread of their
+// own, which runs ahead of the reader until the ring buffer is full.
+//
+// The stream is filled by calling a `Producer`, which is any callable taking a
+// StreamSink<T>* (see AnyProducer). Streams of a concrete producer type call
+// it directly, so it can be inlined into readers, while the default is a
+// type-erased std::function.
+template <typename T, typename Producer>
+class Stream : public StreamQueue<T> {
  public:
   // A function that when called fills up a container of more values to put into
   // the stream.
   using FillCallback = std::function<bool(std::vector<T>*)>;
 
-  // Initialize a stream with a fill callback and min buffer size. The read
-  // callback fills the stream with values, when requested by a reader.
+  // As above, but appends values directly to the stream. Returns false once
+  // the producer is finished.
+  using SinkCallback = AnyProducer<T>;
+
+  // Initialize a stream with a producer and min buffer size. The producer
+  // fills the stream with values, when requested by a reader. Values are
+  // buffered in a ring buffer of at least twice `min_buffer_size`, so that
+  // refilling the stream does not allocate, unless a single fill produces
+  // more values than that.
+  Stream(Producer producer, size_t min_buffer_size = 10)
+      : StreamQueue<T>(min_buffer_size),
+        producer_(std::move(producer)),
+        min_buffer_size_(min_buffer_size) {}
+
+  // As above, with values filled into a vector first, which is reused across
+  // fills. Only for type-erased producers.
   Stream(FillCallback callback, size_t min_buffer_size = 10)
-      : callback_(callback), min_buffer_size_(min_buffer_size) {}
+      : Stream(
+            [callback = std::move(callback), values = std::vector<T>()](
+                StreamSink<T>* sink) mutable {
+              values.clear();
+              const bool more = callback(&values);
+              for (T& value : values) sink->push_back(std::move(value));
+              return more;
+            },
+            min_buffer_size) {}
 
-  // Make a new reader.
-  StreamReader<T> MakeReader() { return {this}; }
+  Stream(const Stream&) = delete;
+  Stream& operator=(const Stream&) = delete;
+  ~Stream() { Stop(); }
 
-  // Is the producer finished?
-  bool Finished() const { return finished_; }
-  // Is the remaining stream buffer empty?
-  bool Empty() const { return stream_.empty(); }
-  // Is the stream depleted? i.e. the producer is finished and the buffer is
-  // empty.
-  bool Depleted() const { return Finished() && Empty(); }
+  // Whether to fill the stream asynchronously, on a dedicated producer thread
+  // that is started once the stream is next read from. The producer then runs
+  // concurrently with readers, so it must not share unsynchronized state with
+  // them. Readers only wait for the producer when the stream is empty, and
+  // exceptions thrown by the producer are rethrown to the reader once it has
+  // read all values produced before them. Values already in the stream are
+  // kept when switching modes, but a running producer thread may drop the
+  // value it was producing when stopped, so switch modes before reading from
+  // the stream, or once it is cleared.
+  void SetAsync(bool async) {
+    Stop();
+    this->async_ = async;
+  }
 
-  // Clear the stream.
+  // Make a new reader, positioned at the oldest value still in the stream.
+  StreamReader<T, Producer> MakeReader() { return {this}; }
+
+  // Clear the stream, stopping the producer thread of an asynchronous stream.
+  // A producer that is blocked producing values (e.g. reading input) is waited
+  // for.
   void Clear() {
-    stream_ = {};
-    finished_ = false;
+    Stop();
+    this->Reset();
+    error_ = nullptr;
   }
 
  private:
-  friend class StreamReader<T>;
+  friend class StreamReader<T, Producer>;
 
-  // Called by readers. Requests new values to be inserted into the queue by
-  // the producer callback.
-  void Fill() {
-    std::vector<T> values;
-    while (stream_.size() < min_buffer_size_ && !finished_) {
-      values.clear();
-      finished_ = !callback_(&values);
-      for (T& value : values) stream_.push(std::move(value));
+  // Called by reader `id`. Requests new values to be inserted into the ring
+  // buffer by the producer, until the reader has at least `count` values (and
+  // no less than the min buffer size) to read. Asynchronous streams instead
+  // wait for the producer thread, until it either produced `count` values for
+  // the reader or finished.
+  void Fill(size_t id, size_t count) {
+    if constexpr (kStreamStats) {
+      const auto start = std::chrono::steady_clock::now();
+      FillImpl(id, count);
+      ++this->stats_.fills;
+      this->stats_.fill_time += std::chrono::steady_clock::now() - start;
+    } else {
+      FillImpl(id, count);
     }
   }
 
-  // Callback to use to fill stream buffer.
-  FillCallback callback_;
+  void FillImpl(size_t id, size_t count) {
+    if (!this->async_) {
+      StreamSink<T> sink(this);
+      const size_t min_size = std::max(count, min_buffer_size_);
+      while (this->Size(id) < min_size && !this->Finished()) {
+        this->finished_.store(!Produce(&sink), std::memory_order_relaxed);
+      }
+      return;
+    }
+
+    if (!thread_.joinable() && !this->Finished()) Start();
+
+    // The producer publishes its last values before finishing. If it blocks on
+    // a full ring buffer first, the buffer will never hold enough values for
+    // this reader: either more were requested than it holds, or it is held
+    // back by another reader, which can't catch up while this one waits.
+    auto filled = [&] { return this->Size(id) >= count || this->Finished(); };
+    this->Wait([&] { return filled() || this->Blocked(); });
+    assert((filled() || count <= this->ring_.size()) &&
+           "Looked further ahead than the async stream buffers");
+    assert(filled() && "Async stream readers are too far apart");
+    this->Wait(filled);
+    if (this->Size(id) >= count) return;
+    if (error_ && this->Empty(id)) {
+      std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+  }
+
+  // Start the producer thread of an asynchronous stream, which fills the
+  // stream until the producer is finished, throws, or the stream is stopped.
+  void Start() {
+    thread_ = std::thread([this] {
+      StreamSink<T> sink(this);
+      bool more = true;
+      try {
+        while (more && !this->stop_.load(std::memory_order_relaxed)) {
+          more = Produce(&sink);
+        }
+      } catch (...) {
+        error_ = std::current_exception();
+        more = false;
+      }
+      if (!more) this->finished_.store(true, std::memory_order_release);
+      this->Notify();
+    });
+  }
+
+  // Call the producer, recording statistics if enabled. Returns whether the
+  // producer has more values.
+  bool Produce(StreamSink<T>* sink) {
+    if constexpr (kStreamStats) {
+      StreamStats& stats = this->stats_;
+      const size_t tail = this->tail_.load(std::memory_order_relaxed);
+      const auto start = std::chrono::steady_clock::now();
+      const bool more = producer_(sink);
+      stats.producer_time += std::chrono::steady_clock::now() - start;
+      const size_t new_tail = this->tail_.load(std::memory_order_relaxed);
+      ++stats.producer_calls;
+      stats.produced += new_tail - tail;
+      ++stats.values_per_call[StreamStats::Bucket(new_tail - tail)];
+      stats.peak_occupancy =
+          std::max(stats.peak_occupancy,
+                   new_tail - this->head_.load(std::memory_order_acquire));
+      return more;
+    } else {
+      return producer_(sink);
+    }
+  }
+
+  // Stop the producer thread, if any, and wait for it to exit. The stream is
+  // only finished if the producer actually was.
+  void Stop() {
+    if (!thread_.joinable()) return;
+    this->stop_.store(true, std::memory_order_relaxed);
+    this->Notify();
+    thread_.join();
+    this->stop_.store(false, std::memory_order_relaxed);
+  }
+
+  // Producer to fill stream buffer with.
+  Producer producer_;
 
   // When the stream is read from, refill it to at least this many elements.
   size_t min_buffer_size_;
 
-  // The stream buffer.
-  std::queue<T> stream_;
-
-  // Whether the producer is finished. It is possible for the producer to be
-  // finished producing values while `stream_` is still non-empty.
-  bool finished_ = false;
+  // Thread that fills asynchronous streams, and the exception it threw, if
+  // any.
+  std::thread thread_;
+  std::exception_ptr error_;
 };
\ No newline at end of file
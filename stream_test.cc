@@ -1,5 +1,13 @@
 #include "stream.h"
 
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 TEST(Stream, TestStream) {
@@ -82,4 +90,311 @@ TEST(Stream, TestStream) {
   EXPECT_TRUE(reader.Finished());
   EXPECT_TRUE(reader.Depleted());
   EXPECT_TRUE(reader.Empty());
-}
\ No newline at end of file
+}
+
+TEST(Stream, SinkCallback) {
+  // The producer appends runs of values directly to the stream, longer than
+  // the stream has room for.
+  int value = 0;
+  Stream<int> stream(
+      [&](StreamSink<int>* sink) {
+        for (int i = 0; i < 50; ++i) sink->push_back(value++);
+        return value < 200;
+      },
+      /*min_buffer_size=*/4);
+  StreamReader<int> reader = stream.MakeReader();
+
+  std::vector<int> expected;
+  for (int i = 0; i < 200; ++i) expected.push_back(i);
+  EXPECT_EQ(reader.ReadAll(), expected);
+  EXPECT_TRUE(reader.Depleted());
+}
+
+// Counts to `end`, one value per call.
+struct CountingProducer {
+  int value;
+  int end;
+  bool operator()(StreamSink<int>* sink) {
+    sink->push_back(value++);
+    return value < end;
+  }
+};
+
+TEST(Stream, Producer) {
+  // Synchronously, and asynchronously.
+  for (bool async : {false, true}) {
+    Stream<int, CountingProducer> stream(CountingProducer{3, 40},
+                                         /*min_buffer_size=*/2);
+    stream.SetAsync(async);
+    StreamReader<int, CountingProducer> reader = stream.MakeReader();
+
+    EXPECT_EQ(**reader.Peek(), 3);
+    std::vector<int> expected;
+    for (int i = 3; i < 40; ++i) expected.push_back(i);
+    EXPECT_EQ(reader.ReadAll(), expected);
+    EXPECT_TRUE(reader.Depleted());
+  }
+}
+
+TEST(Stream, Lookahead) {
+  // Synchronously, and asynchronously.
+  for (bool async : {false, true}) {
+    Stream<int, CountingProducer> stream(CountingProducer{0, 10},
+                                         /*min_buffer_size=*/2);
+    stream.SetAsync(async);
+    StreamReader<int, CountingProducer> reader = stream.MakeReader();
+
+    EXPECT_EQ(**reader.PeekN(0), 0);
+    EXPECT_EQ(**reader.PeekN(3), 3);
+    EXPECT_EQ(**reader.Peek(), 0);
+
+    StreamWindow<int> window = reader.Window(4);
+    ASSERT_EQ(window.size(), 4u);
+    for (size_t i = 0; i < window.size(); ++i) EXPECT_EQ(window[i], i);
+
+    int values[3];
+    EXPECT_EQ(reader.ReadBatch(values, 3), 3u);
+    EXPECT_EQ(values[0], 0);
+    EXPECT_EQ(values[2], 2);
+    EXPECT_EQ(reader.ReadBatch(values, 3), 3u);
+    EXPECT_EQ(values[0], 3);
+    EXPECT_EQ(values[2], 5);
+
+    // Less than requested remains.
+    EXPECT_FALSE(reader.PeekN(4).has_value());
+    EXPECT_EQ(**reader.PeekN(3), 9);
+    EXPECT_EQ(reader.Window(4).size(), 4u);
+    EXPECT_EQ(reader.ReadBatch(values, 3), 3u);
+    EXPECT_EQ(reader.Window(4).size(), 1u);
+    EXPECT_EQ(reader.ReadBatch(values, 3), 1u);
+    EXPECT_EQ(values[0], 9);
+    EXPECT_TRUE(reader.Window(4).empty());
+    EXPECT_EQ(reader.ReadBatch(values, 3), 0u);
+    EXPECT_TRUE(reader.Depleted());
+  }
+}
+
+TEST(Stream, Stats) {
+  Stream<int, CountingProducer> stream(CountingProducer{0, 20},
+                                       /*min_buffer_size=*/4);
+  StreamReader<int, CountingProducer> reader = stream.MakeReader();
+  EXPECT_EQ(reader.ReadAll().size(), 20u);
+  const StreamStats stats = reader.stats();
+  if (!kStreamStats) {
+    EXPECT_EQ(stats.fills, 0u);
+    EXPECT_EQ(stats.producer_calls, 0u);
+    return;
+  }
+
+  // Readers fill the stream with 4 values whenever they run out.
+  EXPECT_EQ(stats.fills, 6u);
+  EXPECT_EQ(stats.producer_calls, 20u);
+  EXPECT_EQ(stats.produced, 20u);
+  EXPECT_EQ(stats.values_per_call[StreamStats::Bucket(1)], 20u);
+  EXPECT_EQ(stats.peak_occupancy, 4u);
+  uint64_t reads = 0u;
+  for (uint64_t count : stats.occupancy) reads += count;
+  EXPECT_EQ(reads, 21u);
+  // Readers find 0, 3, 2, then 1 value buffered, and then run out again.
+  EXPECT_EQ(stats.occupancy[StreamStats::Bucket(0)], 6u);
+  EXPECT_EQ(stats.occupancy[StreamStats::Bucket(1)], 5u);
+  EXPECT_EQ(stats.occupancy[StreamStats::Bucket(2)], 10u);
+}
+
+TEST(Stream, MultipleReaders) {
+  Stream<int, CountingProducer> stream(CountingProducer{0, 100},
+                                       /*min_buffer_size=*/2);
+  StreamReader<int, CountingProducer> first = stream.MakeReader();
+  StreamReader<int, CountingProducer> second = stream.MakeReader();
+
+  // Readers read independently, so one may run ahead of the other.
+  EXPECT_EQ(first.Read(), 0);
+  EXPECT_EQ(first.Read(), 1);
+  EXPECT_EQ(**second.Peek(), 0);
+  EXPECT_TRUE(second.Advance());
+
+  // A copy of a reader continues from where the reader is.
+  StreamReader<int, CountingProducer> third = first;
+  EXPECT_EQ(third.Read(), 2);
+  EXPECT_EQ(first.Read(), 2);
+
+  std::vector<int> expected;
+  for (int i = 3; i < 100; ++i) expected.push_back(i);
+  EXPECT_EQ(first.ReadAll(), expected);
+  EXPECT_TRUE(first.Depleted());
+  EXPECT_FALSE(second.Depleted());
+  EXPECT_EQ(third.ReadAll(), expected);
+  expected.insert(expected.begin(), {1, 2});
+  EXPECT_EQ(second.ReadAll(), expected);
+  EXPECT_TRUE(second.Depleted());
+}
+
+TEST(Stream, AsyncMultipleReaders) {
+  Stream<int, CountingProducer> stream(CountingProducer{0, 100},
+                                       /*min_buffer_size=*/2);
+  stream.SetAsync(true);
+  StreamReader<int, CountingProducer> first = stream.MakeReader();
+  StreamReader<int, CountingProducer> second = stream.MakeReader();
+
+  // Readers may run ahead of each other by no more than the stream buffers.
+  for (int i = 0; i < 100; i += 2) {
+    EXPECT_EQ(first.Read(), i);
+    EXPECT_EQ(first.Read(), i + 1);
+    EXPECT_EQ(second.Read(), i);
+    EXPECT_EQ(second.Read(), i + 1);
+  }
+
+  // Reading past the last value waits for the producer to finish.
+  EXPECT_FALSE(first.Read().has_value());
+  EXPECT_FALSE(second.Read().has_value());
+  EXPECT_TRUE(first.Depleted());
+  EXPECT_TRUE(second.Depleted());
+}
+
+TEST(Stream, MultipleReadersRelease) {
+  // Values are released once every reader has read past them.
+  auto value = std::make_shared<int>(5);
+  Stream<std::shared_ptr<int>> stream(
+      [&](StreamSink<std::shared_ptr<int>>* sink) {
+        sink->push_back(value);
+        return false;
+      });
+  StreamReader<std::shared_ptr<int>> first = stream.MakeReader();
+  EXPECT_TRUE(first.Peek());
+  EXPECT_EQ(value.use_count(), 2);
+
+  {
+    StreamReader<std::shared_ptr<int>> second = stream.MakeReader();
+    EXPECT_TRUE(second.Advance());
+    EXPECT_EQ(value.use_count(), 2);
+  }
+  EXPECT_EQ(value.use_count(), 2);
+
+  StreamReader<std::shared_ptr<int>> third = first;
+  // Copied, as the third reader has yet to read it.
+  EXPECT_EQ(**first.Read(), 5);
+  EXPECT_EQ(value.use_count(), 2);
+  // Moved out of the stream, as the last reader to read it.
+  std::optional<std::shared_ptr<int>> last = third.Read();
+  EXPECT_EQ(value.use_count(), 2);
+  last.reset();
+  EXPECT_EQ(value.use_count(), 1);
+  EXPECT_TRUE(first.Depleted());
+  EXPECT_TRUE(third.Depleted());
+}
+
+TEST(Stream, Async) {
+  // The producer counts on its own thread, running ahead of the reader until
+  // the stream is full.
+  constexpr int kCount = 100000;
+  int value = 0;
+  Stream<int> stream(
+      [&](StreamSink<int>* sink) {
+        sink->push_back(value++);
+        sink->emplace_back(value++);
+        return value < kCount;
+      },
+      /*min_buffer_size=*/8);
+  stream.SetAsync(true);
+  StreamReader<int> reader = stream.MakeReader();
+
+  for (int expected = 0; expected < kCount; ++expected) {
+    if (expected % 3 == 0) {
+      auto peeked = reader.Peek();
+      ASSERT_TRUE(peeked.has_value());
+      EXPECT_EQ(*peeked.value(), expected);
+    }
+    std::optional<int> read = reader.Read();
+    ASSERT_TRUE(read.has_value());
+    ASSERT_EQ(read.value(), expected);
+  }
+  EXPECT_FALSE(reader.Read().has_value());
+  EXPECT_TRUE(reader.Finished());
+  EXPECT_TRUE(reader.Depleted());
+  EXPECT_EQ(value, kCount);
+
+  // Clearing the stream starts producing values again.
+  stream.Clear();
+  value = 0;
+  EXPECT_EQ(reader.ReadAll().size(), static_cast<size_t>(kCount));
+}
+
+TEST(Stream, AsyncException) {
+  // Values produced before an exception are read before it is rethrown.
+  int value = 0;
+  Stream<int> stream(
+      [&](StreamSink<int>* sink) {
+        if (value == 3) throw std::runtime_error("Failed to produce");
+        sink->push_back(value++);
+        return true;
+      },
+      /*min_buffer_size=*/1);
+  stream.SetAsync(true);
+  StreamReader<int> reader = stream.MakeReader();
+
+  for (int expected = 0; expected < 3; ++expected) {
+    EXPECT_EQ(reader.Read(), expected);
+  }
+  EXPECT_THROW(reader.Read(), std::runtime_error);
+  EXPECT_TRUE(reader.Depleted());
+  EXPECT_FALSE(reader.Read().has_value());
+}
+
+TEST(Stream, AsyncShutdown) {
+  // Destroying a stream stops its producer, even though it never finishes and
+  // is waiting for room in the stream.
+  int produced = 0;
+  {
+    Stream<int> stream(
+        [&](StreamSink<int>* sink) {
+          sink->push_back(produced++);
+          return true;
+        },
+        /*min_buffer_size=*/2);
+    stream.SetAsync(true);
+    StreamReader<int> reader = stream.MakeReader();
+    EXPECT_EQ(reader.Read(), 0);
+  }
+  EXPECT_GT(produced, 0);
+}
+
+TEST(Stream, AsyncProducerBlocks) {
+  // A producer waiting for room in the stream blocks rather than spinning,
+  // e.g. while the reader has stopped reading after an error.
+  Stream<int, CountingProducer> stream(CountingProducer{0, 1000},
+                                       /*min_buffer_size=*/2);
+  stream.SetAsync(true);
+  StreamReader<int, CountingProducer> reader = stream.MakeReader();
+  EXPECT_EQ(reader.Read(), 0);
+
+  const std::clock_t start = std::clock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  EXPECT_LT(std::clock() - start, CLOCKS_PER_SEC / 20);
+  EXPECT_EQ(reader.ReadAll().size(), 999u);
+}
+
+#ifndef NDEBUG
+TEST(StreamDeathTest, AsyncLookaheadLimits) {
+  // Asynchronous streams can't look further ahead than they buffer, nor let
+  // readers get further apart, without waiting forever.
+  auto look_ahead = [](size_t count) {
+    Stream<int, CountingProducer> stream(CountingProducer{0, 1000},
+                                         /*min_buffer_size=*/2);
+    stream.SetAsync(true);
+    stream.MakeReader().Window(count);
+  };
+  look_ahead(4u);
+  EXPECT_DEATH(look_ahead(5u), "further ahead");
+
+  auto run_ahead = [](size_t count) {
+    Stream<int, CountingProducer> stream(CountingProducer{0, 1000},
+                                         /*min_buffer_size=*/2);
+    stream.SetAsync(true);
+    StreamReader<int, CountingProducer> first = stream.MakeReader();
+    StreamReader<int, CountingProducer> second = stream.MakeReader();
+    for (size_t i = 0; i < count; ++i) first.Read();
+  };
+  run_ahead(4u);
+  EXPECT_DEATH(run_ahead(5u), "too far apart");
+}
+#endif
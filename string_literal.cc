@@ -0,0 +1,178 @@
+#include "string_literal.h"
+
+#include <charconv>
+#include <utility>
+
+namespace {
+// Number of quote characters on either side of a literal's contents.
+size_t QuoteLength(std::string_view quoted) {
+  if (quoted.size() >= 6 && (quoted.substr(0, 3) == "'''" ||
+                             quoted.substr(0, 3) == "\"\"\"")) {
+    return 3u;
+  }
+  return 1u;
+}
+
+// Append `code_point` to `out`, encoded as UTF-8.
+void AppendUtf8(uint32_t code_point, std::string* out) {
+  if (code_point < 0x80) {
+    out->push_back(code_point);
+  } else if (code_point < 0x800) {
+    out->push_back(0xC0 | (code_point >> 6));
+    out->push_back(0x80 | (code_point & 0x3F));
+  } else if (code_point < 0x10000) {
+    out->push_back(0xE0 | (code_point >> 12));
+    out->push_back(0x80 | ((code_point >> 6) & 0x3F));
+    out->push_back(0x80 | (code_point & 0x3F));
+  } else {
+    out->push_back(0xF0 | (code_point >> 18));
+    out->push_back(0x80 | ((code_point >> 12) & 0x3F));
+    out->push_back(0x80 | ((code_point >> 6) & 0x3F));
+    out->push_back(0x80 | (code_point & 0x3F));
+  }
+}
+
+// Parse exactly `length` digits in `base` at the start of `text`, populating
+// `value` on success.
+bool ParseDigits(std::string_view text, size_t length, int base,
+                 uint32_t* value) {
+  if (text.size() < length) return false;
+  const char* end = text.data() + length;
+  const auto [ptr, error] = std::from_chars(text.data(), end, *value, base);
+  return error == std::errc() && ptr == end;
+}
+}  // namespace
+
+/*static*/ uint8_t StringLiteral::ScanFlags(std::string_view raw) {
+  uint8_t flags = 0u;
+  for (char c : raw.substr(0, raw.find_first_of("'\""))) {
+    switch (c) {
+      case 'r':
+      case 'R':
+        flags |= kRaw;
+        break;
+      case 'b':
+      case 'B':
+        flags |= kBytes;
+        break;
+      case 'f':
+      case 'F':
+        flags |= kFormatted;
+        break;
+      case 'u':
+      case 'U':
+        flags |= kUnicode;
+        break;
+    }
+  }
+  if (raw.find('\\') != std::string_view::npos) flags |= kEscapes;
+  return flags;
+}
+
+StringLiteral::StringLiteral(std::string_view raw, uint8_t flags,
+                             SourceBuffer::Ptr source)
+    : raw_(raw), flags_(flags), source_(std::move(source)) {
+  if (!source_) {
+    source_ = SourceBuffer::FromString(std::string(raw));
+    raw_ = source_->text();
+  }
+}
+
+std::string_view StringLiteral::Contents() const {
+  const std::string_view quoted = raw_.substr(raw_.find_first_of("'\""));
+  const size_t quote_length = QuoteLength(quoted);
+  return quoted.substr(quote_length, quoted.size() - 2 * quote_length);
+}
+
+std::string StringLiteral::Decode() const {
+  const std::string_view contents = Contents();
+  if (!has_escapes() || is_raw()) return std::string(contents);
+
+  std::string value;
+  value.reserve(contents.size());
+  for (size_t i = 0; i < contents.size(); ++i) {
+    if (contents[i] != '\\' || i + 1 == contents.size()) {
+      value.push_back(contents[i]);
+      continue;
+    }
+
+    const char escape = contents[++i];
+    const std::string_view rest = contents.substr(i + 1);
+    uint32_t code_point;
+    switch (escape) {
+      case '\n':
+        break;  // Line continuation.
+      case '\\':
+      case '\'':
+      case '"':
+        value.push_back(escape);
+        break;
+      case 'a':
+        value.push_back('\a');
+        break;
+      case 'b':
+        value.push_back('\b');
+        break;
+      case 'f':
+        value.push_back('\f');
+        break;
+      case 'n':
+        value.push_back('\n');
+        break;
+      case 'r':
+        value.push_back('\r');
+        break;
+      case 't':
+        value.push_back('\t');
+        break;
+      case 'v':
+        value.push_back('\v');
+        break;
+      case 'x':
+        if (ParseDigits(rest, 2u, 16, &code_point)) {
+          if (is_bytes()) {
+            value.push_back(code_point);
+          } else {
+            AppendUtf8(code_point, &value);
+          }
+          i += 2;
+        } else {
+          value.append({'\\', escape});
+        }
+        break;
+      case 'u':
+      case 'U': {
+        const size_t length = (escape == 'u' ? 4u : 8u);
+        if (!is_bytes() && ParseDigits(rest, length, 16, &code_point) &&
+            code_point <= 0x10FFFF) {
+          AppendUtf8(code_point, &value);
+          i += length;
+        } else {
+          value.append({'\\', escape});
+        }
+        break;
+      }
+      default: {
+        // Up to three octal digits.
+        size_t length = 0u;
+        while (length < 3 && length < contents.size() - i &&
+               contents[i + length] >= '0' && contents[i + length] <= '7') {
+          ++length;
+        }
+        if (length > 0) {
+          ParseDigits(contents.substr(i), length, 8, &code_point);
+          if (is_bytes()) {
+            value.push_back(code_point);
+          } else {
+            AppendUtf8(code_point, &value);
+          }
+          i += length - 1;
+        } else {
+          value.append({'\\', escape});
+        }
+        break;
+      }
+    }
+  }
+  return value;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "source_buffer.h"
+
+// A python string literal, held as its raw text within the source code, with
+// prefix and quotes included, e.g. `r'\d+'` or `"""docstring"""`. The literal
+// views the source code, which it keeps alive, rather than owning a copy.
+// Stripping quotes and decoding escape sequences is deferred until the value of
+// the literal is actually needed, so literals that are never read cost nothing
+// beyond the view.
+//
+// Example:
+//
+//     StringLiteral literal("b'a\\tb'", StringLiteral::ScanFlags("b'a\\tb'"),
+//                           source);
+//     literal.is_bytes();  // Returns true.
+//     literal.Decode();    // Returns "a\tb".
+//
+class StringLiteral {
+ public:
+  // Prefix flags, and whether the literal contains any backslashes (i.e.
+  // escape sequences, for non-raw literals).
+  enum Flags : uint8_t {
+    kRaw = 1 << 0,        // r, R
+    kBytes = 1 << 1,      // b, B
+    kFormatted = 1 << 2,  // f, F
+    kUnicode = 1 << 3,    // u, U
+    kEscapes = 1 << 4,
+  };
+
+  // Compute the flags of a raw string literal.
+  static uint8_t ScanFlags(std::string_view raw);
+
+  StringLiteral() = default;
+
+  // A literal viewing `raw` text within `source`, which is kept alive. If
+  // `source` is null, the literal holds a copy of `raw` instead.
+  StringLiteral(std::string_view raw, uint8_t flags, SourceBuffer::Ptr source);
+
+  // The raw text of the literal.
+  std::string_view raw() const { return raw_; }
+
+  // Flags of the literal.
+  uint8_t flags() const { return flags_; }
+  bool is_raw() const { return flags_ & kRaw; }
+  bool is_bytes() const { return flags_ & kBytes; }
+  bool is_formatted() const { return flags_ & kFormatted; }
+  bool has_escapes() const { return flags_ & kEscapes; }
+
+  // The text between the quotes of the literal, without decoding escapes.
+  std::string_view Contents() const;
+
+  // Decode the value of the literal, stripping its prefix and quotes, and
+  // decoding escape sequences (unless raw). Unicode escapes are encoded as
+  // UTF-8, and unrecognized escape sequences are left as is. Formatted
+  // literals are not evaluated.
+  std::string Decode() const;
+
+  // Literals compare equal iff their raw text is equal.
+  bool operator==(const StringLiteral& rhs) const { return raw_ == rhs.raw_; }
+  bool operator!=(const StringLiteral& rhs) const { return !(*this == rhs); }
+
+ private:
+  std::string_view raw_;
+  uint8_t flags_ = 0u;
+  SourceBuffer::Ptr source_;
+};
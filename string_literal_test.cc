@@ -0,0 +1,60 @@
+#include "string_literal.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace {
+StringLiteral MakeLiteral(std::string_view raw) {
+  return StringLiteral(raw, StringLiteral::ScanFlags(raw), nullptr);
+}
+}  // namespace
+
+TEST(StringLiteral, Flags) {
+  EXPECT_EQ(StringLiteral::ScanFlags("'text'"), 0u);
+  EXPECT_EQ(StringLiteral::ScanFlags("r'\\d'"),
+            StringLiteral::kRaw | StringLiteral::kEscapes);
+  EXPECT_EQ(StringLiteral::ScanFlags("B\"bytes\""), StringLiteral::kBytes);
+  EXPECT_EQ(StringLiteral::ScanFlags("f'{x}'"), StringLiteral::kFormatted);
+  EXPECT_EQ(StringLiteral::ScanFlags("U'''text'''"), StringLiteral::kUnicode);
+  EXPECT_EQ(StringLiteral::ScanFlags("'a\\nb'"), StringLiteral::kEscapes);
+}
+
+TEST(StringLiteral, ViewsSource) {
+  SourceBuffer::Ptr source = SourceBuffer::FromString("x = 'text'");
+  const std::string_view raw = source->text().substr(4);
+  const StringLiteral literal(raw, StringLiteral::ScanFlags(raw), source);
+  source.reset();
+
+  // The literal keeps the source alive.
+  EXPECT_EQ(literal.raw().data(), raw.data());
+  EXPECT_EQ(literal.raw(), "'text'");
+  EXPECT_EQ(literal.Contents(), "text");
+}
+
+TEST(StringLiteral, Decode) {
+  EXPECT_EQ(MakeLiteral("'text'").Decode(), "text");
+  EXPECT_EQ(MakeLiteral("\"text\"").Decode(), "text");
+  EXPECT_EQ(MakeLiteral("''").Decode(), "");
+  EXPECT_EQ(MakeLiteral("'''it's'''").Decode(), "it's");
+  EXPECT_EQ(MakeLiteral("\"\"\"multi\nline\"\"\"").Decode(), "multi\nline");
+  EXPECT_EQ(MakeLiteral("''''''").Decode(), "");
+
+  // Escapes.
+  EXPECT_EQ(MakeLiteral(R"('a\'b')").Decode(), "a'b");
+  EXPECT_EQ(MakeLiteral(R"('\\\"\a\b\f\n\r\t\v')").Decode(),
+            "\\\"\a\b\f\n\r\t\v");
+  EXPECT_EQ(MakeLiteral(R"('\x41\101\0')").Decode(), std::string("AA\0", 3));
+  EXPECT_EQ(MakeLiteral(R"('é\U0001F600')").Decode(),
+            "\xC3\xA9\xF0\x9F\x98\x80");
+  EXPECT_EQ(MakeLiteral(R"('\xe9')").Decode(), "\xC3\xA9");
+  EXPECT_EQ(MakeLiteral("'''line\\\ncontinuation'''").Decode(),
+            "linecontinuation");
+
+  // Unrecognized and incomplete escapes are left as is.
+  EXPECT_EQ(MakeLiteral(R"('\d\xg\u12')").Decode(), R"(\d\xg\u12)");
+
+  // Raw strings do not decode escapes, and bytes hold raw bytes.
+  EXPECT_EQ(MakeLiteral(R"(r'\d\n')").Decode(), R"(\d\n)");
+  EXPECT_EQ(MakeLiteral(R"(b'\xe9\u00e9')").Decode(), "\xE9\\u00e9");
+}
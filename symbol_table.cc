@@ -0,0 +1,10 @@
+#include "symbol_table.h"
+
+SymbolId SymbolTable::Intern(std::string_view name) {
+  if (auto it = ids_.find(name); it != ids_.end()) return it->second;
+  const SymbolId id = names_.size();
+  const std::string_view stored = storage_.emplace_back(name);
+  names_.push_back(stored);
+  ids_.emplace(stored, id);
+  return id;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Dense integer ID of a symbol interned in a SymbolTable.
+using SymbolId = uint32_t;
+
+// Interns symbol names (e.g. identifiers), handing out dense symbol IDs in
+// order of first occurrence. Each distinct name is stored exactly once, and
+// names interned in the same table are equal iff their symbol IDs are equal.
+// Not thread safe.
+//
+// Example:
+//
+//     SymbolTable symbols;
+//     SymbolId a = symbols.Intern("a");     // Returns 0.
+//     SymbolId b = symbols.Intern("b");     // Returns 1.
+//     SymbolId a2 = symbols.Intern("a");    // Returns 0.
+//     std::string_view name = symbols.Name(b);  // Returns "b".
+//
+class SymbolTable {
+ public:
+  using Ptr = std::shared_ptr<SymbolTable>;
+
+  // Placeholder for values that have not been interned.
+  static constexpr SymbolId kNoSymbol = UINT32_MAX;
+
+  SymbolTable() = default;
+  SymbolTable(const SymbolTable&) = delete;
+  SymbolTable& operator=(const SymbolTable&) = delete;
+
+  // Intern `name`, returning its symbol ID.
+  SymbolId Intern(std::string_view name);
+
+  // The name of an interned symbol.
+  std::string_view Name(SymbolId id) const { return names_[id]; }
+
+  // Number of interned symbols.
+  size_t size() const { return names_.size(); }
+
+ private:
+  // Storage for names, which does not move names as it grows.
+  std::deque<std::string> storage_;
+
+  // Views of names in `storage_`, indexed by symbol ID, and the reverse
+  // mapping.
+  std::vector<std::string_view> names_;
+  std::unordered_map<std::string_view, SymbolId> ids_;
+};
+
+// An identifier for a python variable, function, or class. Identifiers are
+// interned in a symbol table, and compare and hash as their symbol IDs. The
+// symbol table must outlive the identifier.
+struct Identifier {
+  Identifier() = default;
+  Identifier(SymbolId id, const SymbolTable* symbols)
+      : id(id), symbols(symbols) {}
+
+  // The identifier's name.
+  std::string_view name() const { return symbols->Name(id); }
+
+  // Identifiers compare equal iff they are interned in the same symbol table
+  // with the same symbol ID.
+  bool operator==(const Identifier& rhs) const {
+    return id == rhs.id && symbols == rhs.symbols;
+  }
+  bool operator!=(const Identifier& rhs) const { return !(*this == rhs); }
+
+  SymbolId id = SymbolTable::kNoSymbol;
+  const SymbolTable* symbols = nullptr;
+};
+
+namespace std {
+template <>
+struct hash<Identifier> {
+  size_t operator()(const Identifier& identifier) const {
+    return hash<SymbolId>()(identifier.id);
+  }
+};
+}  // namespace std
@@ -0,0 +1,46 @@
+#include "symbol_table.h"
+
+#include <string>
+#include <unordered_set>
+
+#include "gtest/gtest.h"
+
+TEST(SymbolTable, Intern) {
+  SymbolTable symbols;
+  EXPECT_EQ(symbols.Intern("a"), 0u);
+  EXPECT_EQ(symbols.Intern("b"), 1u);
+  EXPECT_EQ(symbols.Intern("a"), 0u);
+  EXPECT_EQ(symbols.Intern(std::string("b")), 1u);
+  EXPECT_EQ(symbols.Intern("__init__"), 2u);
+  EXPECT_EQ(symbols.size(), 3u);
+
+  EXPECT_EQ(symbols.Name(0), "a");
+  EXPECT_EQ(symbols.Name(1), "b");
+  EXPECT_EQ(symbols.Name(2), "__init__");
+}
+
+TEST(SymbolTable, NamesAreStable) {
+  // Names remain valid as the table grows.
+  SymbolTable symbols;
+  const std::string_view first = symbols.Name(symbols.Intern("first"));
+  for (int i = 0; i < 10000; ++i) symbols.Intern("name" + std::to_string(i));
+  EXPECT_EQ(first, "first");
+  EXPECT_EQ(symbols.Name(symbols.Intern("first")), first);
+  EXPECT_EQ(symbols.Name(symbols.Intern("first")).data(), first.data());
+}
+
+TEST(SymbolTable, Identifiers) {
+  SymbolTable symbols;
+  const Identifier a(symbols.Intern("a"), &symbols);
+  const Identifier b(symbols.Intern("b"), &symbols);
+  EXPECT_EQ(a, Identifier(symbols.Intern("a"), &symbols));
+  EXPECT_NE(a, b);
+  EXPECT_EQ(a.name(), "a");
+
+  // Identifiers from other symbol tables are distinct.
+  SymbolTable other_symbols;
+  EXPECT_NE(a, Identifier(other_symbols.Intern("a"), &other_symbols));
+
+  std::unordered_set<Identifier> identifiers = {a, b, a};
+  EXPECT_EQ(identifiers.size(), 2u);
+}
@@ -2,8 +2,10 @@
 
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <string>
 
+#include "symbol_table.h"
 #include "syntax_tree_node.h"
 #include "syntax_tree_visitor.h"
 
@@ -21,6 +23,9 @@ class SyntaxTree {
   // Parser can access our root node to build the tree.
   friend class Parser;
   SyntaxTreeNode::Ptr root_;
+
+  // Symbol table that identifiers within the tree are interned in.
+  std::shared_ptr<const SymbolTable> symbols_;
 };
 
 std::ostream& operator<<(std::ostream& os, const SyntaxTree& tree);
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -73,6 +74,14 @@ struct SyntaxTreeVisitor;
 struct SyntaxTreeNode {
   using Ptr = std::unique_ptr<SyntaxTreeNode>;
   virtual void Visit(SyntaxTreeVisitor* visitor) = 0;
+
+  // Placeholder for nodes at an unknown offset.
+  static constexpr uint32_t kNoOffset = UINT32_MAX;
+
+  // Byte offset of the node's first token within the source code, or
+  // kNoOffset if unknown (e.g. for module nodes). See LineIndex for mapping
+  // offsets to lines and columns.
+  uint32_t offset = kNoOffset;
 };
 
 // ----------------------------------------------------------------------------
@@ -4,6 +4,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "lexer.h"
+#include "line_index.h"
 #include "parser.h"
 
 SyntaxTree BuildSyntaxTree(std::string source,
@@ -14,6 +15,16 @@ SyntaxTree BuildSyntaxTree(std::string source,
   return std::move(parser).syntax_tree();
 }
 
+SyntaxTree BuildSyntaxTreeFromBuffer(std::string source,
+                                     Parser::Mode mode = Parser::Mode::MODULE) {
+  Lexer lexer(std::move(source));
+  TokenBuffer tokens;
+  lexer.LexInto(&tokens);
+  Parser parser(std::move(tokens), mode);
+  parser.Parse();
+  return std::move(parser).syntax_tree();
+}
+
 void DebugPrint(const std::string& source, const SyntaxTree& tree) {
   std::cout << "---------- Source code ----------\n"
             << source << "\n\n---------- Syntax tree ----------\n"
@@ -79,6 +90,37 @@ TEST(SyntaxTree, BinaryAddition) {
   DebugPrint(source, tree);
 }
 
+TEST(SyntaxTree, NumberConstants) {
+  std::string source =
+      "a = 0x1F + 3.5 - 123456789012345678901234567890 + 1_000 - 0o17";
+  SyntaxTree tree = BuildSyntaxTree(source);
+
+  DebugStringVisitor visitor;
+  tree.Traverse(&visitor);
+  EXPECT_EQ(visitor.str,
+            R"(Module(
+    body=[
+        Assign(
+            targets=[
+                Name(id='a', ctx=Store)],
+            value=BinaryOp(
+                lhs=BinaryOp(
+                    lhs=BinaryOp(
+                        lhs=BinaryOp(
+                            lhs=Constant(value=Int: 31),
+                            op=Add,
+                            rhs=Constant(value=Double: 3.500000)),
+                        op=Subtract,
+                        rhs=Constant(value=Int: 123456789012345678901234567890)),
+                    op=Add,
+                    rhs=Constant(value=Int: 1000)),
+                op=Subtract,
+                rhs=Constant(value=Int: 15)))])
+)");
+
+  DebugPrint(source, tree);
+}
+
 TEST(SyntaxTree, Delete) {
   std::string source = "del a, Foo, bar";
 
@@ -395,4 +437,157 @@ else:
 )");
 
   DebugPrint(source, tree);
-}
\ No newline at end of file
+}
+TEST(SyntaxTree, ParseTokenBuffer) {
+  std::string source =
+R"(
+if a == 5:
+    b = c + 2 * d
+elif e is not f:
+    del g, h
+else:
+    i < j not in k
+)";
+
+  // Parsing from a token buffer builds the same tree as parsing from a stream.
+  DebugStringVisitor stream_visitor;
+  BuildSyntaxTree(source).Traverse(&stream_visitor);
+  DebugStringVisitor buffer_visitor;
+  BuildSyntaxTreeFromBuffer(source).Traverse(&buffer_visitor);
+  EXPECT_EQ(buffer_visitor.str, stream_visitor.str);
+
+  // Likewise for parsing while lexing on another thread.
+  Lexer lexer;
+  lexer.SetAsync(true);
+  lexer.SetSource(source);
+  Parser parser(lexer.TokenStream());
+  parser.Parse();
+  DebugStringVisitor async_visitor;
+  parser.syntax_tree().Traverse(&async_visitor);
+  EXPECT_EQ(async_visitor.str, stream_visitor.str);
+
+  std::cout << buffer_visitor.str << "\n";
+}
+
+TEST(SyntaxTree, ParseErrors) {
+  struct Case {
+    std::string source;
+    ErrorCode code;
+    uint32_t offset;
+  };
+  for (const Case& c : {
+           Case{"a = (\n", ErrorCode::UNEXPECTED_TOKEN, 4u},
+           Case{"a b\n", ErrorCode::UNEXPECTED_TOKEN, 2u},
+           Case{"del 5\n", ErrorCode::EXPECTED_TOKEN, 4u},
+           Case{"if a\n    b\n", ErrorCode::EXPECTED_TOKEN, 4u},
+       }) {
+    SCOPED_TRACE(c.source);
+    Lexer lexer(c.source);
+    TokenBuffer tokens;
+    lexer.LexInto(&tokens);
+    Parser parser(std::move(tokens));
+    const Status status = parser.TryParse();
+    EXPECT_EQ(status.code(), c.code);
+    EXPECT_EQ(status.offset(), c.offset);
+
+    // The same errors are found parsing from a token stream, and thrown by
+    // Parse().
+    Lexer stream_lexer(c.source);
+    Parser stream_parser(stream_lexer.TokenStream());
+    const Status stream_status = stream_parser.TryParse();
+    EXPECT_EQ(stream_status.code(), c.code);
+    EXPECT_EQ(stream_status.offset(), c.offset);
+    Lexer throwing_lexer(c.source);
+    Parser throwing_parser(throwing_lexer.TokenStream());
+    EXPECT_THROW(throwing_parser.Parse(), std::runtime_error);
+  }
+
+  // Lexing errors end the token stream early, when not thrown.
+  Lexer lexer("a = 1\n  b = 2\n");
+  lexer.SetThrowOnError(false);
+  Parser parser(lexer.TokenStream());
+  EXPECT_TRUE(parser.TryParse().ok());
+  EXPECT_EQ(lexer.status().code(), ErrorCode::UNEXPECTED_INDENTATION);
+}
+
+// Visitor that collects the offset of each node, in pre-order.
+struct OffsetVisitor : public SyntaxTreeVisitor {
+  void Visit(Module* node) override { VisitAll(node->body); }
+  void Visit(Interactive* node) override { VisitAll(node->body); }
+  void Visit(Expression* node) override { node->body->Visit(this); }
+
+  void Visit(Delete* node) override {
+    offsets.push_back(node->offset);
+    VisitAll(node->targets);
+  }
+  void Visit(Assign* node) override {
+    offsets.push_back(node->offset);
+    VisitAll(node->targets);
+    node->value->Visit(this);
+  }
+  void Visit(If* node) override {
+    offsets.push_back(node->offset);
+    node->test->Visit(this);
+    VisitAll(node->then_body);
+    VisitAll(node->else_body);
+  }
+  void Visit(Expr* node) override {
+    offsets.push_back(node->offset);
+    node->expr->Visit(this);
+  }
+
+  void Visit(BinaryOp* node) override {
+    offsets.push_back(node->offset);
+    node->lhs->Visit(this);
+    node->rhs->Visit(this);
+  }
+  void Visit(UnaryOp* node) override {
+    offsets.push_back(node->offset);
+    node->operand->Visit(this);
+  }
+  void Visit(Compare* node) override {
+    offsets.push_back(node->offset);
+    node->lhs->Visit(this);
+    VisitAll(node->comparators);
+  }
+  void Visit(Constant* node) override { offsets.push_back(node->offset); }
+  void Visit(Name* node) override { offsets.push_back(node->offset); }
+
+  template <typename T>
+  void VisitAll(const std::vector<T>& nodes) {
+    for (const auto& node : nodes) node->Visit(this);
+  }
+
+  std::vector<uint32_t> offsets;
+};
+
+TEST(SyntaxTree, NodeOffsets) {
+  const std::string source = "if a < b:\n    del c\na = ~5\nd * 2\n";
+  const std::vector<uint32_t> expected = {
+      0u,  3u,  3u,  7u,   // if a < b:
+      14u, 18u,            //     del c
+      20u, 20u, 24u, 25u,  // a = ~5
+      27u, 27u, 27u, 31u,  // d * 2
+  };
+
+  // Nodes are at the offset of their first token, whether parsed from a
+  // token buffer or a token stream.
+  Lexer lexer(source);
+  TokenBuffer tokens;
+  lexer.LexInto(&tokens);
+  Parser parser(std::move(tokens));
+  parser.Parse();
+  OffsetVisitor visitor;
+  parser.syntax_tree().Traverse(&visitor);
+  EXPECT_EQ(visitor.offsets, expected);
+
+  Lexer stream_lexer(source);
+  Parser stream_parser(stream_lexer.TokenStream());
+  stream_parser.Parse();
+  OffsetVisitor stream_visitor;
+  stream_parser.syntax_tree().Traverse(&stream_visitor);
+  EXPECT_EQ(stream_visitor.offsets, expected);
+
+  const LineIndex lines(source);
+  EXPECT_EQ(lines.Locate(expected[4]), (SourceLocation{2, 5}));
+}
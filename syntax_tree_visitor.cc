@@ -9,15 +9,18 @@ constexpr size_t kIndentationWidth = 4;
 // Helper conversion from `ConstantValue` type to string.
 std::string ConstantValueString(const ConstantValue& constant) {
   struct DebugVisitor {
-    std::string operator()(std::string value) {
-      return "String: " + std::move(value);
+    std::string operator()(const StringLiteral& value) {
+      return "String: " + std::string(value.raw());
     }
     std::string operator()(double value) {
       return "Double: " + std::to_string(value);
     }
-    std::string operator()(int value) {
+    std::string operator()(int64_t value) {
       return "Int: " + std::to_string(value);
     }
+    std::string operator()(const BigInt& value) {
+      return "Int: " + value.digits;
+    }
     std::string operator()(bool value) {
       return std::string("Bool: ") + (value ? "true" : "false");
     }
@@ -271,7 +274,7 @@ void DebugStringVisitor::Visit(Constant* node) {
 
 void DebugStringVisitor::Visit(Name* node) {
   Append("Name(id='");
-  Append(node->id);
+  Append(std::string(node->id.name()));
   Append("', ctx=");
   Append([&] {
     switch (node->ctx_type) {
@@ -1,15 +1,20 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <iostream>
 #include <optional>
 #include <string>
 #include <string_view>
-#include <unordered_map>
+#include <variant>
+
+#include "source_buffer.h"
+#include "symbol_table.h"
 
 struct Token {
   // TODO(erik): Handle soft keywords such as `match`, `case`, `_`:
   // https://docs.python.org/3/reference/lexical_analysis.html#soft-keywords
-  enum class Type {
+  enum class Type : uint8_t {
     // Indentation.
     INDENT,   // @idt
     DEDENT,   // @ddt
@@ -132,10 +137,14 @@ struct Token {
       static_cast<size_t>(Type::LEFT_PAREN);
   static constexpr size_t kDelimiterEnd =
       static_cast<size_t>(Type::POWER_ASSIGN);
+  static constexpr size_t kNumTypes = kDelimiterEnd + 1;
+
+  // Placeholder for tokens at an unknown offset.
+  static constexpr uint32_t kNoOffset = UINT32_MAX;
 
   // Constructors.
   Token() = default;
-  Token(Type type, std::optional<std::string> value = std::nullopt);
+  Token(Type type, std::optional<std::string_view> value = std::nullopt);
 
   // The token string, e.g. an AWAIT token would return 'await'. For token
   // types that do not have an associated keyword, such as INDENT, DEDENT,
@@ -163,16 +172,144 @@ struct Token {
   // The type of token.
   Type type;
 
-  // The token's value. Populated for literals and identifiers.
-  std::optional<std::string> value;
+  // Byte offset of the token within the source code it was lexed from, or
+  // kNoOffset if unknown (e.g. for tokens created some other way, or beyond
+  // the first 4GiB of source code). Packed next to `type`, so that it takes no
+  // extra space. See LineIndex for mapping offsets to lines and columns. Not
+  // part of comparisons.
+  uint32_t offset = kNoOffset;
+
+  // The token's value. Populated for literals and identifiers. This is a
+  // slice of the source code the token was lexed from, and does not own its
+  // text (see SourceBuffer).
+  std::optional<std::string_view> value;
+
+  // Keeps the source code viewed by `value` alive, for tokens lexed from
+  // source code that nothing else keeps alive (e.g. chunked input, which the
+  // lexer discards as it goes), and for STRING tokens, whose string literals
+  // outlive the token. Otherwise null. Not part of comparisons.
+  SourceBuffer::Ptr source;
+
+  // The numeric value of INTEGER and FLOAT tokens, converted while lexing.
+  // Integers too large for int64_t are left unconverted, so that tokens stay
+  // small, and are converted from `value` on demand instead (see
+  // ConvertIntegerLiteral()). Not part of comparisons.
+  std::variant<std::monostate, int64_t, double> number;
+
+  // Flags of STRING tokens, computed while lexing (see StringLiteral::Flags).
+  // Not part of comparisons.
+  uint8_t string_flags = 0u;
+
+  // The symbol ID of an identifier token's value, if interned while lexing
+  // (see Lexer::SetSymbolTable). Not part of comparisons.
+  SymbolId symbol = SymbolTable::kNoSymbol;
 };
 
 // Print token to ostream.
 std::ostream& operator<<(std::ostream& os, const Token& token);
 
-// Mapping from string to token type and vice versa.
-extern const std::unordered_map<std::string, Token::Type> kTokenStringToType;
-extern const std::unordered_map<Token::Type, std::string> kTokenTypeToString;
+// Mapping from token type to token string, indexed by type. This is the single
+// source of truth for token strings, backing Token::String() as well as the
+// keyword and operator matchers in the lexer. Token types that have no
+// corresponding string use a placeholder debug string (e.g. '@idt').
+inline constexpr std::array<std::string_view, Token::kNumTypes> kTokenStrings =
+    [] {
+      std::array<std::string_view, Token::kNumTypes> strings = {};
+      auto set = [&](Token::Type type, std::string_view string) {
+        strings[static_cast<size_t>(type)] = string;
+      };
+      set(Token::Type::INDENT, "@idt");
+      set(Token::Type::DEDENT, "@ddt");
+      set(Token::Type::NEWLINE, "@eol");
+      set(Token::Type::AND, "and");
+      set(Token::Type::AS, "as");
+      set(Token::Type::ASSERT, "assert");
+      set(Token::Type::ASYNC, "async");
+      set(Token::Type::AWAIT, "await");
+      set(Token::Type::BREAK, "break");
+      set(Token::Type::CLASS, "class");
+      set(Token::Type::CONTINUE, "continue");
+      set(Token::Type::DEF, "def");
+      set(Token::Type::DEL, "del");
+      set(Token::Type::ELIF, "elif");
+      set(Token::Type::ELSE, "else");
+      set(Token::Type::EXCEPT, "except");
+      set(Token::Type::FALSE, "False");
+      set(Token::Type::FINALLY, "finally");
+      set(Token::Type::FOR, "for");
+      set(Token::Type::FROM, "from");
+      set(Token::Type::GLOBAL, "global");
+      set(Token::Type::IF, "if");
+      set(Token::Type::IMPORT, "import");
+      set(Token::Type::IN, "in");
+      set(Token::Type::IS, "is");
+      set(Token::Type::IS_NOT, "is not");
+      set(Token::Type::LAMBDA, "lambda");
+      set(Token::Type::NONE, "None");
+      set(Token::Type::NONLOCAL, "nonlocal");
+      set(Token::Type::NOT, "not");
+      set(Token::Type::NOT_IN, "not in");
+      set(Token::Type::OR, "or");
+      set(Token::Type::PASS, "pass");
+      set(Token::Type::RAISE, "raise");
+      set(Token::Type::RETURN, "return");
+      set(Token::Type::TRUE, "True");
+      set(Token::Type::TRY, "try");
+      set(Token::Type::WHILE, "while");
+      set(Token::Type::WITH, "with");
+      set(Token::Type::YIELD, "yield");
+      set(Token::Type::IDENTIFIER, "@nam");
+      set(Token::Type::INTEGER, "@int");
+      set(Token::Type::FLOAT, "@flt");
+      set(Token::Type::STRING, "@str");
+      set(Token::Type::PLUS, "+");
+      set(Token::Type::MINUS, "-");
+      set(Token::Type::MULTIPLY, "*");
+      set(Token::Type::POWER, "**");
+      set(Token::Type::DIVIDE, "/");
+      set(Token::Type::FLOOR_DIVIDE, "//");
+      set(Token::Type::MODULO, "%");
+      set(Token::Type::MATMUL, "@");
+      set(Token::Type::LEFT_SHIFT, "<<");
+      set(Token::Type::RIGHT_SHIFT, ">>");
+      set(Token::Type::BITWISE_AND, "&");
+      set(Token::Type::BITWISE_OR, "|");
+      set(Token::Type::BITWISE_XOR, "^");
+      set(Token::Type::INVERT, "~");
+      set(Token::Type::NAMED_EXPR, ":=");
+      set(Token::Type::LESS_THAN, "<");
+      set(Token::Type::GREATER_THAN, ">");
+      set(Token::Type::LESS_EQUAL, "<=");
+      set(Token::Type::GREATER_EQUAL, ">=");
+      set(Token::Type::EQUALS, "==");
+      set(Token::Type::NOT_EQUALS, "!=");
+      set(Token::Type::LEFT_PAREN, "(");
+      set(Token::Type::RIGHT_PAREN, ")");
+      set(Token::Type::LEFT_BRACKET, "[");
+      set(Token::Type::RIGHT_BRACKET, "]");
+      set(Token::Type::LEFT_BRACE, "{");
+      set(Token::Type::RIGHT_BRACE, "}");
+      set(Token::Type::COMMA, ",");
+      set(Token::Type::COLON, ":");
+      set(Token::Type::ATTRIBUTE, ".");
+      set(Token::Type::SEMICOLON, ";");
+      set(Token::Type::ASSIGN, "=");
+      set(Token::Type::ANNOTATE, "->");
+      set(Token::Type::PLUS_ASSIGN, "+=");
+      set(Token::Type::MINUS_ASSIGN, "-=");
+      set(Token::Type::MULTIPLY_ASSIGN, "*=");
+      set(Token::Type::DIVIDE_ASSIGN, "/=");
+      set(Token::Type::FLOOR_DIVIDE_ASSIGN, "//=");
+      set(Token::Type::MODULO_ASSIGN, "%=");
+      set(Token::Type::MATMUL_ASSIGN, "@=");
+      set(Token::Type::AND_ASSIGN, "&=");
+      set(Token::Type::OR_ASSIGN, "|=");
+      set(Token::Type::XOR_ASSIGN, "^=");
+      set(Token::Type::RIGHT_SHIFT_ASSIGN, ">>=");
+      set(Token::Type::LEFT_SHIFT_ASSIGN, "<<=");
+      set(Token::Type::POWER_ASSIGN, "**=");
+      return strings;
+    }();
 
 // Helpers for token subtype.
 bool IsIndentation(Token::Type type);
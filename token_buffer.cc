@@ -0,0 +1,66 @@
+#include "token_buffer.h"
+
+#include <utility>
+#include <variant>
+
+#include "scanner.h"
+
+TokenBuffer::TokenBuffer(SourceBuffer::Ptr source) {
+  Reset(std::move(source));
+}
+
+void TokenBuffer::Reset(SourceBuffer::Ptr source) {
+  source_ = std::move(source);
+  Clear();
+}
+
+void TokenBuffer::Append(const TokenBuffer& tokens) {
+  Append(tokens, 0u, tokens.size());
+}
+
+void TokenBuffer::Append(const TokenBuffer& tokens, size_t begin, size_t end) {
+  types_.insert(types_.end(), tokens.types_.begin() + begin,
+                tokens.types_.begin() + end);
+  offsets_.insert(offsets_.end(), tokens.offsets_.begin() + begin,
+                  tokens.offsets_.begin() + end);
+  lengths_.insert(lengths_.end(), tokens.lengths_.begin() + begin,
+                  tokens.lengths_.begin() + end);
+  flags_.insert(flags_.end(), tokens.flags_.begin() + begin,
+                tokens.flags_.begin() + end);
+  integers_.insert(integers_.end(), tokens.integers_.begin() + begin,
+                   tokens.integers_.begin() + end);
+}
+
+void TokenBuffer::Clear() {
+  types_.clear();
+  offsets_.clear();
+  lengths_.clear();
+  flags_.clear();
+  integers_.clear();
+}
+
+void TokenBuffer::Reserve(size_t size) {
+  types_.reserve(size);
+  offsets_.reserve(size);
+  lengths_.reserve(size);
+  flags_.reserve(size);
+  integers_.reserve(size);
+}
+
+Token TokenBuffer::operator[](size_t i) const {
+  const Token::Type type = types_[i];
+  Token token(type);
+  token.offset = offsets_[i];
+  if (!IsLiteral(type) && !IsIdentifier(type)) return token;
+
+  token.value = text(i);
+  if (type == Token::Type::INTEGER) {
+    if (!(flags_[i] & kIntegerTooBig)) token.number = integers_[i];
+  } else if (type == Token::Type::FLOAT) {
+    token.number = ConvertFloatLiteral(*token.value);
+  } else if (type == Token::Type::STRING) {
+    token.string_flags = flags_[i];
+    token.source = source_;
+  }
+  return token;
+}
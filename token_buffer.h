@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "source_buffer.h"
+#include "token.h"
+
+// A packed, struct-of-arrays buffer of tokens lexed from a single source
+// buffer. Rather than storing a `Token` per entry, token types, source offsets,
+// lengths, flags and integer values are stored in parallel contiguous arrays,
+// at 18 bytes per token.
+// Token values are recovered on demand as slices of the source buffer, which
+// the token buffer keeps alive.
+//
+// Example:
+//
+//     Lexer lexer("a = 5 * 3 + 2");
+//     TokenBuffer tokens;
+//     lexer.LexInto(&tokens);
+//
+//     for (size_t i = 0; i < tokens.size(); ++i) {
+//       if (tokens.type(i) == Token::Type::IDENTIFIER) {
+//         std::string_view name = tokens.text(i);
+//         ...
+//       }
+//     }
+//
+class TokenBuffer {
+ public:
+  TokenBuffer() = default;
+  explicit TokenBuffer(SourceBuffer::Ptr source);
+
+  // Clear all tokens, and set the source buffer that new tokens are lexed
+  // from.
+  void Reset(SourceBuffer::Ptr source);
+
+  // Flag of INTEGER tokens too large for int64_t, which have no `integer`.
+  static constexpr uint8_t kIntegerTooBig = 1u << 0;
+
+  // Append a token spanning `length` bytes at `offset` within the source.
+  // STRING tokens carry string literal `flags` (see StringLiteral::Flags), and
+  // INTEGER tokens carry their converted `integer` value, or kIntegerTooBig.
+  void Append(Token::Type type, uint32_t offset, uint32_t length,
+              uint8_t flags = 0u, int64_t integer = 0) {
+    types_.push_back(type);
+    offsets_.push_back(offset);
+    lengths_.push_back(length);
+    flags_.push_back(flags);
+    integers_.push_back(integer);
+  }
+
+  // Append all tokens, or tokens [begin, end), from `tokens`, which must be
+  // lexed from the same source.
+  void Append(const TokenBuffer& tokens);
+  void Append(const TokenBuffer& tokens, size_t begin, size_t end);
+
+  // Remove all tokens, keeping the source buffer and allocated capacity.
+  void Clear();
+
+  // Reserve capacity for `size` tokens.
+  void Reserve(size_t size);
+
+  // Number of tokens in the buffer.
+  size_t size() const { return types_.size(); }
+  bool empty() const { return types_.empty(); }
+
+  // Accessors for the i'th token's type, byte offset and length within the
+  // source, flags, integer value, and the source text it spans.
+  Token::Type type(size_t i) const { return types_[i]; }
+  uint32_t offset(size_t i) const { return offsets_[i]; }
+  uint32_t length(size_t i) const { return lengths_[i]; }
+  uint8_t flags(size_t i) const { return flags_[i]; }
+  int64_t integer(size_t i) const { return integers_[i]; }
+  std::string_view text(size_t i) const {
+    return source_->text().substr(offsets_[i], lengths_[i]);
+  }
+
+  // Materialize the i'th token, at its offset within the source. Only literals
+  // and identifiers carry a value.
+  // Number literals carry their numeric value, while string
+  // literals carry the flags found while lexing, and keep the source buffer
+  // alive.
+  Token operator[](size_t i) const;
+
+  // Contiguous arrays of token types, offsets, and lengths.
+  const std::vector<Token::Type>& types() const { return types_; }
+  const std::vector<uint32_t>& offsets() const { return offsets_; }
+  const std::vector<uint32_t>& lengths() const { return lengths_; }
+
+  // The source buffer that tokens were lexed from.
+  const SourceBuffer::Ptr& source() const { return source_; }
+
+ private:
+  SourceBuffer::Ptr source_;
+  std::vector<Token::Type> types_;
+  std::vector<uint32_t> offsets_;
+  std::vector<uint32_t> lengths_;
+  std::vector<uint8_t> flags_;
+  std::vector<int64_t> integers_;
+};
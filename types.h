@@ -1,15 +1,26 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <variant>
 
-// An identifier for a python variable, function, or class.
-using Identifier = std::string;
+#include "string_literal.h"
+#include "symbol_table.h"
+
+// An integer too large to fit in an int64_t, held as a normalized decimal
+// digit string: no leading zeros or underscores, and a leading '-' if
+// negative, e.g. "-123456789012345678901234567890".
+struct BigInt {
+  std::string digits;
+  bool operator==(const BigInt& rhs) const { return digits == rhs.digits; }
+  bool operator!=(const BigInt& rhs) const { return !(*this == rhs); }
+};
 
 // A python constant value can be one of the following types.
 // TODO(erik): Immutable container types (tuples, frozenset).
 struct NoneType {};
-using ConstantValue = std::variant<std::string, int, double, bool, NoneType>;
+using ConstantValue =
+    std::variant<StringLiteral, int64_t, BigInt, double, bool, NoneType>;
 
 // Statically defined python object types. Used in object.h. More types can be
 // defined on the fly, but these enumerate the built-in types.
@@ -0,0 +1,232 @@
+#include "unicode.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "unicode_tables.h"
+
+namespace {
+using unicode_tables::CombiningClassRange;
+using unicode_tables::Composition;
+using unicode_tables::Decomposition;
+using unicode_tables::Range;
+
+// Hangul syllables are composed of leading consonant, vowel and optional
+// trailing consonant jamo, and are decomposed and composed arithmetically.
+constexpr char32_t kSyllableBase = 0xAC00;
+constexpr char32_t kLeadingBase = 0x1100;
+constexpr char32_t kVowelBase = 0x1161;
+constexpr char32_t kTrailingBase = 0x11A7;
+constexpr char32_t kLeadingCount = 19;
+constexpr char32_t kVowelCount = 21;
+constexpr char32_t kTrailingCount = 28;
+constexpr char32_t kSyllableCount =
+    kLeadingCount * kVowelCount * kTrailingCount;
+
+bool IsSyllable(char32_t c) {
+  return c >= kSyllableBase && c < kSyllableBase + kSyllableCount;
+}
+
+// Find the range containing `c` in a sorted table of disjoint ranges, or
+// nullptr if there is none.
+template <typename T, size_t N>
+const T* FindRange(const T (&ranges)[N], char32_t c) {
+  const T* it = std::upper_bound(
+      ranges, ranges + N, c,
+      [](char32_t c, const T& range) { return c < range.first; });
+  if (it == ranges || c > (--it)->last) return nullptr;
+  return it;
+}
+
+uint8_t CombiningClass(char32_t c) {
+  const CombiningClassRange* range =
+      FindRange(unicode_tables::kCombiningClasses, c);
+  return range ? range->combining_class : 0u;
+}
+
+// Append the full compatibility decomposition of `c` to `out`.
+void Decompose(char32_t c, std::u32string* out) {
+  if (IsSyllable(c)) {
+    const char32_t index = c - kSyllableBase;
+    out->push_back(kLeadingBase + index / (kVowelCount * kTrailingCount));
+    out->push_back(kVowelBase +
+                   (index % (kVowelCount * kTrailingCount)) / kTrailingCount);
+    if (index % kTrailingCount != 0) {
+      out->push_back(kTrailingBase + index % kTrailingCount);
+    }
+    return;
+  }
+
+  const auto& decompositions = unicode_tables::kDecompositions;
+  const Decomposition* it = std::lower_bound(
+      std::begin(decompositions), std::end(decompositions), c,
+      [](const Decomposition& d, char32_t c) { return d.code_point < c; });
+  if (it == std::end(decompositions) || it->code_point != c) {
+    out->push_back(c);
+    return;
+  }
+  const uint32_t* data = unicode_tables::kDecompositionData + it->offset;
+  out->append(data, data + it->length);
+}
+
+// Compose `first` and `second` into their primary composite, returning whether
+// there is one.
+bool ComposePair(char32_t first, char32_t second, char32_t* composite) {
+  if (first >= kLeadingBase && first < kLeadingBase + kLeadingCount &&
+      second >= kVowelBase && second < kVowelBase + kVowelCount) {
+    *composite = kSyllableBase + ((first - kLeadingBase) * kVowelCount +
+                                  (second - kVowelBase)) *
+                                     kTrailingCount;
+    return true;
+  }
+  if (IsSyllable(first) && (first - kSyllableBase) % kTrailingCount == 0 &&
+      second > kTrailingBase && second < kTrailingBase + kTrailingCount) {
+    *composite = first + (second - kTrailingBase);
+    return true;
+  }
+
+  const auto& compositions = unicode_tables::kCompositions;
+  const auto key = std::make_pair(first, second);
+  const Composition* it = std::lower_bound(
+      std::begin(compositions), std::end(compositions), key,
+      [](const Composition& c, const std::pair<char32_t, char32_t>& key) {
+        return std::make_pair(char32_t{c.first}, char32_t{c.second}) < key;
+      });
+  if (it == std::end(compositions) || it->first != first ||
+      it->second != second) {
+    return false;
+  }
+  *composite = it->composite;
+  return true;
+}
+
+// Sort each run of combining characters by combining class, keeping
+// characters of equal class in order.
+void ReorderCombiningCharacters(std::u32string* chars) {
+  for (size_t i = 1; i < chars->size(); ++i) {
+    const uint8_t combining_class = CombiningClass((*chars)[i]);
+    if (combining_class == 0) continue;
+    for (size_t j = i;
+         j > 0 && CombiningClass((*chars)[j - 1]) > combining_class; --j) {
+      std::swap((*chars)[j], (*chars)[j - 1]);
+    }
+  }
+}
+
+// Canonically compose decomposed, reordered `chars`. Each character is
+// composed with the last starter before it, unless a character in between
+// blocks it.
+void Compose(std::u32string* chars) {
+  constexpr size_t kNoStarter = std::u32string::npos;
+  size_t starter = kNoStarter;
+  uint8_t last_class = 0u;
+  size_t size = 0u;
+  for (const char32_t c : *chars) {
+    const uint8_t combining_class = CombiningClass(c);
+    const bool blocked =
+        size != starter + 1 &&
+        (last_class == 0 || last_class >= combining_class);
+    char32_t composite;
+    if (starter != kNoStarter && !blocked &&
+        ComposePair((*chars)[starter], c, &composite)) {
+      (*chars)[starter] = composite;
+      continue;
+    }
+    if (combining_class == 0) starter = size;
+    last_class = combining_class;
+    (*chars)[size++] = c;
+  }
+  chars->resize(size);
+}
+}  // namespace
+
+size_t DecodeUtf8(std::string_view source, char32_t* c) {
+  if (source.empty()) return 0u;
+  const unsigned char lead = source[0];
+  if (lead < 0x80) {
+    *c = lead;
+    return 1u;
+  }
+
+  // The lead byte determines the length of the encoding, and the smallest
+  // code point that requires that length.
+  size_t length;
+  char32_t value, min;
+  if ((lead & 0xE0) == 0xC0) {
+    length = 2u, value = lead & 0x1F, min = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    length = 3u, value = lead & 0x0F, min = 0x800;
+  } else if ((lead & 0xF8) == 0xF0) {
+    length = 4u, value = lead & 0x07, min = 0x10000;
+  } else {
+    return 0u;
+  }
+  if (source.size() < length) return 0u;
+  for (size_t i = 1; i < length; ++i) {
+    const unsigned char byte = source[i];
+    if ((byte & 0xC0) != 0x80) return 0u;
+    value = (value << 6) | (byte & 0x3F);
+  }
+  if (value < min || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) {
+    return 0u;
+  }
+  *c = value;
+  return length;
+}
+
+void EncodeUtf8(char32_t c, std::string* out) {
+  if (c < 0x80) {
+    out->push_back(static_cast<char>(c));
+  } else if (c < 0x800) {
+    out->push_back(static_cast<char>(0xC0 | (c >> 6)));
+    out->push_back(static_cast<char>(0x80 | (c & 0x3F)));
+  } else if (c < 0x10000) {
+    out->push_back(static_cast<char>(0xE0 | (c >> 12)));
+    out->push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (c & 0x3F)));
+  } else {
+    out->push_back(static_cast<char>(0xF0 | (c >> 18)));
+    out->push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (c & 0x3F)));
+  }
+}
+
+bool IsXidStart(char32_t c) {
+  return FindRange(unicode_tables::kXidStart, c) != nullptr;
+}
+
+bool IsXidContinue(char32_t c) {
+  return FindRange(unicode_tables::kXidContinue, c) != nullptr;
+}
+
+bool IsAscii(std::string_view text) {
+  unsigned char bits = 0u;
+  for (char c : text) bits |= static_cast<unsigned char>(c);
+  return bits < 0x80;
+}
+
+std::string NormalizeNfkc(std::string_view text) {
+  if (IsAscii(text)) return std::string(text);
+
+  std::u32string chars;
+  chars.reserve(text.size());
+  for (size_t idx = 0; idx < text.size();) {
+    char32_t c;
+    const size_t length = DecodeUtf8(text.substr(idx), &c);
+    if (length == 0) {
+      throw std::runtime_error("Encountered invalid UTF-8 in identifier");
+    }
+    Decompose(c, &chars);
+    idx += length;
+  }
+  ReorderCombiningCharacters(&chars);
+  Compose(&chars);
+
+  std::string normalized;
+  normalized.reserve(text.size());
+  for (const char32_t c : chars) EncodeUtf8(c, &normalized);
+  return normalized;
+}
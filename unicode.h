@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Unicode support for identifiers, which may contain any characters with the
+// XID_Start and XID_Continue properties, and which are compared after NFKC
+// normalization, as in python.
+//
+// Example:
+//
+//     char32_t c;
+//     DecodeUtf8("\xC3\xA9t\xC3\xA9", &c);  // Returns 2, c is U+00E9.
+//     IsXidStart(U'\u00E9');           // Returns true.
+//     NormalizeNfkc("\xEF\xAC\x81le");      // Returns "file".
+//
+
+// Decode the UTF-8 encoded code point at the very beginning of `source`,
+// returning the length of its encoding, or 0 if it is not valid UTF-8 (e.g.
+// overlong, a surrogate, or truncated). Populates `c` on success.
+size_t DecodeUtf8(std::string_view source, char32_t* c);
+
+// Append the UTF-8 encoding of `c` to `out`.
+void EncodeUtf8(char32_t c, std::string* out);
+
+// Whether `c` may begin an identifier, i.e. is '_' or has the XID_Start
+// property.
+bool IsXidStart(char32_t c);
+
+// Whether `c` may continue an identifier, i.e. has the XID_Continue property.
+bool IsXidContinue(char32_t c);
+
+// Whether all bytes of `text` are ASCII.
+bool IsAscii(std::string_view text);
+
+// Normalize UTF-8 encoded `text` to normalization form KC. Only characters
+// that may appear in identifiers are decomposed, so `text` should be an
+// identifier. ASCII text is returned unchanged.
+std::string NormalizeNfkc(std::string_view text);
@@ -0,0 +1,3412 @@
+// Generated by gen_unicode_tables.py from Unicode 14.0.0. Do not edit.
+
+#pragma once
+
+#include <cstdint>
+
+namespace unicode_tables {
+struct Range {
+  uint32_t first, last;
+};
+
+struct CombiningClassRange {
+  uint32_t first, last;
+  uint8_t combining_class;
+};
+
+struct Decomposition {
+  uint32_t code_point;
+  uint16_t offset;
+  uint8_t length;
+};
+
+struct Composition {
+  uint32_t first, second, composite;
+};
+
+constexpr Range kXidStart[] = {
+    {0x41, 0x5A}, {0x5F, 0x5F}, {0x61, 0x7A},
+    {0xAA, 0xAA}, {0xB5, 0xB5}, {0xBA, 0xBA},
+    {0xC0, 0xD6}, {0xD8, 0xF6}, {0xF8, 0x2C1},
+    {0x2C6, 0x2D1}, {0x2E0, 0x2E4}, {0x2EC, 0x2EC},
+    {0x2EE, 0x2EE}, {0x370, 0x374}, {0x376, 0x377},
+    {0x37B, 0x37D}, {0x37F, 0x37F}, {0x386, 0x386},
+    {0x388, 0x38A}, {0x38C, 0x38C}, {0x38E, 0x3A1},
+    {0x3A3, 0x3F5}, {0x3F7, 0x481}, {0x48A, 0x52F},
+    {0x531, 0x556}, {0x559, 0x559}, {0x560, 0x588},
+    {0x5D0, 0x5EA}, {0x5EF, 0x5F2}, {0x620, 0x64A},
+    {0x66E, 0x66F}, {0x671, 0x6D3}, {0x6D5, 0x6D5},
+    {0x6E5, 0x6E6}, {0x6EE, 0x6EF}, {0x6FA, 0x6FC},
+    {0x6FF, 0x6FF}, {0x710, 0x710}, {0x712, 0x72F},
+    {0x74D, 0x7A5}, {0x7B1, 0x7B1}, {0x7CA, 0x7EA},
+    {0x7F4, 0x7F5}, {0x7FA, 0x7FA}, {0x800, 0x815},
+    {0x81A, 0x81A}, {0x824, 0x824}, {0x828, 0x828},
+    {0x840, 0x858}, {0x860, 0x86A}, {0x870, 0x887},
+    {0x889, 0x88E}, {0x8A0, 0x8C9}, {0x904, 0x939},
+    {0x93D, 0x93D}, {0x950, 0x950}, {0x958, 0x961},
+    {0x971, 0x980}, {0x985, 0x98C}, {0x98F, 0x990},
+    {0x993, 0x9A8}, {0x9AA, 0x9B0}, {0x9B2, 0x9B2},
+    {0x9B6, 0x9B9}, {0x9BD, 0x9BD}, {0x9CE, 0x9CE},
+    {0x9DC, 0x9DD}, {0x9DF, 0x9E1}, {0x9F0, 0x9F1},
+    {0x9FC, 0x9FC}, {0xA05, 0xA0A}, {0xA0F, 0xA10},
+    {0xA13, 0xA28}, {0xA2A, 0xA30}, {0xA32, 0xA33},
+    {0xA35, 0xA36}, {0xA38, 0xA39}, {0xA59, 0xA5C},
+    {0xA5E, 0xA5E}, {0xA72, 0xA74}, {0xA85, 0xA8D},
+    {0xA8F, 0xA91}, {0xA93, 0xAA8}, {0xAAA, 0xAB0},
+    {0xAB2, 0xAB3}, {0xAB5, 0xAB9}, {0xABD, 0xABD},
+    {0xAD0, 0xAD0}, {0xAE0, 0xAE1}, {0xAF9, 0xAF9},
+    {0xB05, 0xB0C}, {0xB0F, 0xB10}, {0xB13, 0xB28},
+    {0xB2A, 0xB30}, {0xB32, 0xB33}, {0xB35, 0xB39},
+    {0xB3D, 0xB3D}, {0xB5C, 0xB5D}, {0xB5F, 0xB61},
+    {0xB71, 0xB71}, {0xB83, 0xB83}, {0xB85, 0xB8A},
+    {0xB8E, 0xB90}, {0xB92, 0xB95}, {0xB99, 0xB9A},
+    {0xB9C, 0xB9C}, {0xB9E, 0xB9F}, {0xBA3, 0xBA4},
+    {0xBA8, 0xBAA}, {0xBAE, 0xBB9}, {0xBD0, 0xBD0},
+    {0xC05, 0xC0C}, {0xC0E, 0xC10}, {0xC12, 0xC28},
+    {0xC2A, 0xC39}, {0xC3D, 0xC3D}, {0xC58, 0xC5A},
+    {0xC5D, 0xC5D}, {0xC60, 0xC61}, {0xC80, 0xC80},
+    {0xC85, 0xC8C}, {0xC8E, 0xC90}, {0xC92, 0xCA8},
+    {0xCAA, 0xCB3}, {0xCB5, 0xCB9}, {0xCBD, 0xCBD},
+    {0xCDD, 0xCDE}, {0xCE0, 0xCE1}, {0xCF1, 0xCF2},
+    {0xD04, 0xD0C}, {0xD0E, 0xD10}, {0xD12, 0xD3A},
+    {0xD3D, 0xD3D}, {0xD4E, 0xD4E}, {0xD54, 0xD56},
+    {0xD5F, 0xD61}, {0xD7A, 0xD7F}, {0xD85, 0xD96},
+    {0xD9A, 0xDB1}, {0xDB3, 0xDBB}, {0xDBD, 0xDBD},
+    {0xDC0, 0xDC6}, {0xE01, 0xE30}, {0xE32, 0xE32},
+    {0xE40, 0xE46}, {0xE81, 0xE82}, {0xE84, 0xE84},
+    {0xE86, 0xE8A}, {0xE8C, 0xEA3}, {0xEA5, 0xEA5},
+    {0xEA7, 0xEB0}, {0xEB2, 0xEB2}, {0xEBD, 0xEBD},
+    {0xEC0, 0xEC4}, {0xEC6, 0xEC6}, {0xEDC, 0xEDF},
+    {0xF00, 0xF00}, {0xF40, 0xF47}, {0xF49, 0xF6C},
+    {0xF88, 0xF8C}, {0x1000, 0x102A}, {0x103F, 0x103F},
+    {0x1050, 0x1055}, {0x105A, 0x105D}, {0x1061, 0x1061},
+    {0x1065, 0x1066}, {0x106E, 0x1070}, {0x1075, 0x1081},
+    {0x108E, 0x108E}, {0x10A0, 0x10C5}, {0x10C7, 0x10C7},
+    {0x10CD, 0x10CD}, {0x10D0, 0x10FA}, {0x10FC, 0x1248},
+    {0x124A, 0x124D}, {0x1250, 0x1256}, {0x1258, 0x1258},
+    {0x125A, 0x125D}, {0x1260, 0x1288}, {0x128A, 0x128D},
+    {0x1290, 0x12B0}, {0x12B2, 0x12B5}, {0x12B8, 0x12BE},
+    {0x12C0, 0x12C0}, {0x12C2, 0x12C5}, {0x12C8, 0x12D6},
+    {0x12D8, 0x1310}, {0x1312, 0x1315}, {0x1318, 0x135A},
+    {0x1380, 0x138F}, {0x13A0, 0x13F5}, {0x13F8, 0x13FD},
+    {0x1401, 0x166C}, {0x166F, 0x167F}, {0x1681, 0x169A},
+    {0x16A0, 0x16EA}, {0x16EE, 0x16F8}, {0x1700, 0x1711},
+    {0x171F, 0x1731}, {0x1740, 0x1751}, {0x1760, 0x176C},
+    {0x176E, 0x1770}, {0x1780, 0x17B3}, {0x17D7, 0x17D7},
+    {0x17DC, 0x17DC}, {0x1820, 0x1878}, {0x1880, 0x18A8},
+    {0x18AA, 0x18AA}, {0x18B0, 0x18F5}, {0x1900, 0x191E},
+    {0x1950, 0x196D}, {0x1970, 0x1974}, {0x1980, 0x19AB},
+    {0x19B0, 0x19C9}, {0x1A00, 0x1A16}, {0x1A20, 0x1A54},
+    {0x1AA7, 0x1AA7}, {0x1B05, 0x1B33}, {0x1B45, 0x1B4C},
+    {0x1B83, 0x1BA0}, {0x1BAE, 0x1BAF}, {0x1BBA, 0x1BE5},
+    {0x1C00, 0x1C23}, {0x1C4D, 0x1C4F}, {0x1C5A, 0x1C7D},
+    {0x1C80, 0x1C88}, {0x1C90, 0x1CBA}, {0x1CBD, 0x1CBF},
+    {0x1CE9, 0x1CEC}, {0x1CEE, 0x1CF3}, {0x1CF5, 0x1CF6},
+    {0x1CFA, 0x1CFA}, {0x1D00, 0x1DBF}, {0x1E00, 0x1F15},
+    {0x1F18, 0x1F1D}, {0x1F20, 0x1F45}, {0x1F48, 0x1F4D},
+    {0x1F50, 0x1F57}, {0x1F59, 0x1F59}, {0x1F5B, 0x1F5B},
+    {0x1F5D, 0x1F5D}, {0x1F5F, 0x1F7D}, {0x1F80, 0x1FB4},
+    {0x1FB6, 0x1FBC}, {0x1FBE, 0x1FBE}, {0x1FC2, 0x1FC4},
+    {0x1FC6, 0x1FCC}, {0x1FD0, 0x1FD3}, {0x1FD6, 0x1FDB},
+    {0x1FE0, 0x1FEC}, {0x1FF2, 0x1FF4}, {0x1FF6, 0x1FFC},
+    {0x2071, 0x2071}, {0x207F, 0x207F}, {0x2090, 0x209C},
+    {0x2102, 0x2102}, {0x2107, 0x2107}, {0x210A, 0x2113},
+    {0x2115, 0x2115}, {0x2118, 0x211D}, {0x2124, 0x2124},
+    {0x2126, 0x2126}, {0x2128, 0x2128}, {0x212A, 0x2139},
+    {0x213C, 0x213F}, {0x2145, 0x2149}, {0x214E, 0x214E},
+    {0x2160, 0x2188}, {0x2C00, 0x2CE4}, {0x2CEB, 0x2CEE},
+    {0x2CF2, 0x2CF3}, {0x2D00, 0x2D25}, {0x2D27, 0x2D27},
+    {0x2D2D, 0x2D2D}, {0x2D30, 0x2D67}, {0x2D6F, 0x2D6F},
+    {0x2D80, 0x2D96}, {0x2DA0, 0x2DA6}, {0x2DA8, 0x2DAE},
+    {0x2DB0, 0x2DB6}, {0x2DB8, 0x2DBE}, {0x2DC0, 0x2DC6},
+    {0x2DC8, 0x2DCE}, {0x2DD0, 0x2DD6}, {0x2DD8, 0x2DDE},
+    {0x3005, 0x3007}, {0x3021, 0x3029}, {0x3031, 0x3035},
+    {0x3038, 0x303C}, {0x3041, 0x3096}, {0x309D, 0x309F},
+    {0x30A1, 0x30FA}, {0x30FC, 0x30FF}, {0x3105, 0x312F},
+    {0x3131, 0x318E}, {0x31A0, 0x31BF}, {0x31F0, 0x31FF},
+    {0x3400, 0x4DBF}, {0x4E00, 0xA48C}, {0xA4D0, 0xA4FD},
+    {0xA500, 0xA60C}, {0xA610, 0xA61F}, {0xA62A, 0xA62B},
+    {0xA640, 0xA66E}, {0xA67F, 0xA69D}, {0xA6A0, 0xA6EF},
+    {0xA717, 0xA71F}, {0xA722, 0xA788}, {0xA78B, 0xA7CA},
+    {0xA7D0, 0xA7D1}, {0xA7D3, 0xA7D3}, {0xA7D5, 0xA7D9},
+    {0xA7F2, 0xA801}, {0xA803, 0xA805}, {0xA807, 0xA80A},
+    {0xA80C, 0xA822}, {0xA840, 0xA873}, {0xA882, 0xA8B3},
+    {0xA8F2, 0xA8F7}, {0xA8FB, 0xA8FB}, {0xA8FD, 0xA8FE},
+    {0xA90A, 0xA925}, {0xA930, 0xA946}, {0xA960, 0xA97C},
+    {0xA984, 0xA9B2}, {0xA9CF, 0xA9CF}, {0xA9E0, 0xA9E4},
+    {0xA9E6, 0xA9EF}, {0xA9FA, 0xA9FE}, {0xAA00, 0xAA28},
+    {0xAA40, 0xAA42}, {0xAA44, 0xAA4B}, {0xAA60, 0xAA76},
+    {0xAA7A, 0xAA7A}, {0xAA7E, 0xAAAF}, {0xAAB1, 0xAAB1},
+    {0xAAB5, 0xAAB6}, {0xAAB9, 0xAABD}, {0xAAC0, 0xAAC0},
+    {0xAAC2, 0xAAC2}, {0xAADB, 0xAADD}, {0xAAE0, 0xAAEA},
+    {0xAAF2, 0xAAF4}, {0xAB01, 0xAB06}, {0xAB09, 0xAB0E},
+    {0xAB11, 0xAB16}, {0xAB20, 0xAB26}, {0xAB28, 0xAB2E},
+    {0xAB30, 0xAB5A}, {0xAB5C, 0xAB69}, {0xAB70, 0xABE2},
+    {0xAC00, 0xD7A3}, {0xD7B0, 0xD7C6}, {0xD7CB, 0xD7FB},
+    {0xF900, 0xFA6D}, {0xFA70, 0xFAD9}, {0xFB00, 0xFB06},
+    {0xFB13, 0xFB17}, {0xFB1D, 0xFB1D}, {0xFB1F, 0xFB28},
+    {0xFB2A, 0xFB36}, {0xFB38, 0xFB3C}, {0xFB3E, 0xFB3E},
+    {0xFB40, 0xFB41}, {0xFB43, 0xFB44}, {0xFB46, 0xFBB1},
+    {0xFBD3, 0xFC5D}, {0xFC64, 0xFD3D}, {0xFD50, 0xFD8F},
+    {0xFD92, 0xFDC7}, {0xFDF0, 0xFDF9}, {0xFE71, 0xFE71},
+    {0xFE73, 0xFE73}, {0xFE77, 0xFE77}, {0xFE79, 0xFE79},
+    {0xFE7B, 0xFE7B}, {0xFE7D, 0xFE7D}, {0xFE7F, 0xFEFC},
+    {0xFF21, 0xFF3A}, {0xFF41, 0xFF5A}, {0xFF66, 0xFF9D},
+    {0xFFA0, 0xFFBE}, {0xFFC2, 0xFFC7}, {0xFFCA, 0xFFCF},
+    {0xFFD2, 0xFFD7}, {0xFFDA, 0xFFDC}, {0x10000, 0x1000B},
+    {0x1000D, 0x10026}, {0x10028, 0x1003A}, {0x1003C, 0x1003D},
+    {0x1003F, 0x1004D}, {0x10050, 0x1005D}, {0x10080, 0x100FA},
+    {0x10140, 0x10174}, {0x10280, 0x1029C}, {0x102A0, 0x102D0},
+    {0x10300, 0x1031F}, {0x1032D, 0x1034A}, {0x10350, 0x10375},
+    {0x10380, 0x1039D}, {0x103A0, 0x103C3}, {0x103C8, 0x103CF},
+    {0x103D1, 0x103D5}, {0x10400, 0x1049D}, {0x104B0, 0x104D3},
+    {0x104D8, 0x104FB}, {0x10500, 0x10527}, {0x10530, 0x10563},
+    {0x10570, 0x1057A}, {0x1057C, 0x1058A}, {0x1058C, 0x10592},
+    {0x10594, 0x10595}, {0x10597, 0x105A1}, {0x105A3, 0x105B1},
+    {0x105B3, 0x105B9}, {0x105BB, 0x105BC}, {0x10600, 0x10736},
+    {0x10740, 0x10755}, {0x10760, 0x10767}, {0x10780, 0x10785},
+    {0x10787, 0x107B0}, {0x107B2, 0x107BA}, {0x10800, 0x10805},
+    {0x10808, 0x10808}, {0x1080A, 0x10835}, {0x10837, 0x10838},
+    {0x1083C, 0x1083C}, {0x1083F, 0x10855}, {0x10860, 0x10876},
+    {0x10880, 0x1089E}, {0x108E0, 0x108F2}, {0x108F4, 0x108F5},
+    {0x10900, 0x10915}, {0x10920, 0x10939}, {0x10980, 0x109B7},
+    {0x109BE, 0x109BF}, {0x10A00, 0x10A00}, {0x10A10, 0x10A13},
+    {0x10A15, 0x10A17}, {0x10A19, 0x10A35}, {0x10A60, 0x10A7C},
+    {0x10A80, 0x10A9C}, {0x10AC0, 0x10AC7}, {0x10AC9, 0x10AE4},
+    {0x10B00, 0x10B35}, {0x10B40, 0x10B55}, {0x10B60, 0x10B72},
+    {0x10B80, 0x10B91}, {0x10C00, 0x10C48}, {0x10C80, 0x10CB2},
+    {0x10CC0, 0x10CF2}, {0x10D00, 0x10D23}, {0x10E80, 0x10EA9},
+    {0x10EB0, 0x10EB1}, {0x10F00, 0x10F1C}, {0x10F27, 0x10F27},
+    {0x10F30, 0x10F45}, {0x10F70, 0x10F81}, {0x10FB0, 0x10FC4},
+    {0x10FE0, 0x10FF6}, {0x11003, 0x11037}, {0x11071, 0x11072},
+    {0x11075, 0x11075}, {0x11083, 0x110AF}, {0x110D0, 0x110E8},
+    {0x11103, 0x11126}, {0x11144, 0x11144}, {0x11147, 0x11147},
+    {0x11150, 0x11172}, {0x11176, 0x11176}, {0x11183, 0x111B2},
+    {0x111C1, 0x111C4}, {0x111DA, 0x111DA}, {0x111DC, 0x111DC},
+    {0x11200, 0x11211}, {0x11213, 0x1122B}, {0x11280, 0x11286},
+    {0x11288, 0x11288}, {0x1128A, 0x1128D}, {0x1128F, 0x1129D},
+    {0x1129F, 0x112A8}, {0x112B0, 0x112DE}, {0x11305, 0x1130C},
+    {0x1130F, 0x11310}, {0x11313, 0x11328}, {0x1132A, 0x11330},
+    {0x11332, 0x11333}, {0x11335, 0x11339}, {0x1133D, 0x1133D},
+    {0x11350, 0x11350}, {0x1135D, 0x11361}, {0x11400, 0x11434},
+    {0x11447, 0x1144A}, {0x1145F, 0x11461}, {0x11480, 0x114AF},
+    {0x114C4, 0x114C5}, {0x114C7, 0x114C7}, {0x11580, 0x115AE},
+    {0x115D8, 0x115DB}, {0x11600, 0x1162F}, {0x11644, 0x11644},
+    {0x11680, 0x116AA}, {0x116B8, 0x116B8}, {0x11700, 0x1171A},
+    {0x11740, 0x11746}, {0x11800, 0x1182B}, {0x118A0, 0x118DF},
+    {0x118FF, 0x11906}, {0x11909, 0x11909}, {0x1190C, 0x11913},
+    {0x11915, 0x11916}, {0x11918, 0x1192F}, {0x1193F, 0x1193F},
+    {0x11941, 0x11941}, {0x119A0, 0x119A7}, {0x119AA, 0x119D0},
+    {0x119E1, 0x119E1}, {0x119E3, 0x119E3}, {0x11A00, 0x11A00},
+    {0x11A0B, 0x11A32}, {0x11A3A, 0x11A3A}, {0x11A50, 0x11A50},
+    {0x11A5C, 0x11A89}, {0x11A9D, 0x11A9D}, {0x11AB0, 0x11AF8},
+    {0x11C00, 0x11C08}, {0x11C0A, 0x11C2E}, {0x11C40, 0x11C40},
+    {0x11C72, 0x11C8F}, {0x11D00, 0x11D06}, {0x11D08, 0x11D09},
+    {0x11D0B, 0x11D30}, {0x11D46, 0x11D46}, {0x11D60, 0x11D65},
+    {0x11D67, 0x11D68}, {0x11D6A, 0x11D89}, {0x11D98, 0x11D98},
+    {0x11EE0, 0x11EF2}, {0x11FB0, 0x11FB0}, {0x12000, 0x12399},
+    {0x12400, 0x1246E}, {0x12480, 0x12543}, {0x12F90, 0x12FF0},
+    {0x13000, 0x1342E}, {0x14400, 0x14646}, {0x16800, 0x16A38},
+    {0x16A40, 0x16A5E}, {0x16A70, 0x16ABE}, {0x16AD0, 0x16AED},
+    {0x16B00, 0x16B2F}, {0x16B40, 0x16B43}, {0x16B63, 0x16B77},
+    {0x16B7D, 0x16B8F}, {0x16E40, 0x16E7F}, {0x16F00, 0x16F4A},
+    {0x16F50, 0x16F50}, {0x16F93, 0x16F9F}, {0x16FE0, 0x16FE1},
+    {0x16FE3, 0x16FE3}, {0x17000, 0x187F7}, {0x18800, 0x18CD5},
+    {0x18D00, 0x18D08}, {0x1AFF0, 0x1AFF3}, {0x1AFF5, 0x1AFFB},
+    {0x1AFFD, 0x1AFFE}, {0x1B000, 0x1B122}, {0x1B150, 0x1B152},
+    {0x1B164, 0x1B167}, {0x1B170, 0x1B2FB}, {0x1BC00, 0x1BC6A},
+    {0x1BC70, 0x1BC7C}, {0x1BC80, 0x1BC88}, {0x1BC90, 0x1BC99},
+    {0x1D400, 0x1D454}, {0x1D456, 0x1D49C}, {0x1D49E, 0x1D49F},
+    {0x1D4A2, 0x1D4A2}, {0x1D4A5, 0x1D4A6}, {0x1D4A9, 0x1D4AC},
+    {0x1D4AE, 0x1D4B9}, {0x1D4BB, 0x1D4BB}, {0x1D4BD, 0x1D4C3},
+    {0x1D4C5, 0x1D505}, {0x1D507, 0x1D50A}, {0x1D50D, 0x1D514},
+    {0x1D516, 0x1D51C}, {0x1D51E, 0x1D539}, {0x1D53B, 0x1D53E},
+    {0x1D540, 0x1D544}, {0x1D546, 0x1D546}, {0x1D54A, 0x1D550},
+    {0x1D552, 0x1D6A5}, {0x1D6A8, 0x1D6C0}, {0x1D6C2, 0x1D6DA},
+    {0x1D6DC, 0x1D6FA}, {0x1D6FC, 0x1D714}, {0x1D716, 0x1D734},
+    {0x1D736, 0x1D74E}, {0x1D750, 0x1D76E}, {0x1D770, 0x1D788},
+    {0x1D78A, 0x1D7A8}, {0x1D7AA, 0x1D7C2}, {0x1D7C4, 0x1D7CB},
+    {0x1DF00, 0x1DF1E}, {0x1E100, 0x1E12C}, {0x1E137, 0x1E13D},
+    {0x1E14E, 0x1E14E}, {0x1E290, 0x1E2AD}, {0x1E2C0, 0x1E2EB},
+    {0x1E7E0, 0x1E7E6}, {0x1E7E8, 0x1E7EB}, {0x1E7ED, 0x1E7EE},
+    {0x1E7F0, 0x1E7FE}, {0x1E800, 0x1E8C4}, {0x1E900, 0x1E943},
+    {0x1E94B, 0x1E94B}, {0x1EE00, 0x1EE03}, {0x1EE05, 0x1EE1F},
+    {0x1EE21, 0x1EE22}, {0x1EE24, 0x1EE24}, {0x1EE27, 0x1EE27},
+    {0x1EE29, 0x1EE32}, {0x1EE34, 0x1EE37}, {0x1EE39, 0x1EE39},
+    {0x1EE3B, 0x1EE3B}, {0x1EE42, 0x1EE42}, {0x1EE47, 0x1EE47},
+    {0x1EE49, 0x1EE49}, {0x1EE4B, 0x1EE4B}, {0x1EE4D, 0x1EE4F},
+    {0x1EE51, 0x1EE52}, {0x1EE54, 0x1EE54}, {0x1EE57, 0x1EE57},
+    {0x1EE59, 0x1EE59}, {0x1EE5B, 0x1EE5B}, {0x1EE5D, 0x1EE5D},
+    {0x1EE5F, 0x1EE5F}, {0x1EE61, 0x1EE62}, {0x1EE64, 0x1EE64},
+    {0x1EE67, 0x1EE6A}, {0x1EE6C, 0x1EE72}, {0x1EE74, 0x1EE77},
+    {0x1EE79, 0x1EE7C}, {0x1EE7E, 0x1EE7E}, {0x1EE80, 0x1EE89},
+    {0x1EE8B, 0x1EE9B}, {0x1EEA1, 0x1EEA3}, {0x1EEA5, 0x1EEA9},
+    {0x1EEAB, 0x1EEBB}, {0x20000, 0x2A6DF}, {0x2A700, 0x2B738},
+    {0x2B740, 0x2B81D}, {0x2B820, 0x2CEA1}, {0x2CEB0, 0x2EBE0},
+    {0x2F800, 0x2FA1D}, {0x30000, 0x3134A},
+};
+
+constexpr Range kXidContinue[] = {
+    {0x30, 0x39}, {0x41, 0x5A}, {0x5F, 0x5F},
+    {0x61, 0x7A}, {0xAA, 0xAA}, {0xB5, 0xB5},
+    {0xB7, 0xB7}, {0xBA, 0xBA}, {0xC0, 0xD6},
+    {0xD8, 0xF6}, {0xF8, 0x2C1}, {0x2C6, 0x2D1},
+    {0x2E0, 0x2E4}, {0x2EC, 0x2EC}, {0x2EE, 0x2EE},
+    {0x300, 0x374}, {0x376, 0x377}, {0x37B, 0x37D},
+    {0x37F, 0x37F}, {0x386, 0x38A}, {0x38C, 0x38C},
+    {0x38E, 0x3A1}, {0x3A3, 0x3F5}, {0x3F7, 0x481},
+    {0x483, 0x487}, {0x48A, 0x52F}, {0x531, 0x556},
+    {0x559, 0x559}, {0x560, 0x588}, {0x591, 0x5BD},
+    {0x5BF, 0x5BF}, {0x5C1, 0x5C2}, {0x5C4, 0x5C5},
+    {0x5C7, 0x5C7}, {0x5D0, 0x5EA}, {0x5EF, 0x5F2},
+    {0x610, 0x61A}, {0x620, 0x669}, {0x66E, 0x6D3},
+    {0x6D5, 0x6DC}, {0x6DF, 0x6E8}, {0x6EA, 0x6FC},
+    {0x6FF, 0x6FF}, {0x710, 0x74A}, {0x74D, 0x7B1},
+    {0x7C0, 0x7F5}, {0x7FA, 0x7FA}, {0x7FD, 0x7FD},
+    {0x800, 0x82D}, {0x840, 0x85B}, {0x860, 0x86A},
+    {0x870, 0x887}, {0x889, 0x88E}, {0x898, 0x8E1},
+    {0x8E3, 0x963}, {0x966, 0x96F}, {0x971, 0x983},
+    {0x985, 0x98C}, {0x98F, 0x990}, {0x993, 0x9A8},
+    {0x9AA, 0x9B0}, {0x9B2, 0x9B2}, {0x9B6, 0x9B9},
+    {0x9BC, 0x9C4}, {0x9C7, 0x9C8}, {0x9CB, 0x9CE},
+    {0x9D7, 0x9D7}, {0x9DC, 0x9DD}, {0x9DF, 0x9E3},
+    {0x9E6, 0x9F1}, {0x9FC, 0x9FC}, {0x9FE, 0x9FE},
+    {0xA01, 0xA03}, {0xA05, 0xA0A}, {0xA0F, 0xA10},
+    {0xA13, 0xA28}, {0xA2A, 0xA30}, {0xA32, 0xA33},
+    {0xA35, 0xA36}, {0xA38, 0xA39}, {0xA3C, 0xA3C},
+    {0xA3E, 0xA42}, {0xA47, 0xA48}, {0xA4B, 0xA4D},
+    {0xA51, 0xA51}, {0xA59, 0xA5C}, {0xA5E, 0xA5E},
+    {0xA66, 0xA75}, {0xA81, 0xA83}, {0xA85, 0xA8D},
+    {0xA8F, 0xA91}, {0xA93, 0xAA8}, {0xAAA, 0xAB0},
+    {0xAB2, 0xAB3}, {0xAB5, 0xAB9}, {0xABC, 0xAC5},
+    {0xAC7, 0xAC9}, {0xACB, 0xACD}, {0xAD0, 0xAD0},
+    {0xAE0, 0xAE3}, {0xAE6, 0xAEF}, {0xAF9, 0xAFF},
+    {0xB01, 0xB03}, {0xB05, 0xB0C}, {0xB0F, 0xB10},
+    {0xB13, 0xB28}, {0xB2A, 0xB30}, {0xB32, 0xB33},
+    {0xB35, 0xB39}, {0xB3C, 0xB44}, {0xB47, 0xB48},
+    {0xB4B, 0xB4D}, {0xB55, 0xB57}, {0xB5C, 0xB5D},
+    {0xB5F, 0xB63}, {0xB66, 0xB6F}, {0xB71, 0xB71},
+    {0xB82, 0xB83}, {0xB85, 0xB8A}, {0xB8E, 0xB90},
+    {0xB92, 0xB95}, {0xB99, 0xB9A}, {0xB9C, 0xB9C},
+    {0xB9E, 0xB9F}, {0xBA3, 0xBA4}, {0xBA8, 0xBAA},
+    {0xBAE, 0xBB9}, {0xBBE, 0xBC2}, {0xBC6, 0xBC8},
+    {0xBCA, 0xBCD}, {0xBD0, 0xBD0}, {0xBD7, 0xBD7},
+    {0xBE6, 0xBEF}, {0xC00, 0xC0C}, {0xC0E, 0xC10},
+    {0xC12, 0xC28}, {0xC2A, 0xC39}, {0xC3C, 0xC44},
+    {0xC46, 0xC48}, {0xC4A, 0xC4D}, {0xC55, 0xC56},
+    {0xC58, 0xC5A}, {0xC5D, 0xC5D}, {0xC60, 0xC63},
+    {0xC66, 0xC6F}, {0xC80, 0xC83}, {0xC85, 0xC8C},
+    {0xC8E, 0xC90}, {0xC92, 0xCA8}, {0xCAA, 0xCB3},
+    {0xCB5, 0xCB9}, {0xCBC, 0xCC4}, {0xCC6, 0xCC8},
+    {0xCCA, 0xCCD}, {0xCD5, 0xCD6}, {0xCDD, 0xCDE},
+    {0xCE0, 0xCE3}, {0xCE6, 0xCEF}, {0xCF1, 0xCF2},
+    {0xD00, 0xD0C}, {0xD0E, 0xD10}, {0xD12, 0xD44},
+    {0xD46, 0xD48}, {0xD4A, 0xD4E}, {0xD54, 0xD57},
+    {0xD5F, 0xD63}, {0xD66, 0xD6F}, {0xD7A, 0xD7F},
+    {0xD81, 0xD83}, {0xD85, 0xD96}, {0xD9A, 0xDB1},
+    {0xDB3, 0xDBB}, {0xDBD, 0xDBD}, {0xDC0, 0xDC6},
+    {0xDCA, 0xDCA}, {0xDCF, 0xDD4}, {0xDD6, 0xDD6},
+    {0xDD8, 0xDDF}, {0xDE6, 0xDEF}, {0xDF2, 0xDF3},
+    {0xE01, 0xE3A}, {0xE40, 0xE4E}, {0xE50, 0xE59},
+    {0xE81, 0xE82}, {0xE84, 0xE84}, {0xE86, 0xE8A},
+    {0xE8C, 0xEA3}, {0xEA5, 0xEA5}, {0xEA7, 0xEBD},
+    {0xEC0, 0xEC4}, {0xEC6, 0xEC6}, {0xEC8, 0xECD},
+    {0xED0, 0xED9}, {0xEDC, 0xEDF}, {0xF00, 0xF00},
+    {0xF18, 0xF19}, {0xF20, 0xF29}, {0xF35, 0xF35},
+    {0xF37, 0xF37}, {0xF39, 0xF39}, {0xF3E, 0xF47},
+    {0xF49, 0xF6C}, {0xF71, 0xF84}, {0xF86, 0xF97},
+    {0xF99, 0xFBC}, {0xFC6, 0xFC6}, {0x1000, 0x1049},
+    {0x1050, 0x109D}, {0x10A0, 0x10C5}, {0x10C7, 0x10C7},
+    {0x10CD, 0x10CD}, {0x10D0, 0x10FA}, {0x10FC, 0x1248},
+    {0x124A, 0x124D}, {0x1250, 0x1256}, {0x1258, 0x1258},
+    {0x125A, 0x125D}, {0x1260, 0x1288}, {0x128A, 0x128D},
+    {0x1290, 0x12B0}, {0x12B2, 0x12B5}, {0x12B8, 0x12BE},
+    {0x12C0, 0x12C0}, {0x12C2, 0x12C5}, {0x12C8, 0x12D6},
+    {0x12D8, 0x1310}, {0x1312, 0x1315}, {0x1318, 0x135A},
+    {0x135D, 0x135F}, {0x1369, 0x1371}, {0x1380, 0x138F},
+    {0x13A0, 0x13F5}, {0x13F8, 0x13FD}, {0x1401, 0x166C},
+    {0x166F, 0x167F}, {0x1681, 0x169A}, {0x16A0, 0x16EA},
+    {0x16EE, 0x16F8}, {0x1700, 0x1715}, {0x171F, 0x1734},
+    {0x1740, 0x1753}, {0x1760, 0x176C}, {0x176E, 0x1770},
+    {0x1772, 0x1773}, {0x1780, 0x17D3}, {0x17D7, 0x17D7},
+    {0x17DC, 0x17DD}, {0x17E0, 0x17E9}, {0x180B, 0x180D},
+    {0x180F, 0x1819}, {0x1820, 0x1878}, {0x1880, 0x18AA},
+    {0x18B0, 0x18F5}, {0x1900, 0x191E}, {0x1920, 0x192B},
+    {0x1930, 0x193B}, {0x1946, 0x196D}, {0x1970, 0x1974},
+    {0x1980, 0x19AB}, {0x19B0, 0x19C9}, {0x19D0, 0x19DA},
+    {0x1A00, 0x1A1B}, {0x1A20, 0x1A5E}, {0x1A60, 0x1A7C},
+    {0x1A7F, 0x1A89}, {0x1A90, 0x1A99}, {0x1AA7, 0x1AA7},
+    {0x1AB0, 0x1ABD}, {0x1ABF, 0x1ACE}, {0x1B00, 0x1B4C},
+    {0x1B50, 0x1B59}, {0x1B6B, 0x1B73}, {0x1B80, 0x1BF3},
+    {0x1C00, 0x1C37}, {0x1C40, 0x1C49}, {0x1C4D, 0x1C7D},
+    {0x1C80, 0x1C88}, {0x1C90, 0x1CBA}, {0x1CBD, 0x1CBF},
+    {0x1CD0, 0x1CD2}, {0x1CD4, 0x1CFA}, {0x1D00, 0x1F15},
+    {0x1F18, 0x1F1D}, {0x1F20, 0x1F45}, {0x1F48, 0x1F4D},
+    {0x1F50, 0x1F57}, {0x1F59, 0x1F59}, {0x1F5B, 0x1F5B},
+    {0x1F5D, 0x1F5D}, {0x1F5F, 0x1F7D}, {0x1F80, 0x1FB4},
+    {0x1FB6, 0x1FBC}, {0x1FBE, 0x1FBE}, {0x1FC2, 0x1FC4},
+    {0x1FC6, 0x1FCC}, {0x1FD0, 0x1FD3}, {0x1FD6, 0x1FDB},
+    {0x1FE0, 0x1FEC}, {0x1FF2, 0x1FF4}, {0x1FF6, 0x1FFC},
+    {0x203F, 0x2040}, {0x2054, 0x2054}, {0x2071, 0x2071},
+    {0x207F, 0x207F}, {0x2090, 0x209C}, {0x20D0, 0x20DC},
+    {0x20E1, 0x20E1}, {0x20E5, 0x20F0}, {0x2102, 0x2102},
+    {0x2107, 0x2107}, {0x210A, 0x2113}, {0x2115, 0x2115},
+    {0x2118, 0x211D}, {0x2124, 0x2124}, {0x2126, 0x2126},
+    {0x2128, 0x2128}, {0x212A, 0x2139}, {0x213C, 0x213F},
+    {0x2145, 0x2149}, {0x214E, 0x214E}, {0x2160, 0x2188},
+    {0x2C00, 0x2CE4}, {0x2CEB, 0x2CF3}, {0x2D00, 0x2D25},
+    {0x2D27, 0x2D27}, {0x2D2D, 0x2D2D}, {0x2D30, 0x2D67},
+    {0x2D6F, 0x2D6F}, {0x2D7F, 0x2D96}, {0x2DA0, 0x2DA6},
+    {0x2DA8, 0x2DAE}, {0x2DB0, 0x2DB6}, {0x2DB8, 0x2DBE},
+    {0x2DC0, 0x2DC6}, {0x2DC8, 0x2DCE}, {0x2DD0, 0x2DD6},
+    {0x2DD8, 0x2DDE}, {0x2DE0, 0x2DFF}, {0x3005, 0x3007},
+    {0x3021, 0x302F}, {0x3031, 0x3035}, {0x3038, 0x303C},
+    {0x3041, 0x3096}, {0x3099, 0x309A}, {0x309D, 0x309F},
+    {0x30A1, 0x30FA}, {0x30FC, 0x30FF}, {0x3105, 0x312F},
+    {0x3131, 0x318E}, {0x31A0, 0x31BF}, {0x31F0, 0x31FF},
+    {0x3400, 0x4DBF}, {0x4E00, 0xA48C}, {0xA4D0, 0xA4FD},
+    {0xA500, 0xA60C}, {0xA610, 0xA62B}, {0xA640, 0xA66F},
+    {0xA674, 0xA67D}, {0xA67F, 0xA6F1}, {0xA717, 0xA71F},
+    {0xA722, 0xA788}, {0xA78B, 0xA7CA}, {0xA7D0, 0xA7D1},
+    {0xA7D3, 0xA7D3}, {0xA7D5, 0xA7D9}, {0xA7F2, 0xA827},
+    {0xA82C, 0xA82C}, {0xA840, 0xA873}, {0xA880, 0xA8C5},
+    {0xA8D0, 0xA8D9}, {0xA8E0, 0xA8F7}, {0xA8FB, 0xA8FB},
+    {0xA8FD, 0xA92D}, {0xA930, 0xA953}, {0xA960, 0xA97C},
+    {0xA980, 0xA9C0}, {0xA9CF, 0xA9D9}, {0xA9E0, 0xA9FE},
+    {0xAA00, 0xAA36}, {0xAA40, 0xAA4D}, {0xAA50, 0xAA59},
+    {0xAA60, 0xAA76}, {0xAA7A, 0xAAC2}, {0xAADB, 0xAADD},
+    {0xAAE0, 0xAAEF}, {0xAAF2, 0xAAF6}, {0xAB01, 0xAB06},
+    {0xAB09, 0xAB0E}, {0xAB11, 0xAB16}, {0xAB20, 0xAB26},
+    {0xAB28, 0xAB2E}, {0xAB30, 0xAB5A}, {0xAB5C, 0xAB69},
+    {0xAB70, 0xABEA}, {0xABEC, 0xABED}, {0xABF0, 0xABF9},
+    {0xAC00, 0xD7A3}, {0xD7B0, 0xD7C6}, {0xD7CB, 0xD7FB},
+    {0xF900, 0xFA6D}, {0xFA70, 0xFAD9}, {0xFB00, 0xFB06},
+    {0xFB13, 0xFB17}, {0xFB1D, 0xFB28}, {0xFB2A, 0xFB36},
+    {0xFB38, 0xFB3C}, {0xFB3E, 0xFB3E}, {0xFB40, 0xFB41},
+    {0xFB43, 0xFB44}, {0xFB46, 0xFBB1}, {0xFBD3, 0xFC5D},
+    {0xFC64, 0xFD3D}, {0xFD50, 0xFD8F}, {0xFD92, 0xFDC7},
+    {0xFDF0, 0xFDF9}, {0xFE00, 0xFE0F}, {0xFE20, 0xFE2F},
+    {0xFE33, 0xFE34}, {0xFE4D, 0xFE4F}, {0xFE71, 0xFE71},
+    {0xFE73, 0xFE73}, {0xFE77, 0xFE77}, {0xFE79, 0xFE79},
+    {0xFE7B, 0xFE7B}, {0xFE7D, 0xFE7D}, {0xFE7F, 0xFEFC},
+    {0xFF10, 0xFF19}, {0xFF21, 0xFF3A}, {0xFF3F, 0xFF3F},
+    {0xFF41, 0xFF5A}, {0xFF66, 0xFFBE}, {0xFFC2, 0xFFC7},
+    {0xFFCA, 0xFFCF}, {0xFFD2, 0xFFD7}, {0xFFDA, 0xFFDC},
+    {0x10000, 0x1000B}, {0x1000D, 0x10026}, {0x10028, 0x1003A},
+    {0x1003C, 0x1003D}, {0x1003F, 0x1004D}, {0x10050, 0x1005D},
+    {0x10080, 0x100FA}, {0x10140, 0x10174}, {0x101FD, 0x101FD},
+    {0x10280, 0x1029C}, {0x102A0, 0x102D0}, {0x102E0, 0x102E0},
+    {0x10300, 0x1031F}, {0x1032D, 0x1034A}, {0x10350, 0x1037A},
+    {0x10380, 0x1039D}, {0x103A0, 0x103C3}, {0x103C8, 0x103CF},
+    {0x103D1, 0x103D5}, {0x10400, 0x1049D}, {0x104A0, 0x104A9},
+    {0x104B0, 0x104D3}, {0x104D8, 0x104FB}, {0x10500, 0x10527},
+    {0x10530, 0x10563}, {0x10570, 0x1057A}, {0x1057C, 0x1058A},
+    {0x1058C, 0x10592}, {0x10594, 0x10595}, {0x10597, 0x105A1},
+    {0x105A3, 0x105B1}, {0x105B3, 0x105B9}, {0x105BB, 0x105BC},
+    {0x10600, 0x10736}, {0x10740, 0x10755}, {0x10760, 0x10767},
+    {0x10780, 0x10785}, {0x10787, 0x107B0}, {0x107B2, 0x107BA},
+    {0x10800, 0x10805}, {0x10808, 0x10808}, {0x1080A, 0x10835},
+    {0x10837, 0x10838}, {0x1083C, 0x1083C}, {0x1083F, 0x10855},
+    {0x10860, 0x10876}, {0x10880, 0x1089E}, {0x108E0, 0x108F2},
+    {0x108F4, 0x108F5}, {0x10900, 0x10915}, {0x10920, 0x10939},
+    {0x10980, 0x109B7}, {0x109BE, 0x109BF}, {0x10A00, 0x10A03},
+    {0x10A05, 0x10A06}, {0x10A0C, 0x10A13}, {0x10A15, 0x10A17},
+    {0x10A19, 0x10A35}, {0x10A38, 0x10A3A}, {0x10A3F, 0x10A3F},
+    {0x10A60, 0x10A7C}, {0x10A80, 0x10A9C}, {0x10AC0, 0x10AC7},
+    {0x10AC9, 0x10AE6}, {0x10B00, 0x10B35}, {0x10B40, 0x10B55},
+    {0x10B60, 0x10B72}, {0x10B80, 0x10B91}, {0x10C00, 0x10C48},
+    {0x10C80, 0x10CB2}, {0x10CC0, 0x10CF2}, {0x10D00, 0x10D27},
+    {0x10D30, 0x10D39}, {0x10E80, 0x10EA9}, {0x10EAB, 0x10EAC},
+    {0x10EB0, 0x10EB1}, {0x10F00, 0x10F1C}, {0x10F27, 0x10F27},
+    {0x10F30, 0x10F50}, {0x10F70, 0x10F85}, {0x10FB0, 0x10FC4},
+    {0x10FE0, 0x10FF6}, {0x11000, 0x11046}, {0x11066, 0x11075},
+    {0x1107F, 0x110BA}, {0x110C2, 0x110C2}, {0x110D0, 0x110E8},
+    {0x110F0, 0x110F9}, {0x11100, 0x11134}, {0x11136, 0x1113F},
+    {0x11144, 0x11147}, {0x11150, 0x11173}, {0x11176, 0x11176},
+    {0x11180, 0x111C4}, {0x111C9, 0x111CC}, {0x111CE, 0x111DA},
+    {0x111DC, 0x111DC}, {0x11200, 0x11211}, {0x11213, 0x11237},
+    {0x1123E, 0x1123E}, {0x11280, 0x11286}, {0x11288, 0x11288},
+    {0x1128A, 0x1128D}, {0x1128F, 0x1129D}, {0x1129F, 0x112A8},
+    {0x112B0, 0x112EA}, {0x112F0, 0x112F9}, {0x11300, 0x11303},
+    {0x11305, 0x1130C}, {0x1130F, 0x11310}, {0x11313, 0x11328},
+    {0x1132A, 0x11330}, {0x11332, 0x11333}, {0x11335, 0x11339},
+    {0x1133B, 0x11344}, {0x11347, 0x11348}, {0x1134B, 0x1134D},
+    {0x11350, 0x11350}, {0x11357, 0x11357}, {0x1135D, 0x11363},
+    {0x11366, 0x1136C}, {0x11370, 0x11374}, {0x11400, 0x1144A},
+    {0x11450, 0x11459}, {0x1145E, 0x11461}, {0x11480, 0x114C5},
+    {0x114C7, 0x114C7}, {0x114D0, 0x114D9}, {0x11580, 0x115B5},
+    {0x115B8, 0x115C0}, {0x115D8, 0x115DD}, {0x11600, 0x11640},
+    {0x11644, 0x11644}, {0x11650, 0x11659}, {0x11680, 0x116B8},
+    {0x116C0, 0x116C9}, {0x11700, 0x1171A}, {0x1171D, 0x1172B},
+    {0x11730, 0x11739}, {0x11740, 0x11746}, {0x11800, 0x1183A},
+    {0x118A0, 0x118E9}, {0x118FF, 0x11906}, {0x11909, 0x11909},
+    {0x1190C, 0x11913}, {0x11915, 0x11916}, {0x11918, 0x11935},
+    {0x11937, 0x11938}, {0x1193B, 0x11943}, {0x11950, 0x11959},
+    {0x119A0, 0x119A7}, {0x119AA, 0x119D7}, {0x119DA, 0x119E1},
+    {0x119E3, 0x119E4}, {0x11A00, 0x11A3E}, {0x11A47, 0x11A47},
+    {0x11A50, 0x11A99}, {0x11A9D, 0x11A9D}, {0x11AB0, 0x11AF8},
+    {0x11C00, 0x11C08}, {0x11C0A, 0x11C36}, {0x11C38, 0x11C40},
+    {0x11C50, 0x11C59}, {0x11C72, 0x11C8F}, {0x11C92, 0x11CA7},
+    {0x11CA9, 0x11CB6}, {0x11D00, 0x11D06}, {0x11D08, 0x11D09},
+    {0x11D0B, 0x11D36}, {0x11D3A, 0x11D3A}, {0x11D3C, 0x11D3D},
+    {0x11D3F, 0x11D47}, {0x11D50, 0x11D59}, {0x11D60, 0x11D65},
+    {0x11D67, 0x11D68}, {0x11D6A, 0x11D8E}, {0x11D90, 0x11D91},
+    {0x11D93, 0x11D98}, {0x11DA0, 0x11DA9}, {0x11EE0, 0x11EF6},
+    {0x11FB0, 0x11FB0}, {0x12000, 0x12399}, {0x12400, 0x1246E},
+    {0x12480, 0x12543}, {0x12F90, 0x12FF0}, {0x13000, 0x1342E},
+    {0x14400, 0x14646}, {0x16800, 0x16A38}, {0x16A40, 0x16A5E},
+    {0x16A60, 0x16A69}, {0x16A70, 0x16ABE}, {0x16AC0, 0x16AC9},
+    {0x16AD0, 0x16AED}, {0x16AF0, 0x16AF4}, {0x16B00, 0x16B36},
+    {0x16B40, 0x16B43}, {0x16B50, 0x16B59}, {0x16B63, 0x16B77},
+    {0x16B7D, 0x16B8F}, {0x16E40, 0x16E7F}, {0x16F00, 0x16F4A},
+    {0x16F4F, 0x16F87}, {0x16F8F, 0x16F9F}, {0x16FE0, 0x16FE1},
+    {0x16FE3, 0x16FE4}, {0x16FF0, 0x16FF1}, {0x17000, 0x187F7},
+    {0x18800, 0x18CD5}, {0x18D00, 0x18D08}, {0x1AFF0, 0x1AFF3},
+    {0x1AFF5, 0x1AFFB}, {0x1AFFD, 0x1AFFE}, {0x1B000, 0x1B122},
+    {0x1B150, 0x1B152}, {0x1B164, 0x1B167}, {0x1B170, 0x1B2FB},
+    {0x1BC00, 0x1BC6A}, {0x1BC70, 0x1BC7C}, {0x1BC80, 0x1BC88},
+    {0x1BC90, 0x1BC99}, {0x1BC9D, 0x1BC9E}, {0x1CF00, 0x1CF2D},
+    {0x1CF30, 0x1CF46}, {0x1D165, 0x1D169}, {0x1D16D, 0x1D172},
+    {0x1D17B, 0x1D182}, {0x1D185, 0x1D18B}, {0x1D1AA, 0x1D1AD},
+    {0x1D242, 0x1D244}, {0x1D400, 0x1D454}, {0x1D456, 0x1D49C},
+    {0x1D49E, 0x1D49F}, {0x1D4A2, 0x1D4A2}, {0x1D4A5, 0x1D4A6},
+    {0x1D4A9, 0x1D4AC}, {0x1D4AE, 0x1D4B9}, {0x1D4BB, 0x1D4BB},
+    {0x1D4BD, 0x1D4C3}, {0x1D4C5, 0x1D505}, {0x1D507, 0x1D50A},
+    {0x1D50D, 0x1D514}, {0x1D516, 0x1D51C}, {0x1D51E, 0x1D539},
+    {0x1D53B, 0x1D53E}, {0x1D540, 0x1D544}, {0x1D546, 0x1D546},
+    {0x1D54A, 0x1D550}, {0x1D552, 0x1D6A5}, {0x1D6A8, 0x1D6C0},
+    {0x1D6C2, 0x1D6DA}, {0x1D6DC, 0x1D6FA}, {0x1D6FC, 0x1D714},
+    {0x1D716, 0x1D734}, {0x1D736, 0x1D74E}, {0x1D750, 0x1D76E},
+    {0x1D770, 0x1D788}, {0x1D78A, 0x1D7A8}, {0x1D7AA, 0x1D7C2},
+    {0x1D7C4, 0x1D7CB}, {0x1D7CE, 0x1D7FF}, {0x1DA00, 0x1DA36},
+    {0x1DA3B, 0x1DA6C}, {0x1DA75, 0x1DA75}, {0x1DA84, 0x1DA84},
+    {0x1DA9B, 0x1DA9F}, {0x1DAA1, 0x1DAAF}, {0x1DF00, 0x1DF1E},
+    {0x1E000, 0x1E006}, {0x1E008, 0x1E018}, {0x1E01B, 0x1E021},
+    {0x1E023, 0x1E024}, {0x1E026, 0x1E02A}, {0x1E100, 0x1E12C},
+    {0x1E130, 0x1E13D}, {0x1E140, 0x1E149}, {0x1E14E, 0x1E14E},
+    {0x1E290, 0x1E2AE}, {0x1E2C0, 0x1E2F9}, {0x1E7E0, 0x1E7E6},
+    {0x1E7E8, 0x1E7EB}, {0x1E7ED, 0x1E7EE}, {0x1E7F0, 0x1E7FE},
+    {0x1E800, 0x1E8C4}, {0x1E8D0, 0x1E8D6}, {0x1E900, 0x1E94B},
+    {0x1E950, 0x1E959}, {0x1EE00, 0x1EE03}, {0x1EE05, 0x1EE1F},
+    {0x1EE21, 0x1EE22}, {0x1EE24, 0x1EE24}, {0x1EE27, 0x1EE27},
+    {0x1EE29, 0x1EE32}, {0x1EE34, 0x1EE37}, {0x1EE39, 0x1EE39},
+    {0x1EE3B, 0x1EE3B}, {0x1EE42, 0x1EE42}, {0x1EE47, 0x1EE47},
+    {0x1EE49, 0x1EE49}, {0x1EE4B, 0x1EE4B}, {0x1EE4D, 0x1EE4F},
+    {0x1EE51, 0x1EE52}, {0x1EE54, 0x1EE54}, {0x1EE57, 0x1EE57},
+    {0x1EE59, 0x1EE59}, {0x1EE5B, 0x1EE5B}, {0x1EE5D, 0x1EE5D},
+    {0x1EE5F, 0x1EE5F}, {0x1EE61, 0x1EE62}, {0x1EE64, 0x1EE64},
+    {0x1EE67, 0x1EE6A}, {0x1EE6C, 0x1EE72}, {0x1EE74, 0x1EE77},
+    {0x1EE79, 0x1EE7C}, {0x1EE7E, 0x1EE7E}, {0x1EE80, 0x1EE89},
+    {0x1EE8B, 0x1EE9B}, {0x1EEA1, 0x1EEA3}, {0x1EEA5, 0x1EEA9},
+    {0x1EEAB, 0x1EEBB}, {0x1FBF0, 0x1FBF9}, {0x20000, 0x2A6DF},
+    {0x2A700, 0x2B738}, {0x2B740, 0x2B81D}, {0x2B820, 0x2CEA1},
+    {0x2CEB0, 0x2EBE0}, {0x2F800, 0x2FA1D}, {0x30000, 0x3134A},
+    {0xE0100, 0xE01EF},
+};
+
+constexpr CombiningClassRange kCombiningClasses[] = {
+    {0x300, 0x314, 230}, {0x315, 0x315, 232}, {0x316, 0x319, 220},
+    {0x31A, 0x31A, 232}, {0x31B, 0x31B, 216}, {0x31C, 0x320, 220},
+    {0x321, 0x322, 202}, {0x323, 0x326, 220}, {0x327, 0x328, 202},
+    {0x329, 0x333, 220}, {0x334, 0x338, 1}, {0x339, 0x33C, 220},
+    {0x33D, 0x344, 230}, {0x345, 0x345, 240}, {0x346, 0x346, 230},
+    {0x347, 0x349, 220}, {0x34A, 0x34C, 230}, {0x34D, 0x34E, 220},
+    {0x350, 0x352, 230}, {0x353, 0x356, 220}, {0x357, 0x357, 230},
+    {0x358, 0x358, 232}, {0x359, 0x35A, 220}, {0x35B, 0x35B, 230},
+    {0x35C, 0x35C, 233}, {0x35D, 0x35E, 234}, {0x35F, 0x35F, 233},
+    {0x360, 0x361, 234}, {0x362, 0x362, 233}, {0x363, 0x36F, 230},
+    {0x483, 0x487, 230}, {0x591, 0x591, 220}, {0x592, 0x595, 230},
+    {0x596, 0x596, 220}, {0x597, 0x599, 230}, {0x59A, 0x59A, 222},
+    {0x59B, 0x59B, 220}, {0x59C, 0x5A1, 230}, {0x5A2, 0x5A7, 220},
+    {0x5A8, 0x5A9, 230}, {0x5AA, 0x5AA, 220}, {0x5AB, 0x5AC, 230},
+    {0x5AD, 0x5AD, 222}, {0x5AE, 0x5AE, 228}, {0x5AF, 0x5AF, 230},
+    {0x5B0, 0x5B0, 10}, {0x5B1, 0x5B1, 11}, {0x5B2, 0x5B2, 12},
+    {0x5B3, 0x5B3, 13}, {0x5B4, 0x5B4, 14}, {0x5B5, 0x5B5, 15},
+    {0x5B6, 0x5B6, 16}, {0x5B7, 0x5B7, 17}, {0x5B8, 0x5B8, 18},
+    {0x5B9, 0x5BA, 19}, {0x5BB, 0x5BB, 20}, {0x5BC, 0x5BC, 21},
+    {0x5BD, 0x5BD, 22}, {0x5BF, 0x5BF, 23}, {0x5C1, 0x5C1, 24},
+    {0x5C2, 0x5C2, 25}, {0x5C4, 0x5C4, 230}, {0x5C5, 0x5C5, 220},
+    {0x5C7, 0x5C7, 18}, {0x610, 0x617, 230}, {0x618, 0x618, 30},
+    {0x619, 0x619, 31}, {0x61A, 0x61A, 32}, {0x64B, 0x64B, 27},
+    {0x64C, 0x64C, 28}, {0x64D, 0x64D, 29}, {0x64E, 0x64E, 30},
+    {0x64F, 0x64F, 31}, {0x650, 0x650, 32}, {0x651, 0x651, 33},
+    {0x652, 0x652, 34}, {0x653, 0x654, 230}, {0x655, 0x656, 220},
+    {0x657, 0x65B, 230}, {0x65C, 0x65C, 220}, {0x65D, 0x65E, 230},
+    {0x65F, 0x65F, 220}, {0x670, 0x670, 35}, {0x6D6, 0x6DC, 230},
+    {0x6DF, 0x6E2, 230}, {0x6E3, 0x6E3, 220}, {0x6E4, 0x6E4, 230},
+    {0x6E7, 0x6E8, 230}, {0x6EA, 0x6EA, 220}, {0x6EB, 0x6EC, 230},
+    {0x6ED, 0x6ED, 220}, {0x711, 0x711, 36}, {0x730, 0x730, 230},
+    {0x731, 0x731, 220}, {0x732, 0x733, 230}, {0x734, 0x734, 220},
+    {0x735, 0x736, 230}, {0x737, 0x739, 220}, {0x73A, 0x73A, 230},
+    {0x73B, 0x73C, 220}, {0x73D, 0x73D, 230}, {0x73E, 0x73E, 220},
+    {0x73F, 0x741, 230}, {0x742, 0x742, 220}, {0x743, 0x743, 230},
+    {0x744, 0x744, 220}, {0x745, 0x745, 230}, {0x746, 0x746, 220},
+    {0x747, 0x747, 230}, {0x748, 0x748, 220}, {0x749, 0x74A, 230},
+    {0x7EB, 0x7F1, 230}, {0x7F2, 0x7F2, 220}, {0x7F3, 0x7F3, 230},
+    {0x7FD, 0x7FD, 220}, {0x816, 0x819, 230}, {0x81B, 0x823, 230},
+    {0x825, 0x827, 230}, {0x829, 0x82D, 230}, {0x859, 0x85B, 220},
+    {0x898, 0x898, 230}, {0x899, 0x89B, 220}, {0x89C, 0x89F, 230},
+    {0x8CA, 0x8CE, 230}, {0x8CF, 0x8D3, 220}, {0x8D4, 0x8E1, 230},
+    {0x8E3, 0x8E3, 220}, {0x8E4, 0x8E5, 230}, {0x8E6, 0x8E6, 220},
+    {0x8E7, 0x8E8, 230}, {0x8E9, 0x8E9, 220}, {0x8EA, 0x8EC, 230},
+    {0x8ED, 0x8EF, 220}, {0x8F0, 0x8F0, 27}, {0x8F1, 0x8F1, 28},
+    {0x8F2, 0x8F2, 29}, {0x8F3, 0x8F5, 230}, {0x8F6, 0x8F6, 220},
+    {0x8F7, 0x8F8, 230}, {0x8F9, 0x8FA, 220}, {0x8FB, 0x8FF, 230},
+    {0x93C, 0x93C, 7}, {0x94D, 0x94D, 9}, {0x951, 0x951, 230},
+    {0x952, 0x952, 220}, {0x953, 0x954, 230}, {0x9BC, 0x9BC, 7},
+    {0x9CD, 0x9CD, 9}, {0x9FE, 0x9FE, 230}, {0xA3C, 0xA3C, 7},
+    {0xA4D, 0xA4D, 9}, {0xABC, 0xABC, 7}, {0xACD, 0xACD, 9},
+    {0xB3C, 0xB3C, 7}, {0xB4D, 0xB4D, 9}, {0xBCD, 0xBCD, 9},
+    {0xC3C, 0xC3C, 7}, {0xC4D, 0xC4D, 9}, {0xC55, 0xC55, 84},
+    {0xC56, 0xC56, 91}, {0xCBC, 0xCBC, 7}, {0xCCD, 0xCCD, 9},
+    {0xD3B, 0xD3C, 9}, {0xD4D, 0xD4D, 9}, {0xDCA, 0xDCA, 9},
+    {0xE38, 0xE39, 103}, {0xE3A, 0xE3A, 9}, {0xE48, 0xE4B, 107},
+    {0xEB8, 0xEB9, 118}, {0xEBA, 0xEBA, 9}, {0xEC8, 0xECB, 122},
+    {0xF18, 0xF19, 220}, {0xF35, 0xF35, 220}, {0xF37, 0xF37, 220},
+    {0xF39, 0xF39, 216}, {0xF71, 0xF71, 129}, {0xF72, 0xF72, 130},
+    {0xF74, 0xF74, 132}, {0xF7A, 0xF7D, 130}, {0xF80, 0xF80, 130},
+    {0xF82, 0xF83, 230}, {0xF84, 0xF84, 9}, {0xF86, 0xF87, 230},
+    {0xFC6, 0xFC6, 220}, {0x1037, 0x1037, 7}, {0x1039, 0x103A, 9},
+    {0x108D, 0x108D, 220}, {0x135D, 0x135F, 230}, {0x1714, 0x1715, 9},
+    {0x1734, 0x1734, 9}, {0x17D2, 0x17D2, 9}, {0x17DD, 0x17DD, 230},
+    {0x18A9, 0x18A9, 228}, {0x1939, 0x1939, 222}, {0x193A, 0x193A, 230},
+    {0x193B, 0x193B, 220}, {0x1A17, 0x1A17, 230}, {0x1A18, 0x1A18, 220},
+    {0x1A60, 0x1A60, 9}, {0x1A75, 0x1A7C, 230}, {0x1A7F, 0x1A7F, 220},
+    {0x1AB0, 0x1AB4, 230}, {0x1AB5, 0x1ABA, 220}, {0x1ABB, 0x1ABC, 230},
+    {0x1ABD, 0x1ABD, 220}, {0x1ABF, 0x1AC0, 220}, {0x1AC1, 0x1AC2, 230},
+    {0x1AC3, 0x1AC4, 220}, {0x1AC5, 0x1AC9, 230}, {0x1ACA, 0x1ACA, 220},
+    {0x1ACB, 0x1ACE, 230}, {0x1B34, 0x1B34, 7}, {0x1B44, 0x1B44, 9},
+    {0x1B6B, 0x1B6B, 230}, {0x1B6C, 0x1B6C, 220}, {0x1B6D, 0x1B73, 230},
+    {0x1BAA, 0x1BAB, 9}, {0x1BE6, 0x1BE6, 7}, {0x1BF2, 0x1BF3, 9},
+    {0x1C37, 0x1C37, 7}, {0x1CD0, 0x1CD2, 230}, {0x1CD4, 0x1CD4, 1},
+    {0x1CD5, 0x1CD9, 220}, {0x1CDA, 0x1CDB, 230}, {0x1CDC, 0x1CDF, 220},
+    {0x1CE0, 0x1CE0, 230}, {0x1CE2, 0x1CE8, 1}, {0x1CED, 0x1CED, 220},
+    {0x1CF4, 0x1CF4, 230}, {0x1CF8, 0x1CF9, 230}, {0x1DC0, 0x1DC1, 230},
+    {0x1DC2, 0x1DC2, 220}, {0x1DC3, 0x1DC9, 230}, {0x1DCA, 0x1DCA, 220},
+    {0x1DCB, 0x1DCC, 230}, {0x1DCD, 0x1DCD, 234}, {0x1DCE, 0x1DCE, 214},
+    {0x1DCF, 0x1DCF, 220}, {0x1DD0, 0x1DD0, 202}, {0x1DD1, 0x1DF5, 230},
+    {0x1DF6, 0x1DF6, 232}, {0x1DF7, 0x1DF8, 228}, {0x1DF9, 0x1DF9, 220},
+    {0x1DFA, 0x1DFA, 218}, {0x1DFB, 0x1DFB, 230}, {0x1DFC, 0x1DFC, 233},
+    {0x1DFD, 0x1DFD, 220}, {0x1DFE, 0x1DFE, 230}, {0x1DFF, 0x1DFF, 220},
+    {0x20D0, 0x20D1, 230}, {0x20D2, 0x20D3, 1}, {0x20D4, 0x20D7, 230},
+    {0x20D8, 0x20DA, 1}, {0x20DB, 0x20DC, 230}, {0x20E1, 0x20E1, 230},
+    {0x20E5, 0x20E6, 1}, {0x20E7, 0x20E7, 230}, {0x20E8, 0x20E8, 220},
+    {0x20E9, 0x20E9, 230}, {0x20EA, 0x20EB, 1}, {0x20EC, 0x20EF, 220},
+    {0x20F0, 0x20F0, 230}, {0x2CEF, 0x2CF1, 230}, {0x2D7F, 0x2D7F, 9},
+    {0x2DE0, 0x2DFF, 230}, {0x302A, 0x302A, 218}, {0x302B, 0x302B, 228},
+    {0x302C, 0x302C, 232}, {0x302D, 0x302D, 222}, {0x302E, 0x302F, 224},
+    {0x3099, 0x309A, 8}, {0xA66F, 0xA66F, 230}, {0xA674, 0xA67D, 230},
+    {0xA69E, 0xA69F, 230}, {0xA6F0, 0xA6F1, 230}, {0xA806, 0xA806, 9},
+    {0xA82C, 0xA82C, 9}, {0xA8C4, 0xA8C4, 9}, {0xA8E0, 0xA8F1, 230},
+    {0xA92B, 0xA92D, 220}, {0xA953, 0xA953, 9}, {0xA9B3, 0xA9B3, 7},
+    {0xA9C0, 0xA9C0, 9}, {0xAAB0, 0xAAB0, 230}, {0xAAB2, 0xAAB3, 230},
+    {0xAAB4, 0xAAB4, 220}, {0xAAB7, 0xAAB8, 230}, {0xAABE, 0xAABF, 230},
+    {0xAAC1, 0xAAC1, 230}, {0xAAF6, 0xAAF6, 9}, {0xABED, 0xABED, 9},
+    {0xFB1E, 0xFB1E, 26}, {0xFE20, 0xFE26, 230}, {0xFE27, 0xFE2D, 220},
+    {0xFE2E, 0xFE2F, 230}, {0x101FD, 0x101FD, 220}, {0x102E0, 0x102E0, 220},
+    {0x10376, 0x1037A, 230}, {0x10A0D, 0x10A0D, 220}, {0x10A0F, 0x10A0F, 230},
+    {0x10A38, 0x10A38, 230}, {0x10A39, 0x10A39, 1}, {0x10A3A, 0x10A3A, 220},
+    {0x10A3F, 0x10A3F, 9}, {0x10AE5, 0x10AE5, 230}, {0x10AE6, 0x10AE6, 220},
+    {0x10D24, 0x10D27, 230}, {0x10EAB, 0x10EAC, 230}, {0x10F46, 0x10F47, 220},
+    {0x10F48, 0x10F4A, 230}, {0x10F4B, 0x10F4B, 220}, {0x10F4C, 0x10F4C, 230},
+    {0x10F4D, 0x10F50, 220}, {0x10F82, 0x10F82, 230}, {0x10F83, 0x10F83, 220},
+    {0x10F84, 0x10F84, 230}, {0x10F85, 0x10F85, 220}, {0x11046, 0x11046, 9},
+    {0x11070, 0x11070, 9}, {0x1107F, 0x1107F, 9}, {0x110B9, 0x110B9, 9},
+    {0x110BA, 0x110BA, 7}, {0x11100, 0x11102, 230}, {0x11133, 0x11134, 9},
+    {0x11173, 0x11173, 7}, {0x111C0, 0x111C0, 9}, {0x111CA, 0x111CA, 7},
+    {0x11235, 0x11235, 9}, {0x11236, 0x11236, 7}, {0x112E9, 0x112E9, 7},
+    {0x112EA, 0x112EA, 9}, {0x1133B, 0x1133C, 7}, {0x1134D, 0x1134D, 9},
+    {0x11366, 0x1136C, 230}, {0x11370, 0x11374, 230}, {0x11442, 0x11442, 9},
+    {0x11446, 0x11446, 7}, {0x1145E, 0x1145E, 230}, {0x114C2, 0x114C2, 9},
+    {0x114C3, 0x114C3, 7}, {0x115BF, 0x115BF, 9}, {0x115C0, 0x115C0, 7},
+    {0x1163F, 0x1163F, 9}, {0x116B6, 0x116B6, 9}, {0x116B7, 0x116B7, 7},
+    {0x1172B, 0x1172B, 9}, {0x11839, 0x11839, 9}, {0x1183A, 0x1183A, 7},
+    {0x1193D, 0x1193E, 9}, {0x11943, 0x11943, 7}, {0x119E0, 0x119E0, 9},
+    {0x11A34, 0x11A34, 9}, {0x11A47, 0x11A47, 9}, {0x11A99, 0x11A99, 9},
+    {0x11C3F, 0x11C3F, 9}, {0x11D42, 0x11D42, 7}, {0x11D44, 0x11D45, 9},
+    {0x11D97, 0x11D97, 9}, {0x16AF0, 0x16AF4, 1}, {0x16B30, 0x16B36, 230},
+    {0x16FF0, 0x16FF1, 6}, {0x1BC9E, 0x1BC9E, 1}, {0x1D165, 0x1D166, 216},
+    {0x1D167, 0x1D169, 1}, {0x1D16D, 0x1D16D, 226}, {0x1D16E, 0x1D172, 216},
+    {0x1D17B, 0x1D182, 220}, {0x1D185, 0x1D189, 230}, {0x1D18A, 0x1D18B, 220},
+    {0x1D1AA, 0x1D1AD, 230}, {0x1D242, 0x1D244, 230}, {0x1E000, 0x1E006, 230},
+    {0x1E008, 0x1E018, 230}, {0x1E01B, 0x1E021, 230}, {0x1E023, 0x1E024, 230},
+    {0x1E026, 0x1E02A, 230}, {0x1E130, 0x1E136, 230}, {0x1E2AE, 0x1E2AE, 230},
+    {0x1E2EC, 0x1E2EF, 230}, {0x1E8D0, 0x1E8D6, 220}, {0x1E944, 0x1E949, 230},
+    {0x1E94A, 0x1E94A, 7},
+};
+
+constexpr Decomposition kDecompositions[] = {
+    {0xAA, 0, 1}, {0xB5, 1, 1}, {0xBA, 2, 1},
+    {0xC0, 3, 2}, {0xC1, 5, 2}, {0xC2, 7, 2},
+    {0xC3, 9, 2}, {0xC4, 11, 2}, {0xC5, 13, 2},
+    {0xC7, 15, 2}, {0xC8, 17, 2}, {0xC9, 19, 2},
+    {0xCA, 21, 2}, {0xCB, 23, 2}, {0xCC, 25, 2},
+    {0xCD, 27, 2}, {0xCE, 29, 2}, {0xCF, 31, 2},
+    {0xD1, 33, 2}, {0xD2, 35, 2}, {0xD3, 37, 2},
+    {0xD4, 39, 2}, {0xD5, 41, 2}, {0xD6, 43, 2},
+    {0xD9, 45, 2}, {0xDA, 47, 2}, {0xDB, 49, 2},
+    {0xDC, 51, 2}, {0xDD, 53, 2}, {0xE0, 55, 2},
+    {0xE1, 57, 2}, {0xE2, 59, 2}, {0xE3, 61, 2},
+    {0xE4, 63, 2}, {0xE5, 65, 2}, {0xE7, 67, 2},
+    {0xE8, 69, 2}, {0xE9, 71, 2}, {0xEA, 73, 2},
+    {0xEB, 75, 2}, {0xEC, 77, 2}, {0xED, 79, 2},
+    {0xEE, 81, 2}, {0xEF, 83, 2}, {0xF1, 85, 2},
+    {0xF2, 87, 2}, {0xF3, 89, 2}, {0xF4, 91, 2},
+    {0xF5, 93, 2}, {0xF6, 95, 2}, {0xF9, 97, 2},
+    {0xFA, 99, 2}, {0xFB, 101, 2}, {0xFC, 103, 2},
+    {0xFD, 105, 2}, {0xFF, 107, 2}, {0x100, 109, 2},
+    {0x101, 111, 2}, {0x102, 113, 2}, {0x103, 115, 2},
+    {0x104, 117, 2}, {0x105, 119, 2}, {0x106, 121, 2},
+    {0x107, 123, 2}, {0x108, 125, 2}, {0x109, 127, 2},
+    {0x10A, 129, 2}, {0x10B, 131, 2}, {0x10C, 133, 2},
+    {0x10D, 135, 2}, {0x10E, 137, 2}, {0x10F, 139, 2},
+    {0x112, 141, 2}, {0x113, 143, 2}, {0x114, 145, 2},
+    {0x115, 147, 2}, {0x116, 149, 2}, {0x117, 151, 2},
+    {0x118, 153, 2}, {0x119, 155, 2}, {0x11A, 157, 2},
+    {0x11B, 159, 2}, {0x11C, 161, 2}, {0x11D, 163, 2},
+    {0x11E, 165, 2}, {0x11F, 167, 2}, {0x120, 169, 2},
+    {0x121, 171, 2}, {0x122, 173, 2}, {0x123, 175, 2},
+    {0x124, 177, 2}, {0x125, 179, 2}, {0x128, 181, 2},
+    {0x129, 183, 2}, {0x12A, 185, 2}, {0x12B, 187, 2},
+    {0x12C, 189, 2}, {0x12D, 191, 2}, {0x12E, 193, 2},
+    {0x12F, 195, 2}, {0x130, 197, 2}, {0x132, 199, 2},
+    {0x133, 201, 2}, {0x134, 203, 2}, {0x135, 205, 2},
+    {0x136, 207, 2}, {0x137, 209, 2}, {0x139, 211, 2},
+    {0x13A, 213, 2}, {0x13B, 215, 2}, {0x13C, 217, 2},
+    {0x13D, 219, 2}, {0x13E, 221, 2}, {0x13F, 223, 2},
+    {0x140, 225, 2}, {0x143, 227, 2}, {0x144, 229, 2},
+    {0x145, 231, 2}, {0x146, 233, 2}, {0x147, 235, 2},
+    {0x148, 237, 2}, {0x149, 239, 2}, {0x14C, 241, 2},
+    {0x14D, 243, 2}, {0x14E, 245, 2}, {0x14F, 247, 2},
+    {0x150, 249, 2}, {0x151, 251, 2}, {0x154, 253, 2},
+    {0x155, 255, 2}, {0x156, 257, 2}, {0x157, 259, 2},
+    {0x158, 261, 2}, {0x159, 263, 2}, {0x15A, 265, 2},
+    {0x15B, 267, 2}, {0x15C, 269, 2}, {0x15D, 271, 2},
+    {0x15E, 273, 2}, {0x15F, 275, 2}, {0x160, 277, 2},
+    {0x161, 279, 2}, {0x162, 281, 2}, {0x163, 283, 2},
+    {0x164, 285, 2}, {0x165, 287, 2}, {0x168, 289, 2},
+    {0x169, 291, 2}, {0x16A, 293, 2}, {0x16B, 295, 2},
+    {0x16C, 297, 2}, {0x16D, 299, 2}, {0x16E, 301, 2},
+    {0x16F, 303, 2}, {0x170, 305, 2}, {0x171, 307, 2},
+    {0x172, 309, 2}, {0x173, 311, 2}, {0x174, 313, 2},
+    {0x175, 315, 2}, {0x176, 317, 2}, {0x177, 319, 2},
+    {0x178, 321, 2}, {0x179, 323, 2}, {0x17A, 325, 2},
+    {0x17B, 327, 2}, {0x17C, 329, 2}, {0x17D, 331, 2},
+    {0x17E, 333, 2}, {0x17F, 335, 1}, {0x1A0, 336, 2},
+    {0x1A1, 338, 2}, {0x1AF, 340, 2}, {0x1B0, 342, 2},
+    {0x1C4, 344, 3}, {0x1C5, 347, 3}, {0x1C6, 350, 3},
+    {0x1C7, 353, 2}, {0x1C8, 355, 2}, {0x1C9, 357, 2},
+    {0x1CA, 359, 2}, {0x1CB, 361, 2}, {0x1CC, 363, 2},
+    {0x1CD, 365, 2}, {0x1CE, 367, 2}, {0x1CF, 369, 2},
+    {0x1D0, 371, 2}, {0x1D1, 373, 2}, {0x1D2, 375, 2},
+    {0x1D3, 377, 2}, {0x1D4, 379, 2}, {0x1D5, 381, 3},
+    {0x1D6, 384, 3}, {0x1D7, 387, 3}, {0x1D8, 390, 3},
+    {0x1D9, 393, 3}, {0x1DA, 396, 3}, {0x1DB, 399, 3},
+    {0x1DC, 402, 3}, {0x1DE, 405, 3}, {0x1DF, 408, 3},
+    {0x1E0, 411, 3}, {0x1E1, 414, 3}, {0x1E2, 417, 2},
+    {0x1E3, 419, 2}, {0x1E6, 421, 2}, {0x1E7, 423, 2},
+    {0x1E8, 425, 2}, {0x1E9, 427, 2}, {0x1EA, 429, 2},
+    {0x1EB, 431, 2}, {0x1EC, 433, 3}, {0x1ED, 436, 3},
+    {0x1EE, 439, 2}, {0x1EF, 441, 2}, {0x1F0, 443, 2},
+    {0x1F1, 445, 2}, {0x1F2, 447, 2}, {0x1F3, 449, 2},
+    {0x1F4, 451, 2}, {0x1F5, 453, 2}, {0x1F8, 455, 2},
+    {0x1F9, 457, 2}, {0x1FA, 459, 3}, {0x1FB, 462, 3},
+    {0x1FC, 465, 2}, {0x1FD, 467, 2}, {0x1FE, 469, 2},
+    {0x1FF, 471, 2}, {0x200, 473, 2}, {0x201, 475, 2},
+    {0x202, 477, 2}, {0x203, 479, 2}, {0x204, 481, 2},
+    {0x205, 483, 2}, {0x206, 485, 2}, {0x207, 487, 2},
+    {0x208, 489, 2}, {0x209, 491, 2}, {0x20A, 493, 2},
+    {0x20B, 495, 2}, {0x20C, 497, 2}, {0x20D, 499, 2},
+    {0x20E, 501, 2}, {0x20F, 503, 2}, {0x210, 505, 2},
+    {0x211, 507, 2}, {0x212, 509, 2}, {0x213, 511, 2},
+    {0x214, 513, 2}, {0x215, 515, 2}, {0x216, 517, 2},
+    {0x217, 519, 2}, {0x218, 521, 2}, {0x219, 523, 2},
+    {0x21A, 525, 2}, {0x21B, 527, 2}, {0x21E, 529, 2},
+    {0x21F, 531, 2}, {0x226, 533, 2}, {0x227, 535, 2},
+    {0x228, 537, 2}, {0x229, 539, 2}, {0x22A, 541, 3},
+    {0x22B, 544, 3}, {0x22C, 547, 3}, {0x22D, 550, 3},
+    {0x22E, 553, 2}, {0x22F, 555, 2}, {0x230, 557, 3},
+    {0x231, 560, 3}, {0x232, 563, 2}, {0x233, 565, 2},
+    {0x2B0, 567, 1}, {0x2B1, 568, 1}, {0x2B2, 569, 1},
+    {0x2B3, 570, 1}, {0x2B4, 571, 1}, {0x2B5, 572, 1},
+    {0x2B6, 573, 1}, {0x2B7, 574, 1}, {0x2B8, 575, 1},
+    {0x2E0, 576, 1}, {0x2E1, 577, 1}, {0x2E2, 578, 1},
+    {0x2E3, 579, 1}, {0x2E4, 580, 1}, {0x340, 581, 1},
+    {0x341, 582, 1}, {0x343, 583, 1}, {0x344, 584, 2},
+    {0x374, 586, 1}, {0x386, 587, 2}, {0x387, 589, 1},
+    {0x388, 590, 2}, {0x389, 592, 2}, {0x38A, 594, 2},
+    {0x38C, 596, 2}, {0x38E, 598, 2}, {0x38F, 600, 2},
+    {0x390, 602, 3}, {0x3AA, 605, 2}, {0x3AB, 607, 2},
+    {0x3AC, 609, 2}, {0x3AD, 611, 2}, {0x3AE, 613, 2},
+    {0x3AF, 615, 2}, {0x3B0, 617, 3}, {0x3CA, 620, 2},
+    {0x3CB, 622, 2}, {0x3CC, 624, 2}, {0x3CD, 626, 2},
+    {0x3CE, 628, 2}, {0x3D0, 630, 1}, {0x3D1, 631, 1},
+    {0x3D2, 632, 1}, {0x3D3, 633, 2}, {0x3D4, 635, 2},
+    {0x3D5, 637, 1}, {0x3D6, 638, 1}, {0x3F0, 639, 1},
+    {0x3F1, 640, 1}, {0x3F2, 641, 1}, {0x3F4, 642, 1},
+    {0x3F5, 643, 1}, {0x3F9, 644, 1}, {0x400, 645, 2},
+    {0x401, 647, 2}, {0x403, 649, 2}, {0x407, 651, 2},
+    {0x40C, 653, 2}, {0x40D, 655, 2}, {0x40E, 657, 2},
+    {0x419, 659, 2}, {0x439, 661, 2}, {0x450, 663, 2},
+    {0x451, 665, 2}, {0x453, 667, 2}, {0x457, 669, 2},
+    {0x45C, 671, 2}, {0x45D, 673, 2}, {0x45E, 675, 2},
+    {0x476, 677, 2}, {0x477, 679, 2}, {0x4C1, 681, 2},
+    {0x4C2, 683, 2}, {0x4D0, 685, 2}, {0x4D1, 687, 2},
+    {0x4D2, 689, 2}, {0x4D3, 691, 2}, {0x4D6, 693, 2},
+    {0x4D7, 695, 2}, {0x4DA, 697, 2}, {0x4DB, 699, 2},
+    {0x4DC, 701, 2}, {0x4DD, 703, 2}, {0x4DE, 705, 2},
+    {0x4DF, 707, 2}, {0x4E2, 709, 2}, {0x4E3, 711, 2},
+    {0x4E4, 713, 2}, {0x4E5, 715, 2}, {0x4E6, 717, 2},
+    {0x4E7, 719, 2}, {0x4EA, 721, 2}, {0x4EB, 723, 2},
+    {0x4EC, 725, 2}, {0x4ED, 727, 2}, {0x4EE, 729, 2},
+    {0x4EF, 731, 2}, {0x4F0, 733, 2}, {0x4F1, 735, 2},
+    {0x4F2, 737, 2}, {0x4F3, 739, 2}, {0x4F4, 741, 2},
+    {0x4F5, 743, 2}, {0x4F8, 745, 2}, {0x4F9, 747, 2},
+    {0x587, 749, 2}, {0x622, 751, 2}, {0x623, 753, 2},
+    {0x624, 755, 2}, {0x625, 757, 2}, {0x626, 759, 2},
+    {0x675, 761, 2}, {0x676, 763, 2}, {0x677, 765, 2},
+    {0x678, 767, 2}, {0x6C0, 769, 2}, {0x6C2, 771, 2},
+    {0x6D3, 773, 2}, {0x929, 775, 2}, {0x931, 777, 2},
+    {0x934, 779, 2}, {0x958, 781, 2}, {0x959, 783, 2},
+    {0x95A, 785, 2}, {0x95B, 787, 2}, {0x95C, 789, 2},
+    {0x95D, 791, 2}, {0x95E, 793, 2}, {0x95F, 795, 2},
+    {0x9CB, 797, 2}, {0x9CC, 799, 2}, {0x9DC, 801, 2},
+    {0x9DD, 803, 2}, {0x9DF, 805, 2}, {0xA33, 807, 2},
+    {0xA36, 809, 2}, {0xA59, 811, 2}, {0xA5A, 813, 2},
+    {0xA5B, 815, 2}, {0xA5E, 817, 2}, {0xB48, 819, 2},
+    {0xB4B, 821, 2}, {0xB4C, 823, 2}, {0xB5C, 825, 2},
+    {0xB5D, 827, 2}, {0xB94, 829, 2}, {0xBCA, 831, 2},
+    {0xBCB, 833, 2}, {0xBCC, 835, 2}, {0xC48, 837, 2},
+    {0xCC0, 839, 2}, {0xCC7, 841, 2}, {0xCC8, 843, 2},
+    {0xCCA, 845, 2}, {0xCCB, 847, 3}, {0xD4A, 850, 2},
+    {0xD4B, 852, 2}, {0xD4C, 854, 2}, {0xDDA, 856, 2},
+    {0xDDC, 858, 2}, {0xDDD, 860, 3}, {0xDDE, 863, 2},
+    {0xE33, 865, 2}, {0xEB3, 867, 2}, {0xEDC, 869, 2},
+    {0xEDD, 871, 2}, {0xF43, 873, 2}, {0xF4D, 875, 2},
+    {0xF52, 877, 2}, {0xF57, 879, 2}, {0xF5C, 881, 2},
+    {0xF69, 883, 2}, {0xF73, 885, 2}, {0xF75, 887, 2},
+    {0xF76, 889, 2}, {0xF77, 891, 3}, {0xF78, 894, 2},
+    {0xF79, 896, 3}, {0xF81, 899, 2}, {0xF93, 901, 2},
+    {0xF9D, 903, 2}, {0xFA2, 905, 2}, {0xFA7, 907, 2},
+    {0xFAC, 909, 2}, {0xFB9, 911, 2}, {0x1026, 913, 2},
+    {0x10FC, 915, 1}, {0x1B06, 916, 2}, {0x1B08, 918, 2},
+    {0x1B0A, 920, 2}, {0x1B0C, 922, 2}, {0x1B0E, 924, 2},
+    {0x1B12, 926, 2}, {0x1B3B, 928, 2}, {0x1B3D, 930, 2},
+    {0x1B40, 932, 2}, {0x1B41, 934, 2}, {0x1B43, 936, 2},
+    {0x1D2C, 938, 1}, {0x1D2D, 939, 1}, {0x1D2E, 940, 1},
+    {0x1D30, 941, 1}, {0x1D31, 942, 1}, {0x1D32, 943, 1},
+    {0x1D33, 944, 1}, {0x1D34, 945, 1}, {0x1D35, 946, 1},
+    {0x1D36, 947, 1}, {0x1D37, 948, 1}, {0x1D38, 949, 1},
+    {0x1D39, 950, 1}, {0x1D3A, 951, 1}, {0x1D3C, 952, 1},
+    {0x1D3D, 953, 1}, {0x1D3E, 954, 1}, {0x1D3F, 955, 1},
+    {0x1D40, 956, 1}, {0x1D41, 957, 1}, {0x1D42, 958, 1},
+    {0x1D43, 959, 1}, {0x1D44, 960, 1}, {0x1D45, 961, 1},
+    {0x1D46, 962, 1}, {0x1D47, 963, 1}, {0x1D48, 964, 1},
+    {0x1D49, 965, 1}, {0x1D4A, 966, 1}, {0x1D4B, 967, 1},
+    {0x1D4C, 968, 1}, {0x1D4D, 969, 1}, {0x1D4F, 970, 1},
+    {0x1D50, 971, 1}, {0x1D51, 972, 1}, {0x1D52, 973, 1},
+    {0x1D53, 974, 1}, {0x1D54, 975, 1}, {0x1D55, 976, 1},
+    {0x1D56, 977, 1}, {0x1D57, 978, 1}, {0x1D58, 979, 1},
+    {0x1D59, 980, 1}, {0x1D5A, 981, 1}, {0x1D5B, 982, 1},
+    {0x1D5C, 983, 1}, {0x1D5D, 984, 1}, {0x1D5E, 985, 1},
+    {0x1D5F, 986, 1}, {0x1D60, 987, 1}, {0x1D61, 988, 1},
+    {0x1D62, 989, 1}, {0x1D63, 990, 1}, {0x1D64, 991, 1},
+    {0x1D65, 992, 1}, {0x1D66, 993, 1}, {0x1D67, 994, 1},
+    {0x1D68, 995, 1}, {0x1D69, 996, 1}, {0x1D6A, 997, 1},
+    {0x1D78, 998, 1}, {0x1D9B, 999, 1}, {0x1D9C, 1000, 1},
+    {0x1D9D, 1001, 1}, {0x1D9E, 1002, 1}, {0x1D9F, 1003, 1},
+    {0x1DA0, 1004, 1}, {0x1DA1, 1005, 1}, {0x1DA2, 1006, 1},
+    {0x1DA3, 1007, 1}, {0x1DA4, 1008, 1}, {0x1DA5, 1009, 1},
+    {0x1DA6, 1010, 1}, {0x1DA7, 1011, 1}, {0x1DA8, 1012, 1},
+    {0x1DA9, 1013, 1}, {0x1DAA, 1014, 1}, {0x1DAB, 1015, 1},
+    {0x1DAC, 1016, 1}, {0x1DAD, 1017, 1}, {0x1DAE, 1018, 1},
+    {0x1DAF, 1019, 1}, {0x1DB0, 1020, 1}, {0x1DB1, 1021, 1},
+    {0x1DB2, 1022, 1}, {0x1DB3, 1023, 1}, {0x1DB4, 1024, 1},
+    {0x1DB5, 1025, 1}, {0x1DB6, 1026, 1}, {0x1DB7, 1027, 1},
+    {0x1DB8, 1028, 1}, {0x1DB9, 1029, 1}, {0x1DBA, 1030, 1},
+    {0x1DBB, 1031, 1}, {0x1DBC, 1032, 1}, {0x1DBD, 1033, 1},
+    {0x1DBE, 1034, 1}, {0x1DBF, 1035, 1}, {0x1E00, 1036, 2},
+    {0x1E01, 1038, 2}, {0x1E02, 1040, 2}, {0x1E03, 1042, 2},
+    {0x1E04, 1044, 2}, {0x1E05, 1046, 2}, {0x1E06, 1048, 2},
+    {0x1E07, 1050, 2}, {0x1E08, 1052, 3}, {0x1E09, 1055, 3},
+    {0x1E0A, 1058, 2}, {0x1E0B, 1060, 2}, {0x1E0C, 1062, 2},
+    {0x1E0D, 1064, 2}, {0x1E0E, 1066, 2}, {0x1E0F, 1068, 2},
+    {0x1E10, 1070, 2}, {0x1E11, 1072, 2}, {0x1E12, 1074, 2},
+    {0x1E13, 1076, 2}, {0x1E14, 1078, 3}, {0x1E15, 1081, 3},
+    {0x1E16, 1084, 3}, {0x1E17, 1087, 3}, {0x1E18, 1090, 2},
+    {0x1E19, 1092, 2}, {0x1E1A, 1094, 2}, {0x1E1B, 1096, 2},
+    {0x1E1C, 1098, 3}, {0x1E1D, 1101, 3}, {0x1E1E, 1104, 2},
+    {0x1E1F, 1106, 2}, {0x1E20, 1108, 2}, {0x1E21, 1110, 2},
+    {0x1E22, 1112, 2}, {0x1E23, 1114, 2}, {0x1E24, 1116, 2},
+    {0x1E25, 1118, 2}, {0x1E26, 1120, 2}, {0x1E27, 1122, 2},
+    {0x1E28, 1124, 2}, {0x1E29, 1126, 2}, {0x1E2A, 1128, 2},
+    {0x1E2B, 1130, 2}, {0x1E2C, 1132, 2}, {0x1E2D, 1134, 2},
+    {0x1E2E, 1136, 3}, {0x1E2F, 1139, 3}, {0x1E30, 1142, 2},
+    {0x1E31, 1144, 2}, {0x1E32, 1146, 2}, {0x1E33, 1148, 2},
+    {0x1E34, 1150, 2}, {0x1E35, 1152, 2}, {0x1E36, 1154, 2},
+    {0x1E37, 1156, 2}, {0x1E38, 1158, 3}, {0x1E39, 1161, 3},
+    {0x1E3A, 1164, 2}, {0x1E3B, 1166, 2}, {0x1E3C, 1168, 2},
+    {0x1E3D, 1170, 2}, {0x1E3E, 1172, 2}, {0x1E3F, 1174, 2},
+    {0x1E40, 1176, 2}, {0x1E41, 1178, 2}, {0x1E42, 1180, 2},
+    {0x1E43, 1182, 2}, {0x1E44, 1184, 2}, {0x1E45, 1186, 2},
+    {0x1E46, 1188, 2}, {0x1E47, 1190, 2}, {0x1E48, 1192, 2},
+    {0x1E49, 1194, 2}, {0x1E4A, 1196, 2}, {0x1E4B, 1198, 2},
+    {0x1E4C, 1200, 3}, {0x1E4D, 1203, 3}, {0x1E4E, 1206, 3},
+    {0x1E4F, 1209, 3}, {0x1E50, 1212, 3}, {0x1E51, 1215, 3},
+    {0x1E52, 1218, 3}, {0x1E53, 1221, 3}, {0x1E54, 1224, 2},
+    {0x1E55, 1226, 2}, {0x1E56, 1228, 2}, {0x1E57, 1230, 2},
+    {0x1E58, 1232, 2}, {0x1E59, 1234, 2}, {0x1E5A, 1236, 2},
+    {0x1E5B, 1238, 2}, {0x1E5C, 1240, 3}, {0x1E5D, 1243, 3},
+    {0x1E5E, 1246, 2}, {0x1E5F, 1248, 2}, {0x1E60, 1250, 2},
+    {0x1E61, 1252, 2}, {0x1E62, 1254, 2}, {0x1E63, 1256, 2},
+    {0x1E64, 1258, 3}, {0x1E65, 1261, 3}, {0x1E66, 1264, 3},
+    {0x1E67, 1267, 3}, {0x1E68, 1270, 3}, {0x1E69, 1273, 3},
+    {0x1E6A, 1276, 2}, {0x1E6B, 1278, 2}, {0x1E6C, 1280, 2},
+    {0x1E6D, 1282, 2}, {0x1E6E, 1284, 2}, {0x1E6F, 1286, 2},
+    {0x1E70, 1288, 2}, {0x1E71, 1290, 2}, {0x1E72, 1292, 2},
+    {0x1E73, 1294, 2}, {0x1E74, 1296, 2}, {0x1E75, 1298, 2},
+    {0x1E76, 1300, 2}, {0x1E77, 1302, 2}, {0x1E78, 1304, 3},
+    {0x1E79, 1307, 3}, {0x1E7A, 1310, 3}, {0x1E7B, 1313, 3},
+    {0x1E7C, 1316, 2}, {0x1E7D, 1318, 2}, {0x1E7E, 1320, 2},
+    {0x1E7F, 1322, 2}, {0x1E80, 1324, 2}, {0x1E81, 1326, 2},
+    {0x1E82, 1328, 2}, {0x1E83, 1330, 2}, {0x1E84, 1332, 2},
+    {0x1E85, 1334, 2}, {0x1E86, 1336, 2}, {0x1E87, 1338, 2},
+    {0x1E88, 1340, 2}, {0x1E89, 1342, 2}, {0x1E8A, 1344, 2},
+    {0x1E8B, 1346, 2}, {0x1E8C, 1348, 2}, {0x1E8D, 1350, 2},
+    {0x1E8E, 1352, 2}, {0x1E8F, 1354, 2}, {0x1E90, 1356, 2},
+    {0x1E91, 1358, 2}, {0x1E92, 1360, 2}, {0x1E93, 1362, 2},
+    {0x1E94, 1364, 2}, {0x1E95, 1366, 2}, {0x1E96, 1368, 2},
+    {0x1E97, 1370, 2}, {0x1E98, 1372, 2}, {0x1E99, 1374, 2},
+    {0x1E9A, 1376, 2}, {0x1E9B, 1378, 2}, {0x1EA0, 1380, 2},
+    {0x1EA1, 1382, 2}, {0x1EA2, 1384, 2}, {0x1EA3, 1386, 2},
+    {0x1EA4, 1388, 3}, {0x1EA5, 1391, 3}, {0x1EA6, 1394, 3},
+    {0x1EA7, 1397, 3}, {0x1EA8, 1400, 3}, {0x1EA9, 1403, 3},
+    {0x1EAA, 1406, 3}, {0x1EAB, 1409, 3}, {0x1EAC, 1412, 3},
+    {0x1EAD, 1415, 3}, {0x1EAE, 1418, 3}, {0x1EAF, 1421, 3},
+    {0x1EB0, 1424, 3}, {0x1EB1, 1427, 3}, {0x1EB2, 1430, 3},
+    {0x1EB3, 1433, 3}, {0x1EB4, 1436, 3}, {0x1EB5, 1439, 3},
+    {0x1EB6, 1442, 3}, {0x1EB7, 1445, 3}, {0x1EB8, 1448, 2},
+    {0x1EB9, 1450, 2}, {0x1EBA, 1452, 2}, {0x1EBB, 1454, 2},
+    {0x1EBC, 1456, 2}, {0x1EBD, 1458, 2}, {0x1EBE, 1460, 3},
+    {0x1EBF, 1463, 3}, {0x1EC0, 1466, 3}, {0x1EC1, 1469, 3},
+    {0x1EC2, 1472, 3}, {0x1EC3, 1475, 3}, {0x1EC4, 1478, 3},
+    {0x1EC5, 1481, 3}, {0x1EC6, 1484, 3}, {0x1EC7, 1487, 3},
+    {0x1EC8, 1490, 2}, {0x1EC9, 1492, 2}, {0x1ECA, 1494, 2},
+    {0x1ECB, 1496, 2}, {0x1ECC, 1498, 2}, {0x1ECD, 1500, 2},
+    {0x1ECE, 1502, 2}, {0x1ECF, 1504, 2}, {0x1ED0, 1506, 3},
+    {0x1ED1, 1509, 3}, {0x1ED2, 1512, 3}, {0x1ED3, 1515, 3},
+    {0x1ED4, 1518, 3}, {0x1ED5, 1521, 3}, {0x1ED6, 1524, 3},
+    {0x1ED7, 1527, 3}, {0x1ED8, 1530, 3}, {0x1ED9, 1533, 3},
+    {0x1EDA, 1536, 3}, {0x1EDB, 1539, 3}, {0x1EDC, 1542, 3},
+    {0x1EDD, 1545, 3}, {0x1EDE, 1548, 3}, {0x1EDF, 1551, 3},
+    {0x1EE0, 1554, 3}, {0x1EE1, 1557, 3}, {0x1EE2, 1560, 3},
+    {0x1EE3, 1563, 3}, {0x1EE4, 1566, 2}, {0x1EE5, 1568, 2},
+    {0x1EE6, 1570, 2}, {0x1EE7, 1572, 2}, {0x1EE8, 1574, 3},
+    {0x1EE9, 1577, 3}, {0x1EEA, 1580, 3}, {0x1EEB, 1583, 3},
+    {0x1EEC, 1586, 3}, {0x1EED, 1589, 3}, {0x1EEE, 1592, 3},
+    {0x1EEF, 1595, 3}, {0x1EF0, 1598, 3}, {0x1EF1, 1601, 3},
+    {0x1EF2, 1604, 2}, {0x1EF3, 1606, 2}, {0x1EF4, 1608, 2},
+    {0x1EF5, 1610, 2}, {0x1EF6, 1612, 2}, {0x1EF7, 1614, 2},
+    {0x1EF8, 1616, 2}, {0x1EF9, 1618, 2}, {0x1F00, 1620, 2},
+    {0x1F01, 1622, 2}, {0x1F02, 1624, 3}, {0x1F03, 1627, 3},
+    {0x1F04, 1630, 3}, {0x1F05, 1633, 3}, {0x1F06, 1636, 3},
+    {0x1F07, 1639, 3}, {0x1F08, 1642, 2}, {0x1F09, 1644, 2},
+    {0x1F0A, 1646, 3}, {0x1F0B, 1649, 3}, {0x1F0C, 1652, 3},
+    {0x1F0D, 1655, 3}, {0x1F0E, 1658, 3}, {0x1F0F, 1661, 3},
+    {0x1F10, 1664, 2}, {0x1F11, 1666, 2}, {0x1F12, 1668, 3},
+    {0x1F13, 1671, 3}, {0x1F14, 1674, 3}, {0x1F15, 1677, 3},
+    {0x1F18, 1680, 2}, {0x1F19, 1682, 2}, {0x1F1A, 1684, 3},
+    {0x1F1B, 1687, 3}, {0x1F1C, 1690, 3}, {0x1F1D, 1693, 3},
+    {0x1F20, 1696, 2}, {0x1F21, 1698, 2}, {0x1F22, 1700, 3},
+    {0x1F23, 1703, 3}, {0x1F24, 1706, 3}, {0x1F25, 1709, 3},
+    {0x1F26, 1712, 3}, {0x1F27, 1715, 3}, {0x1F28, 1718, 2},
+    {0x1F29, 1720, 2}, {0x1F2A, 1722, 3}, {0x1F2B, 1725, 3},
+    {0x1F2C, 1728, 3}, {0x1F2D, 1731, 3}, {0x1F2E, 1734, 3},
+    {0x1F2F, 1737, 3}, {0x1F30, 1740, 2}, {0x1F31, 1742, 2},
+    {0x1F32, 1744, 3}, {0x1F33, 1747, 3}, {0x1F34, 1750, 3},
+    {0x1F35, 1753, 3}, {0x1F36, 1756, 3}, {0x1F37, 1759, 3},
+    {0x1F38, 1762, 2}, {0x1F39, 1764, 2}, {0x1F3A, 1766, 3},
+    {0x1F3B, 1769, 3}, {0x1F3C, 1772, 3}, {0x1F3D, 1775, 3},
+    {0x1F3E, 1778, 3}, {0x1F3F, 1781, 3}, {0x1F40, 1784, 2},
+    {0x1F41, 1786, 2}, {0x1F42, 1788, 3}, {0x1F43, 1791, 3},
+    {0x1F44, 1794, 3}, {0x1F45, 1797, 3}, {0x1F48, 1800, 2},
+    {0x1F49, 1802, 2}, {0x1F4A, 1804, 3}, {0x1F4B, 1807, 3},
+    {0x1F4C, 1810, 3}, {0x1F4D, 1813, 3}, {0x1F50, 1816, 2},
+    {0x1F51, 1818, 2}, {0x1F52, 1820, 3}, {0x1F53, 1823, 3},
+    {0x1F54, 1826, 3}, {0x1F55, 1829, 3}, {0x1F56, 1832, 3},
+    {0x1F57, 1835, 3}, {0x1F59, 1838, 2}, {0x1F5B, 1840, 3},
+    {0x1F5D, 1843, 3}, {0x1F5F, 1846, 3}, {0x1F60, 1849, 2},
+    {0x1F61, 1851, 2}, {0x1F62, 1853, 3}, {0x1F63, 1856, 3},
+    {0x1F64, 1859, 3}, {0x1F65, 1862, 3}, {0x1F66, 1865, 3},
+    {0x1F67, 1868, 3}, {0x1F68, 1871, 2}, {0x1F69, 1873, 2},
+    {0x1F6A, 1875, 3}, {0x1F6B, 1878, 3}, {0x1F6C, 1881, 3},
+    {0x1F6D, 1884, 3}, {0x1F6E, 1887, 3}, {0x1F6F, 1890, 3},
+    {0x1F70, 1893, 2}, {0x1F71, 1895, 2}, {0x1F72, 1897, 2},
+    {0x1F73, 1899, 2}, {0x1F74, 1901, 2}, {0x1F75, 1903, 2},
+    {0x1F76, 1905, 2}, {0x1F77, 1907, 2}, {0x1F78, 1909, 2},
+    {0x1F79, 1911, 2}, {0x1F7A, 1913, 2}, {0x1F7B, 1915, 2},
+    {0x1F7C, 1917, 2}, {0x1F7D, 1919, 2}, {0x1F80, 1921, 3},
+    {0x1F81, 1924, 3}, {0x1F82, 1927, 4}, {0x1F83, 1931, 4},
+    {0x1F84, 1935, 4}, {0x1F85, 1939, 4}, {0x1F86, 1943, 4},
+    {0x1F87, 1947, 4}, {0x1F88, 1951, 3}, {0x1F89, 1954, 3},
+    {0x1F8A, 1957, 4}, {0x1F8B, 1961, 4}, {0x1F8C, 1965, 4},
+    {0x1F8D, 1969, 4}, {0x1F8E, 1973, 4}, {0x1F8F, 1977, 4},
+    {0x1F90, 1981, 3}, {0x1F91, 1984, 3}, {0x1F92, 1987, 4},
+    {0x1F93, 1991, 4}, {0x1F94, 1995, 4}, {0x1F95, 1999, 4},
+    {0x1F96, 2003, 4}, {0x1F97, 2007, 4}, {0x1F98, 2011, 3},
+    {0x1F99, 2014, 3}, {0x1F9A, 2017, 4}, {0x1F9B, 2021, 4},
+    {0x1F9C, 2025, 4}, {0x1F9D, 2029, 4}, {0x1F9E, 2033, 4},
+    {0x1F9F, 2037, 4}, {0x1FA0, 2041, 3}, {0x1FA1, 2044, 3},
+    {0x1FA2, 2047, 4}, {0x1FA3, 2051, 4}, {0x1FA4, 2055, 4},
+    {0x1FA5, 2059, 4}, {0x1FA6, 2063, 4}, {0x1FA7, 2067, 4},
+    {0x1FA8, 2071, 3}, {0x1FA9, 2074, 3}, {0x1FAA, 2077, 4},
+    {0x1FAB, 2081, 4}, {0x1FAC, 2085, 4}, {0x1FAD, 2089, 4},
+    {0x1FAE, 2093, 4}, {0x1FAF, 2097, 4}, {0x1FB0, 2101, 2},
+    {0x1FB1, 2103, 2}, {0x1FB2, 2105, 3}, {0x1FB3, 2108, 2},
+    {0x1FB4, 2110, 3}, {0x1FB6, 2113, 2}, {0x1FB7, 2115, 3},
+    {0x1FB8, 2118, 2}, {0x1FB9, 2120, 2}, {0x1FBA, 2122, 2},
+    {0x1FBB, 2124, 2}, {0x1FBC, 2126, 2}, {0x1FBE, 2128, 1},
+    {0x1FC2, 2129, 3}, {0x1FC3, 2132, 2}, {0x1FC4, 2134, 3},
+    {0x1FC6, 2137, 2}, {0x1FC7, 2139, 3}, {0x1FC8, 2142, 2},
+    {0x1FC9, 2144, 2}, {0x1FCA, 2146, 2}, {0x1FCB, 2148, 2},
+    {0x1FCC, 2150, 2}, {0x1FD0, 2152, 2}, {0x1FD1, 2154, 2},
+    {0x1FD2, 2156, 3}, {0x1FD3, 2159, 3}, {0x1FD6, 2162, 2},
+    {0x1FD7, 2164, 3}, {0x1FD8, 2167, 2}, {0x1FD9, 2169, 2},
+    {0x1FDA, 2171, 2}, {0x1FDB, 2173, 2}, {0x1FE0, 2175, 2},
+    {0x1FE1, 2177, 2}, {0x1FE2, 2179, 3}, {0x1FE3, 2182, 3},
+    {0x1FE4, 2185, 2}, {0x1FE5, 2187, 2}, {0x1FE6, 2189, 2},
+    {0x1FE7, 2191, 3}, {0x1FE8, 2194, 2}, {0x1FE9, 2196, 2},
+    {0x1FEA, 2198, 2}, {0x1FEB, 2200, 2}, {0x1FEC, 2202, 2},
+    {0x1FF2, 2204, 3}, {0x1FF3, 2207, 2}, {0x1FF4, 2209, 3},
+    {0x1FF6, 2212, 2}, {0x1FF7, 2214, 3}, {0x1FF8, 2217, 2},
+    {0x1FF9, 2219, 2}, {0x1FFA, 2221, 2}, {0x1FFB, 2223, 2},
+    {0x1FFC, 2225, 2}, {0x2071, 2227, 1}, {0x207F, 2228, 1},
+    {0x2090, 2229, 1}, {0x2091, 2230, 1}, {0x2092, 2231, 1},
+    {0x2093, 2232, 1}, {0x2094, 2233, 1}, {0x2095, 2234, 1},
+    {0x2096, 2235, 1}, {0x2097, 2236, 1}, {0x2098, 2237, 1},
+    {0x2099, 2238, 1}, {0x209A, 2239, 1}, {0x209B, 2240, 1},
+    {0x209C, 2241, 1}, {0x2102, 2242, 1}, {0x2107, 2243, 1},
+    {0x210A, 2244, 1}, {0x210B, 2245, 1}, {0x210C, 2246, 1},
+    {0x210D, 2247, 1}, {0x210E, 2248, 1}, {0x210F, 2249, 1},
+    {0x2110, 2250, 1}, {0x2111, 2251, 1}, {0x2112, 2252, 1},
+    {0x2113, 2253, 1}, {0x2115, 2254, 1}, {0x2119, 2255, 1},
+    {0x211A, 2256, 1}, {0x211B, 2257, 1}, {0x211C, 2258, 1},
+    {0x211D, 2259, 1}, {0x2124, 2260, 1}, {0x2126, 2261, 1},
+    {0x2128, 2262, 1}, {0x212A, 2263, 1}, {0x212B, 2264, 2},
+    {0x212C, 2266, 1}, {0x212D, 2267, 1}, {0x212F, 2268, 1},
+    {0x2130, 2269, 1}, {0x2131, 2270, 1}, {0x2133, 2271, 1},
+    {0x2134, 2272, 1}, {0x2135, 2273, 1}, {0x2136, 2274, 1},
+    {0x2137, 2275, 1}, {0x2138, 2276, 1}, {0x2139, 2277, 1},
+    {0x213C, 2278, 1}, {0x213D, 2279, 1}, {0x213E, 2280, 1},
+    {0x213F, 2281, 1}, {0x2145, 2282, 1}, {0x2146, 2283, 1},
+    {0x2147, 2284, 1}, {0x2148, 2285, 1}, {0x2149, 2286, 1},
+    {0x2160, 2287, 1}, {0x2161, 2288, 2}, {0x2162, 2290, 3},
+    {0x2163, 2293, 2}, {0x2164, 2295, 1}, {0x2165, 2296, 2},
+    {0x2166, 2298, 3}, {0x2167, 2301, 4}, {0x2168, 2305, 2},
+    {0x2169, 2307, 1}, {0x216A, 2308, 2}, {0x216B, 2310, 3},
+    {0x216C, 2313, 1}, {0x216D, 2314, 1}, {0x216E, 2315, 1},
+    {0x216F, 2316, 1}, {0x2170, 2317, 1}, {0x2171, 2318, 2},
+    {0x2172, 2320, 3}, {0x2173, 2323, 2}, {0x2174, 2325, 1},
+    {0x2175, 2326, 2}, {0x2176, 2328, 3}, {0x2177, 2331, 4},
+    {0x2178, 2335, 2}, {0x2179, 2337, 1}, {0x217A, 2338, 2},
+    {0x217B, 2340, 3}, {0x217C, 2343, 1}, {0x217D, 2344, 1},
+    {0x217E, 2345, 1}, {0x217F, 2346, 1}, {0x2C7C, 2347, 1},
+    {0x2C7D, 2348, 1}, {0x2D6F, 2349, 1}, {0x3038, 2350, 1},
+    {0x3039, 2351, 1}, {0x303A, 2352, 1}, {0x304C, 2353, 2},
+    {0x304E, 2355, 2}, {0x3050, 2357, 2}, {0x3052, 2359, 2},
+    {0x3054, 2361, 2}, {0x3056, 2363, 2}, {0x3058, 2365, 2},
+    {0x305A, 2367, 2}, {0x305C, 2369, 2}, {0x305E, 2371, 2},
+    {0x3060, 2373, 2}, {0x3062, 2375, 2}, {0x3065, 2377, 2},
+    {0x3067, 2379, 2}, {0x3069, 2381, 2}, {0x3070, 2383, 2},
+    {0x3071, 2385, 2}, {0x3073, 2387, 2}, {0x3074, 2389, 2},
+    {0x3076, 2391, 2}, {0x3077, 2393, 2}, {0x3079, 2395, 2},
+    {0x307A, 2397, 2}, {0x307C, 2399, 2}, {0x307D, 2401, 2},
+    {0x3094, 2403, 2}, {0x309E, 2405, 2}, {0x309F, 2407, 2},
+    {0x30AC, 2409, 2}, {0x30AE, 2411, 2}, {0x30B0, 2413, 2},
+    {0x30B2, 2415, 2}, {0x30B4, 2417, 2}, {0x30B6, 2419, 2},
+    {0x30B8, 2421, 2}, {0x30BA, 2423, 2}, {0x30BC, 2425, 2},
+    {0x30BE, 2427, 2}, {0x30C0, 2429, 2}, {0x30C2, 2431, 2},
+    {0x30C5, 2433, 2}, {0x30C7, 2435, 2}, {0x30C9, 2437, 2},
+    {0x30D0, 2439, 2}, {0x30D1, 2441, 2}, {0x30D3, 2443, 2},
+    {0x30D4, 2445, 2}, {0x30D6, 2447, 2}, {0x30D7, 2449, 2},
+    {0x30D9, 2451, 2}, {0x30DA, 2453, 2}, {0x30DC, 2455, 2},
+    {0x30DD, 2457, 2}, {0x30F4, 2459, 2}, {0x30F7, 2461, 2},
+    {0x30F8, 2463, 2}, {0x30F9, 2465, 2}, {0x30FA, 2467, 2},
+    {0x30FE, 2469, 2}, {0x30FF, 2471, 2}, {0x3131, 2473, 1},
+    {0x3132, 2474, 1}, {0x3133, 2475, 1}, {0x3134, 2476, 1},
+    {0x3135, 2477, 1}, {0x3136, 2478, 1}, {0x3137, 2479, 1},
+    {0x3138, 2480, 1}, {0x3139, 2481, 1}, {0x313A, 2482, 1},
+    {0x313B, 2483, 1}, {0x313C, 2484, 1}, {0x313D, 2485, 1},
+    {0x313E, 2486, 1}, {0x313F, 2487, 1}, {0x3140, 2488, 1},
+    {0x3141, 2489, 1}, {0x3142, 2490, 1}, {0x3143, 2491, 1},
+    {0x3144, 2492, 1}, {0x3145, 2493, 1}, {0x3146, 2494, 1},
+    {0x3147, 2495, 1}, {0x3148, 2496, 1}, {0x3149, 2497, 1},
+    {0x314A, 2498, 1}, {0x314B, 2499, 1}, {0x314C, 2500, 1},
+    {0x314D, 2501, 1}, {0x314E, 2502, 1}, {0x314F, 2503, 1},
+    {0x3150, 2504, 1}, {0x3151, 2505, 1}, {0x3152, 2506, 1},
+    {0x3153, 2507, 1}, {0x3154, 2508, 1}, {0x3155, 2509, 1},
+    {0x3156, 2510, 1}, {0x3157, 2511, 1}, {0x3158, 2512, 1},
+    {0x3159, 2513, 1}, {0x315A, 2514, 1}, {0x315B, 2515, 1},
+    {0x315C, 2516, 1}, {0x315D, 2517, 1}, {0x315E, 2518, 1},
+    {0x315F, 2519, 1}, {0x3160, 2520, 1}, {0x3161, 2521, 1},
+    {0x3162, 2522, 1}, {0x3163, 2523, 1}, {0x3164, 2524, 1},
+    {0x3165, 2525, 1}, {0x3166, 2526, 1}, {0x3167, 2527, 1},
+    {0x3168, 2528, 1}, {0x3169, 2529, 1}, {0x316A, 2530, 1},
+    {0x316B, 2531, 1}, {0x316C, 2532, 1}, {0x316D, 2533, 1},
+    {0x316E, 2534, 1}, {0x316F, 2535, 1}, {0x3170, 2536, 1},
+    {0x3171, 2537, 1}, {0x3172, 2538, 1}, {0x3173, 2539, 1},
+    {0x3174, 2540, 1}, {0x3175, 2541, 1}, {0x3176, 2542, 1},
+    {0x3177, 2543, 1}, {0x3178, 2544, 1}, {0x3179, 2545, 1},
+    {0x317A, 2546, 1}, {0x317B, 2547, 1}, {0x317C, 2548, 1},
+    {0x317D, 2549, 1}, {0x317E, 2550, 1}, {0x317F, 2551, 1},
+    {0x3180, 2552, 1}, {0x3181, 2553, 1}, {0x3182, 2554, 1},
+    {0x3183, 2555, 1}, {0x3184, 2556, 1}, {0x3185, 2557, 1},
+    {0x3186, 2558, 1}, {0x3187, 2559, 1}, {0x3188, 2560, 1},
+    {0x3189, 2561, 1}, {0x318A, 2562, 1}, {0x318B, 2563, 1},
+    {0x318C, 2564, 1}, {0x318D, 2565, 1}, {0x318E, 2566, 1},
+    {0xA69C, 2567, 1}, {0xA69D, 2568, 1}, {0xA770, 2569, 1},
+    {0xA7F2, 2570, 1}, {0xA7F3, 2571, 1}, {0xA7F4, 2572, 1},
+    {0xA7F8, 2573, 1}, {0xA7F9, 2574, 1}, {0xAB5C, 2575, 1},
+    {0xAB5D, 2576, 1}, {0xAB5E, 2577, 1}, {0xAB5F, 2578, 1},
+    {0xAB69, 2579, 1}, {0xF900, 2580, 1}, {0xF901, 2581, 1},
+    {0xF902, 2582, 1}, {0xF903, 2583, 1}, {0xF904, 2584, 1},
+    {0xF905, 2585, 1}, {0xF906, 2586, 1}, {0xF907, 2587, 1},
+    {0xF908, 2588, 1}, {0xF909, 2589, 1}, {0xF90A, 2590, 1},
+    {0xF90B, 2591, 1}, {0xF90C, 2592, 1}, {0xF90D, 2593, 1},
+    {0xF90E, 2594, 1}, {0xF90F, 2595, 1}, {0xF910, 2596, 1},
+    {0xF911, 2597, 1}, {0xF912, 2598, 1}, {0xF913, 2599, 1},
+    {0xF914, 2600, 1}, {0xF915, 2601, 1}, {0xF916, 2602, 1},
+    {0xF917, 2603, 1}, {0xF918, 2604, 1}, {0xF919, 2605, 1},
+    {0xF91A, 2606, 1}, {0xF91B, 2607, 1}, {0xF91C, 2608, 1},
+    {0xF91D, 2609, 1}, {0xF91E, 2610, 1}, {0xF91F, 2611, 1},
+    {0xF920, 2612, 1}, {0xF921, 2613, 1}, {0xF922, 2614, 1},
+    {0xF923, 2615, 1}, {0xF924, 2616, 1}, {0xF925, 2617, 1},
+    {0xF926, 2618, 1}, {0xF927, 2619, 1}, {0xF928, 2620, 1},
+    {0xF929, 2621, 1}, {0xF92A, 2622, 1}, {0xF92B, 2623, 1},
+    {0xF92C, 2624, 1}, {0xF92D, 2625, 1}, {0xF92E, 2626, 1},
+    {0xF92F, 2627, 1}, {0xF930, 2628, 1}, {0xF931, 2629, 1},
+    {0xF932, 2630, 1}, {0xF933, 2631, 1}, {0xF934, 2632, 1},
+    {0xF935, 2633, 1}, {0xF936, 2634, 1}, {0xF937, 2635, 1},
+    {0xF938, 2636, 1}, {0xF939, 2637, 1}, {0xF93A, 2638, 1},
+    {0xF93B, 2639, 1}, {0xF93C, 2640, 1}, {0xF93D, 2641, 1},
+    {0xF93E, 2642, 1}, {0xF93F, 2643, 1}, {0xF940, 2644, 1},
+    {0xF941, 2645, 1}, {0xF942, 2646, 1}, {0xF943, 2647, 1},
+    {0xF944, 2648, 1}, {0xF945, 2649, 1}, {0xF946, 2650, 1},
+    {0xF947, 2651, 1}, {0xF948, 2652, 1}, {0xF949, 2653, 1},
+    {0xF94A, 2654, 1}, {0xF94B, 2655, 1}, {0xF94C, 2656, 1},
+    {0xF94D, 2657, 1}, {0xF94E, 2658, 1}, {0xF94F, 2659, 1},
+    {0xF950, 2660, 1}, {0xF951, 2661, 1}, {0xF952, 2662, 1},
+    {0xF953, 2663, 1}, {0xF954, 2664, 1}, {0xF955, 2665, 1},
+    {0xF956, 2666, 1}, {0xF957, 2667, 1}, {0xF958, 2668, 1},
+    {0xF959, 2669, 1}, {0xF95A, 2670, 1}, {0xF95B, 2671, 1},
+    {0xF95C, 2672, 1}, {0xF95D, 2673, 1}, {0xF95E, 2674, 1},
+    {0xF95F, 2675, 1}, {0xF960, 2676, 1}, {0xF961, 2677, 1},
+    {0xF962, 2678, 1}, {0xF963, 2679, 1}, {0xF964, 2680, 1},
+    {0xF965, 2681, 1}, {0xF966, 2682, 1}, {0xF967, 2683, 1},
+    {0xF968, 2684, 1}, {0xF969, 2685, 1}, {0xF96A, 2686, 1},
+    {0xF96B, 2687, 1}, {0xF96C, 2688, 1}, {0xF96D, 2689, 1},
+    {0xF96E, 2690, 1}, {0xF96F, 2691, 1}, {0xF970, 2692, 1},
+    {0xF971, 2693, 1}, {0xF972, 2694, 1}, {0xF973, 2695, 1},
+    {0xF974, 2696, 1}, {0xF975, 2697, 1}, {0xF976, 2698, 1},
+    {0xF977, 2699, 1}, {0xF978, 2700, 1}, {0xF979, 2701, 1},
+    {0xF97A, 2702, 1}, {0xF97B, 2703, 1}, {0xF97C, 2704, 1},
+    {0xF97D, 2705, 1}, {0xF97E, 2706, 1}, {0xF97F, 2707, 1},
+    {0xF980, 2708, 1}, {0xF981, 2709, 1}, {0xF982, 2710, 1},
+    {0xF983, 2711, 1}, {0xF984, 2712, 1}, {0xF985, 2713, 1},
+    {0xF986, 2714, 1}, {0xF987, 2715, 1}, {0xF988, 2716, 1},
+    {0xF989, 2717, 1}, {0xF98A, 2718, 1}, {0xF98B, 2719, 1},
+    {0xF98C, 2720, 1}, {0xF98D, 2721, 1}, {0xF98E, 2722, 1},
+    {0xF98F, 2723, 1}, {0xF990, 2724, 1}, {0xF991, 2725, 1},
+    {0xF992, 2726, 1}, {0xF993, 2727, 1}, {0xF994, 2728, 1},
+    {0xF995, 2729, 1}, {0xF996, 2730, 1}, {0xF997, 2731, 1},
+    {0xF998, 2732, 1}, {0xF999, 2733, 1}, {0xF99A, 2734, 1},
+    {0xF99B, 2735, 1}, {0xF99C, 2736, 1}, {0xF99D, 2737, 1},
+    {0xF99E, 2738, 1}, {0xF99F, 2739, 1}, {0xF9A0, 2740, 1},
+    {0xF9A1, 2741, 1}, {0xF9A2, 2742, 1}, {0xF9A3, 2743, 1},
+    {0xF9A4, 2744, 1}, {0xF9A5, 2745, 1}, {0xF9A6, 2746, 1},
+    {0xF9A7, 2747, 1}, {0xF9A8, 2748, 1}, {0xF9A9, 2749, 1},
+    {0xF9AA, 2750, 1}, {0xF9AB, 2751, 1}, {0xF9AC, 2752, 1},
+    {0xF9AD, 2753, 1}, {0xF9AE, 2754, 1}, {0xF9AF, 2755, 1},
+    {0xF9B0, 2756, 1}, {0xF9B1, 2757, 1}, {0xF9B2, 2758, 1},
+    {0xF9B3, 2759, 1}, {0xF9B4, 2760, 1}, {0xF9B5, 2761, 1},
+    {0xF9B6, 2762, 1}, {0xF9B7, 2763, 1}, {0xF9B8, 2764, 1},
+    {0xF9B9, 2765, 1}, {0xF9BA, 2766, 1}, {0xF9BB, 2767, 1},
+    {0xF9BC, 2768, 1}, {0xF9BD, 2769, 1}, {0xF9BE, 2770, 1},
+    {0xF9BF, 2771, 1}, {0xF9C0, 2772, 1}, {0xF9C1, 2773, 1},
+    {0xF9C2, 2774, 1}, {0xF9C3, 2775, 1}, {0xF9C4, 2776, 1},
+    {0xF9C5, 2777, 1}, {0xF9C6, 2778, 1}, {0xF9C7, 2779, 1},
+    {0xF9C8, 2780, 1}, {0xF9C9, 2781, 1}, {0xF9CA, 2782, 1},
+    {0xF9CB, 2783, 1}, {0xF9CC, 2784, 1}, {0xF9CD, 2785, 1},
+    {0xF9CE, 2786, 1}, {0xF9CF, 2787, 1}, {0xF9D0, 2788, 1},
+    {0xF9D1, 2789, 1}, {0xF9D2, 2790, 1}, {0xF9D3, 2791, 1},
+    {0xF9D4, 2792, 1}, {0xF9D5, 2793, 1}, {0xF9D6, 2794, 1},
+    {0xF9D7, 2795, 1}, {0xF9D8, 2796, 1}, {0xF9D9, 2797, 1},
+    {0xF9DA, 2798, 1}, {0xF9DB, 2799, 1}, {0xF9DC, 2800, 1},
+    {0xF9DD, 2801, 1}, {0xF9DE, 2802, 1}, {0xF9DF, 2803, 1},
+    {0xF9E0, 2804, 1}, {0xF9E1, 2805, 1}, {0xF9E2, 2806, 1},
+    {0xF9E3, 2807, 1}, {0xF9E4, 2808, 1}, {0xF9E5, 2809, 1},
+    {0xF9E6, 2810, 1}, {0xF9E7, 2811, 1}, {0xF9E8, 2812, 1},
+    {0xF9E9, 2813, 1}, {0xF9EA, 2814, 1}, {0xF9EB, 2815, 1},
+    {0xF9EC, 2816, 1}, {0xF9ED, 2817, 1}, {0xF9EE, 2818, 1},
+    {0xF9EF, 2819, 1}, {0xF9F0, 2820, 1}, {0xF9F1, 2821, 1},
+    {0xF9F2, 2822, 1}, {0xF9F3, 2823, 1}, {0xF9F4, 2824, 1},
+    {0xF9F5, 2825, 1}, {0xF9F6, 2826, 1}, {0xF9F7, 2827, 1},
+    {0xF9F8, 2828, 1}, {0xF9F9, 2829, 1}, {0xF9FA, 2830, 1},
+    {0xF9FB, 2831, 1}, {0xF9FC, 2832, 1}, {0xF9FD, 2833, 1},
+    {0xF9FE, 2834, 1}, {0xF9FF, 2835, 1}, {0xFA00, 2836, 1},
+    {0xFA01, 2837, 1}, {0xFA02, 2838, 1}, {0xFA03, 2839, 1},
+    {0xFA04, 2840, 1}, {0xFA05, 2841, 1}, {0xFA06, 2842, 1},
+    {0xFA07, 2843, 1}, {0xFA08, 2844, 1}, {0xFA09, 2845, 1},
+    {0xFA0A, 2846, 1}, {0xFA0B, 2847, 1}, {0xFA0C, 2848, 1},
+    {0xFA0D, 2849, 1}, {0xFA10, 2850, 1}, {0xFA12, 2851, 1},
+    {0xFA15, 2852, 1}, {0xFA16, 2853, 1}, {0xFA17, 2854, 1},
+    {0xFA18, 2855, 1}, {0xFA19, 2856, 1}, {0xFA1A, 2857, 1},
+    {0xFA1B, 2858, 1}, {0xFA1C, 2859, 1}, {0xFA1D, 2860, 1},
+    {0xFA1E, 2861, 1}, {0xFA20, 2862, 1}, {0xFA22, 2863, 1},
+    {0xFA25, 2864, 1}, {0xFA26, 2865, 1}, {0xFA2A, 2866, 1},
+    {0xFA2B, 2867, 1}, {0xFA2C, 2868, 1}, {0xFA2D, 2869, 1},
+    {0xFA2E, 2870, 1}, {0xFA2F, 2871, 1}, {0xFA30, 2872, 1},
+    {0xFA31, 2873, 1}, {0xFA32, 2874, 1}, {0xFA33, 2875, 1},
+    {0xFA34, 2876, 1}, {0xFA35, 2877, 1}, {0xFA36, 2878, 1},
+    {0xFA37, 2879, 1}, {0xFA38, 2880, 1}, {0xFA39, 2881, 1},
+    {0xFA3A, 2882, 1}, {0xFA3B, 2883, 1}, {0xFA3C, 2884, 1},
+    {0xFA3D, 2885, 1}, {0xFA3E, 2886, 1}, {0xFA3F, 2887, 1},
+    {0xFA40, 2888, 1}, {0xFA41, 2889, 1}, {0xFA42, 2890, 1},
+    {0xFA43, 2891, 1}, {0xFA44, 2892, 1}, {0xFA45, 2893, 1},
+    {0xFA46, 2894, 1}, {0xFA47, 2895, 1}, {0xFA48, 2896, 1},
+    {0xFA49, 2897, 1}, {0xFA4A, 2898, 1}, {0xFA4B, 2899, 1},
+    {0xFA4C, 2900, 1}, {0xFA4D, 2901, 1}, {0xFA4E, 2902, 1},
+    {0xFA4F, 2903, 1}, {0xFA50, 2904, 1}, {0xFA51, 2905, 1},
+    {0xFA52, 2906, 1}, {0xFA53, 2907, 1}, {0xFA54, 2908, 1},
+    {0xFA55, 2909, 1}, {0xFA56, 2910, 1}, {0xFA57, 2911, 1},
+    {0xFA58, 2912, 1}, {0xFA59, 2913, 1}, {0xFA5A, 2914, 1},
+    {0xFA5B, 2915, 1}, {0xFA5C, 2916, 1}, {0xFA5D, 2917, 1},
+    {0xFA5E, 2918, 1}, {0xFA5F, 2919, 1}, {0xFA60, 2920, 1},
+    {0xFA61, 2921, 1}, {0xFA62, 2922, 1}, {0xFA63, 2923, 1},
+    {0xFA64, 2924, 1}, {0xFA65, 2925, 1}, {0xFA66, 2926, 1},
+    {0xFA67, 2927, 1}, {0xFA68, 2928, 1}, {0xFA69, 2929, 1},
+    {0xFA6A, 2930, 1}, {0xFA6B, 2931, 1}, {0xFA6C, 2932, 1},
+    {0xFA6D, 2933, 1}, {0xFA70, 2934, 1}, {0xFA71, 2935, 1},
+    {0xFA72, 2936, 1}, {0xFA73, 2937, 1}, {0xFA74, 2938, 1},
+    {0xFA75, 2939, 1}, {0xFA76, 2940, 1}, {0xFA77, 2941, 1},
+    {0xFA78, 2942, 1}, {0xFA79, 2943, 1}, {0xFA7A, 2944, 1},
+    {0xFA7B, 2945, 1}, {0xFA7C, 2946, 1}, {0xFA7D, 2947, 1},
+    {0xFA7E, 2948, 1}, {0xFA7F, 2949, 1}, {0xFA80, 2950, 1},
+    {0xFA81, 2951, 1}, {0xFA82, 2952, 1}, {0xFA83, 2953, 1},
+    {0xFA84, 2954, 1}, {0xFA85, 2955, 1}, {0xFA86, 2956, 1},
+    {0xFA87, 2957, 1}, {0xFA88, 2958, 1}, {0xFA89, 2959, 1},
+    {0xFA8A, 2960, 1}, {0xFA8B, 2961, 1}, {0xFA8C, 2962, 1},
+    {0xFA8D, 2963, 1}, {0xFA8E, 2964, 1}, {0xFA8F, 2965, 1},
+    {0xFA90, 2966, 1}, {0xFA91, 2967, 1}, {0xFA92, 2968, 1},
+    {0xFA93, 2969, 1}, {0xFA94, 2970, 1}, {0xFA95, 2971, 1},
+    {0xFA96, 2972, 1}, {0xFA97, 2973, 1}, {0xFA98, 2974, 1},
+    {0xFA99, 2975, 1}, {0xFA9A, 2976, 1}, {0xFA9B, 2977, 1},
+    {0xFA9C, 2978, 1}, {0xFA9D, 2979, 1}, {0xFA9E, 2980, 1},
+    {0xFA9F, 2981, 1}, {0xFAA0, 2982, 1}, {0xFAA1, 2983, 1},
+    {0xFAA2, 2984, 1}, {0xFAA3, 2985, 1}, {0xFAA4, 2986, 1},
+    {0xFAA5, 2987, 1}, {0xFAA6, 2988, 1}, {0xFAA7, 2989, 1},
+    {0xFAA8, 2990, 1}, {0xFAA9, 2991, 1}, {0xFAAA, 2992, 1},
+    {0xFAAB, 2993, 1}, {0xFAAC, 2994, 1}, {0xFAAD, 2995, 1},
+    {0xFAAE, 2996, 1}, {0xFAAF, 2997, 1}, {0xFAB0, 2998, 1},
+    {0xFAB1, 2999, 1}, {0xFAB2, 3000, 1}, {0xFAB3, 3001, 1},
+    {0xFAB4, 3002, 1}, {0xFAB5, 3003, 1}, {0xFAB6, 3004, 1},
+    {0xFAB7, 3005, 1}, {0xFAB8, 3006, 1}, {0xFAB9, 3007, 1},
+    {0xFABA, 3008, 1}, {0xFABB, 3009, 1}, {0xFABC, 3010, 1},
+    {0xFABD, 3011, 1}, {0xFABE, 3012, 1}, {0xFABF, 3013, 1},
+    {0xFAC0, 3014, 1}, {0xFAC1, 3015, 1}, {0xFAC2, 3016, 1},
+    {0xFAC3, 3017, 1}, {0xFAC4, 3018, 1}, {0xFAC5, 3019, 1},
+    {0xFAC6, 3020, 1}, {0xFAC7, 3021, 1}, {0xFAC8, 3022, 1},
+    {0xFAC9, 3023, 1}, {0xFACA, 3024, 1}, {0xFACB, 3025, 1},
+    {0xFACC, 3026, 1}, {0xFACD, 3027, 1}, {0xFACE, 3028, 1},
+    {0xFACF, 3029, 1}, {0xFAD0, 3030, 1}, {0xFAD1, 3031, 1},
+    {0xFAD2, 3032, 1}, {0xFAD3, 3033, 1}, {0xFAD4, 3034, 1},
+    {0xFAD5, 3035, 1}, {0xFAD6, 3036, 1}, {0xFAD7, 3037, 1},
+    {0xFAD8, 3038, 1}, {0xFAD9, 3039, 1}, {0xFB00, 3040, 2},
+    {0xFB01, 3042, 2}, {0xFB02, 3044, 2}, {0xFB03, 3046, 3},
+    {0xFB04, 3049, 3}, {0xFB05, 3052, 2}, {0xFB06, 3054, 2},
+    {0xFB13, 3056, 2}, {0xFB14, 3058, 2}, {0xFB15, 3060, 2},
+    {0xFB16, 3062, 2}, {0xFB17, 3064, 2}, {0xFB1D, 3066, 2},
+    {0xFB1F, 3068, 2}, {0xFB20, 3070, 1}, {0xFB21, 3071, 1},
+    {0xFB22, 3072, 1}, {0xFB23, 3073, 1}, {0xFB24, 3074, 1},
+    {0xFB25, 3075, 1}, {0xFB26, 3076, 1}, {0xFB27, 3077, 1},
+    {0xFB28, 3078, 1}, {0xFB2A, 3079, 2}, {0xFB2B, 3081, 2},
+    {0xFB2C, 3083, 3}, {0xFB2D, 3086, 3}, {0xFB2E, 3089, 2},
+    {0xFB2F, 3091, 2}, {0xFB30, 3093, 2}, {0xFB31, 3095, 2},
+    {0xFB32, 3097, 2}, {0xFB33, 3099, 2}, {0xFB34, 3101, 2},
+    {0xFB35, 3103, 2}, {0xFB36, 3105, 2}, {0xFB38, 3107, 2},
+    {0xFB39, 3109, 2}, {0xFB3A, 3111, 2}, {0xFB3B, 3113, 2},
+    {0xFB3C, 3115, 2}, {0xFB3E, 3117, 2}, {0xFB40, 3119, 2},
+    {0xFB41, 3121, 2}, {0xFB43, 3123, 2}, {0xFB44, 3125, 2},
+    {0xFB46, 3127, 2}, {0xFB47, 3129, 2}, {0xFB48, 3131, 2},
+    {0xFB49, 3133, 2}, {0xFB4A, 3135, 2}, {0xFB4B, 3137, 2},
+    {0xFB4C, 3139, 2}, {0xFB4D, 3141, 2}, {0xFB4E, 3143, 2},
+    {0xFB4F, 3145, 2}, {0xFB50, 3147, 1}, {0xFB51, 3148, 1},
+    {0xFB52, 3149, 1}, {0xFB53, 3150, 1}, {0xFB54, 3151, 1},
+    {0xFB55, 3152, 1}, {0xFB56, 3153, 1}, {0xFB57, 3154, 1},
+    {0xFB58, 3155, 1}, {0xFB59, 3156, 1}, {0xFB5A, 3157, 1},
+    {0xFB5B, 3158, 1}, {0xFB5C, 3159, 1}, {0xFB5D, 3160, 1},
+    {0xFB5E, 3161, 1}, {0xFB5F, 3162, 1}, {0xFB60, 3163, 1},
+    {0xFB61, 3164, 1}, {0xFB62, 3165, 1}, {0xFB63, 3166, 1},
+    {0xFB64, 3167, 1}, {0xFB65, 3168, 1}, {0xFB66, 3169, 1},
+    {0xFB67, 3170, 1}, {0xFB68, 3171, 1}, {0xFB69, 3172, 1},
+    {0xFB6A, 3173, 1}, {0xFB6B, 3174, 1}, {0xFB6C, 3175, 1},
+    {0xFB6D, 3176, 1}, {0xFB6E, 3177, 1}, {0xFB6F, 3178, 1},
+    {0xFB70, 3179, 1}, {0xFB71, 3180, 1}, {0xFB72, 3181, 1},
+    {0xFB73, 3182, 1}, {0xFB74, 3183, 1}, {0xFB75, 3184, 1},
+    {0xFB76, 3185, 1}, {0xFB77, 3186, 1}, {0xFB78, 3187, 1},
+    {0xFB79, 3188, 1}, {0xFB7A, 3189, 1}, {0xFB7B, 3190, 1},
+    {0xFB7C, 3191, 1}, {0xFB7D, 3192, 1}, {0xFB7E, 3193, 1},
+    {0xFB7F, 3194, 1}, {0xFB80, 3195, 1}, {0xFB81, 3196, 1},
+    {0xFB82, 3197, 1}, {0xFB83, 3198, 1}, {0xFB84, 3199, 1},
+    {0xFB85, 3200, 1}, {0xFB86, 3201, 1}, {0xFB87, 3202, 1},
+    {0xFB88, 3203, 1}, {0xFB89, 3204, 1}, {0xFB8A, 3205, 1},
+    {0xFB8B, 3206, 1}, {0xFB8C, 3207, 1}, {0xFB8D, 3208, 1},
+    {0xFB8E, 3209, 1}, {0xFB8F, 3210, 1}, {0xFB90, 3211, 1},
+    {0xFB91, 3212, 1}, {0xFB92, 3213, 1}, {0xFB93, 3214, 1},
+    {0xFB94, 3215, 1}, {0xFB95, 3216, 1}, {0xFB96, 3217, 1},
+    {0xFB97, 3218, 1}, {0xFB98, 3219, 1}, {0xFB99, 3220, 1},
+    {0xFB9A, 3221, 1}, {0xFB9B, 3222, 1}, {0xFB9C, 3223, 1},
+    {0xFB9D, 3224, 1}, {0xFB9E, 3225, 1}, {0xFB9F, 3226, 1},
+    {0xFBA0, 3227, 1}, {0xFBA1, 3228, 1}, {0xFBA2, 3229, 1},
+    {0xFBA3, 3230, 1}, {0xFBA4, 3231, 2}, {0xFBA5, 3233, 2},
+    {0xFBA6, 3235, 1}, {0xFBA7, 3236, 1}, {0xFBA8, 3237, 1},
+    {0xFBA9, 3238, 1}, {0xFBAA, 3239, 1}, {0xFBAB, 3240, 1},
+    {0xFBAC, 3241, 1}, {0xFBAD, 3242, 1}, {0xFBAE, 3243, 1},
+    {0xFBAF, 3244, 1}, {0xFBB0, 3245, 2}, {0xFBB1, 3247, 2},
+    {0xFBD3, 3249, 1}, {0xFBD4, 3250, 1}, {0xFBD5, 3251, 1},
+    {0xFBD6, 3252, 1}, {0xFBD7, 3253, 1}, {0xFBD8, 3254, 1},
+    {0xFBD9, 3255, 1}, {0xFBDA, 3256, 1}, {0xFBDB, 3257, 1},
+    {0xFBDC, 3258, 1}, {0xFBDD, 3259, 2}, {0xFBDE, 3261, 1},
+    {0xFBDF, 3262, 1}, {0xFBE0, 3263, 1}, {0xFBE1, 3264, 1},
+    {0xFBE2, 3265, 1}, {0xFBE3, 3266, 1}, {0xFBE4, 3267, 1},
+    {0xFBE5, 3268, 1}, {0xFBE6, 3269, 1}, {0xFBE7, 3270, 1},
+    {0xFBE8, 3271, 1}, {0xFBE9, 3272, 1}, {0xFBEA, 3273, 3},
+    {0xFBEB, 3276, 3}, {0xFBEC, 3279, 3}, {0xFBED, 3282, 3},
+    {0xFBEE, 3285, 3}, {0xFBEF, 3288, 3}, {0xFBF0, 3291, 3},
+    {0xFBF1, 3294, 3}, {0xFBF2, 3297, 3}, {0xFBF3, 3300, 3},
+    {0xFBF4, 3303, 3}, {0xFBF5, 3306, 3}, {0xFBF6, 3309, 3},
+    {0xFBF7, 3312, 3}, {0xFBF8, 3315, 3}, {0xFBF9, 3318, 3},
+    {0xFBFA, 3321, 3}, {0xFBFB, 3324, 3}, {0xFBFC, 3327, 1},
+    {0xFBFD, 3328, 1}, {0xFBFE, 3329, 1}, {0xFBFF, 3330, 1},
+    {0xFC00, 3331, 3}, {0xFC01, 3334, 3}, {0xFC02, 3337, 3},
+    {0xFC03, 3340, 3}, {0xFC04, 3343, 3}, {0xFC05, 3346, 2},
+    {0xFC06, 3348, 2}, {0xFC07, 3350, 2}, {0xFC08, 3352, 2},
+    {0xFC09, 3354, 2}, {0xFC0A, 3356, 2}, {0xFC0B, 3358, 2},
+    {0xFC0C, 3360, 2}, {0xFC0D, 3362, 2}, {0xFC0E, 3364, 2},
+    {0xFC0F, 3366, 2}, {0xFC10, 3368, 2}, {0xFC11, 3370, 2},
+    {0xFC12, 3372, 2}, {0xFC13, 3374, 2}, {0xFC14, 3376, 2},
+    {0xFC15, 3378, 2}, {0xFC16, 3380, 2}, {0xFC17, 3382, 2},
+    {0xFC18, 3384, 2}, {0xFC19, 3386, 2}, {0xFC1A, 3388, 2},
+    {0xFC1B, 3390, 2}, {0xFC1C, 3392, 2}, {0xFC1D, 3394, 2},
+    {0xFC1E, 3396, 2}, {0xFC1F, 3398, 2}, {0xFC20, 3400, 2},
+    {0xFC21, 3402, 2}, {0xFC22, 3404, 2}, {0xFC23, 3406, 2},
+    {0xFC24, 3408, 2}, {0xFC25, 3410, 2}, {0xFC26, 3412, 2},
+    {0xFC27, 3414, 2}, {0xFC28, 3416, 2}, {0xFC29, 3418, 2},
+    {0xFC2A, 3420, 2}, {0xFC2B, 3422, 2}, {0xFC2C, 3424, 2},
+    {0xFC2D, 3426, 2}, {0xFC2E, 3428, 2}, {0xFC2F, 3430, 2},
+    {0xFC30, 3432, 2}, {0xFC31, 3434, 2}, {0xFC32, 3436, 2},
+    {0xFC33, 3438, 2}, {0xFC34, 3440, 2}, {0xFC35, 3442, 2},
+    {0xFC36, 3444, 2}, {0xFC37, 3446, 2}, {0xFC38, 3448, 2},
+    {0xFC39, 3450, 2}, {0xFC3A, 3452, 2}, {0xFC3B, 3454, 2},
+    {0xFC3C, 3456, 2}, {0xFC3D, 3458, 2}, {0xFC3E, 3460, 2},
+    {0xFC3F, 3462, 2}, {0xFC40, 3464, 2}, {0xFC41, 3466, 2},
+    {0xFC42, 3468, 2}, {0xFC43, 3470, 2}, {0xFC44, 3472, 2},
+    {0xFC45, 3474, 2}, {0xFC46, 3476, 2}, {0xFC47, 3478, 2},
+    {0xFC48, 3480, 2}, {0xFC49, 3482, 2}, {0xFC4A, 3484, 2},
+    {0xFC4B, 3486, 2}, {0xFC4C, 3488, 2}, {0xFC4D, 3490, 2},
+    {0xFC4E, 3492, 2}, {0xFC4F, 3494, 2}, {0xFC50, 3496, 2},
+    {0xFC51, 3498, 2}, {0xFC52, 3500, 2}, {0xFC53, 3502, 2},
+    {0xFC54, 3504, 2}, {0xFC55, 3506, 2}, {0xFC56, 3508, 2},
+    {0xFC57, 3510, 2}, {0xFC58, 3512, 2}, {0xFC59, 3514, 2},
+    {0xFC5A, 3516, 2}, {0xFC5B, 3518, 2}, {0xFC5C, 3520, 2},
+    {0xFC5D, 3522, 2}, {0xFC64, 3524, 3}, {0xFC65, 3527, 3},
+    {0xFC66, 3530, 3}, {0xFC67, 3533, 3}, {0xFC68, 3536, 3},
+    {0xFC69, 3539, 3}, {0xFC6A, 3542, 2}, {0xFC6B, 3544, 2},
+    {0xFC6C, 3546, 2}, {0xFC6D, 3548, 2}, {0xFC6E, 3550, 2},
+    {0xFC6F, 3552, 2}, {0xFC70, 3554, 2}, {0xFC71, 3556, 2},
+    {0xFC72, 3558, 2}, {0xFC73, 3560, 2}, {0xFC74, 3562, 2},
+    {0xFC75, 3564, 2}, {0xFC76, 3566, 2}, {0xFC77, 3568, 2},
+    {0xFC78, 3570, 2}, {0xFC79, 3572, 2}, {0xFC7A, 3574, 2},
+    {0xFC7B, 3576, 2}, {0xFC7C, 3578, 2}, {0xFC7D, 3580, 2},
+    {0xFC7E, 3582, 2}, {0xFC7F, 3584, 2}, {0xFC80, 3586, 2},
+    {0xFC81, 3588, 2}, {0xFC82, 3590, 2}, {0xFC83, 3592, 2},
+    {0xFC84, 3594, 2}, {0xFC85, 3596, 2}, {0xFC86, 3598, 2},
+    {0xFC87, 3600, 2}, {0xFC88, 3602, 2}, {0xFC89, 3604, 2},
+    {0xFC8A, 3606, 2}, {0xFC8B, 3608, 2}, {0xFC8C, 3610, 2},
+    {0xFC8D, 3612, 2}, {0xFC8E, 3614, 2}, {0xFC8F, 3616, 2},
+    {0xFC90, 3618, 2}, {0xFC91, 3620, 2}, {0xFC92, 3622, 2},
+    {0xFC93, 3624, 2}, {0xFC94, 3626, 2}, {0xFC95, 3628, 2},
+    {0xFC96, 3630, 2}, {0xFC97, 3632, 3}, {0xFC98, 3635, 3},
+    {0xFC99, 3638, 3}, {0xFC9A, 3641, 3}, {0xFC9B, 3644, 3},
+    {0xFC9C, 3647, 2}, {0xFC9D, 3649, 2}, {0xFC9E, 3651, 2},
+    {0xFC9F, 3653, 2}, {0xFCA0, 3655, 2}, {0xFCA1, 3657, 2},
+    {0xFCA2, 3659, 2}, {0xFCA3, 3661, 2}, {0xFCA4, 3663, 2},
+    {0xFCA5, 3665, 2}, {0xFCA6, 3667, 2}, {0xFCA7, 3669, 2},
+    {0xFCA8, 3671, 2}, {0xFCA9, 3673, 2}, {0xFCAA, 3675, 2},
+    {0xFCAB, 3677, 2}, {0xFCAC, 3679, 2}, {0xFCAD, 3681, 2},
+    {0xFCAE, 3683, 2}, {0xFCAF, 3685, 2}, {0xFCB0, 3687, 2},
+    {0xFCB1, 3689, 2}, {0xFCB2, 3691, 2}, {0xFCB3, 3693, 2},
+    {0xFCB4, 3695, 2}, {0xFCB5, 3697, 2}, {0xFCB6, 3699, 2},
+    {0xFCB7, 3701, 2}, {0xFCB8, 3703, 2}, {0xFCB9, 3705, 2},
+    {0xFCBA, 3707, 2}, {0xFCBB, 3709, 2}, {0xFCBC, 3711, 2},
+    {0xFCBD, 3713, 2}, {0xFCBE, 3715, 2}, {0xFCBF, 3717, 2},
+    {0xFCC0, 3719, 2}, {0xFCC1, 3721, 2}, {0xFCC2, 3723, 2},
+    {0xFCC3, 3725, 2}, {0xFCC4, 3727, 2}, {0xFCC5, 3729, 2},
+    {0xFCC6, 3731, 2}, {0xFCC7, 3733, 2}, {0xFCC8, 3735, 2},
+    {0xFCC9, 3737, 2}, {0xFCCA, 3739, 2}, {0xFCCB, 3741, 2},
+    {0xFCCC, 3743, 2}, {0xFCCD, 3745, 2}, {0xFCCE, 3747, 2},
+    {0xFCCF, 3749, 2}, {0xFCD0, 3751, 2}, {0xFCD1, 3753, 2},
+    {0xFCD2, 3755, 2}, {0xFCD3, 3757, 2}, {0xFCD4, 3759, 2},
+    {0xFCD5, 3761, 2}, {0xFCD6, 3763, 2}, {0xFCD7, 3765, 2},
+    {0xFCD8, 3767, 2}, {0xFCD9, 3769, 2}, {0xFCDA, 3771, 2},
+    {0xFCDB, 3773, 2}, {0xFCDC, 3775, 2}, {0xFCDD, 3777, 2},
+    {0xFCDE, 3779, 2}, {0xFCDF, 3781, 3}, {0xFCE0, 3784, 3},
+    {0xFCE1, 3787, 2}, {0xFCE2, 3789, 2}, {0xFCE3, 3791, 2},
+    {0xFCE4, 3793, 2}, {0xFCE5, 3795, 2}, {0xFCE6, 3797, 2},
+    {0xFCE7, 3799, 2}, {0xFCE8, 3801, 2}, {0xFCE9, 3803, 2},
+    {0xFCEA, 3805, 2}, {0xFCEB, 3807, 2}, {0xFCEC, 3809, 2},
+    {0xFCED, 3811, 2}, {0xFCEE, 3813, 2}, {0xFCEF, 3815, 2},
+    {0xFCF0, 3817, 2}, {0xFCF1, 3819, 2}, {0xFCF2, 3821, 3},
+    {0xFCF3, 3824, 3}, {0xFCF4, 3827, 3}, {0xFCF5, 3830, 2},
+    {0xFCF6, 3832, 2}, {0xFCF7, 3834, 2}, {0xFCF8, 3836, 2},
+    {0xFCF9, 3838, 2}, {0xFCFA, 3840, 2}, {0xFCFB, 3842, 2},
+    {0xFCFC, 3844, 2}, {0xFCFD, 3846, 2}, {0xFCFE, 3848, 2},
+    {0xFCFF, 3850, 2}, {0xFD00, 3852, 2}, {0xFD01, 3854, 2},
+    {0xFD02, 3856, 2}, {0xFD03, 3858, 2}, {0xFD04, 3860, 2},
+    {0xFD05, 3862, 2}, {0xFD06, 3864, 2}, {0xFD07, 3866, 2},
+    {0xFD08, 3868, 2}, {0xFD09, 3870, 2}, {0xFD0A, 3872, 2},
+    {0xFD0B, 3874, 2}, {0xFD0C, 3876, 2}, {0xFD0D, 3878, 2},
+    {0xFD0E, 3880, 2}, {0xFD0F, 3882, 2}, {0xFD10, 3884, 2},
+    {0xFD11, 3886, 2}, {0xFD12, 3888, 2}, {0xFD13, 3890, 2},
+    {0xFD14, 3892, 2}, {0xFD15, 3894, 2}, {0xFD16, 3896, 2},
+    {0xFD17, 3898, 2}, {0xFD18, 3900, 2}, {0xFD19, 3902, 2},
+    {0xFD1A, 3904, 2}, {0xFD1B, 3906, 2}, {0xFD1C, 3908, 2},
+    {0xFD1D, 3910, 2}, {0xFD1E, 3912, 2}, {0xFD1F, 3914, 2},
+    {0xFD20, 3916, 2}, {0xFD21, 3918, 2}, {0xFD22, 3920, 2},
+    {0xFD23, 3922, 2}, {0xFD24, 3924, 2}, {0xFD25, 3926, 2},
+    {0xFD26, 3928, 2}, {0xFD27, 3930, 2}, {0xFD28, 3932, 2},
+    {0xFD29, 3934, 2}, {0xFD2A, 3936, 2}, {0xFD2B, 3938, 2},
+    {0xFD2C, 3940, 2}, {0xFD2D, 3942, 2}, {0xFD2E, 3944, 2},
+    {0xFD2F, 3946, 2}, {0xFD30, 3948, 2}, {0xFD31, 3950, 2},
+    {0xFD32, 3952, 2}, {0xFD33, 3954, 2}, {0xFD34, 3956, 2},
+    {0xFD35, 3958, 2}, {0xFD36, 3960, 2}, {0xFD37, 3962, 2},
+    {0xFD38, 3964, 2}, {0xFD39, 3966, 2}, {0xFD3A, 3968, 2},
+    {0xFD3B, 3970, 2}, {0xFD3C, 3972, 2}, {0xFD3D, 3974, 2},
+    {0xFD50, 3976, 3}, {0xFD51, 3979, 3}, {0xFD52, 3982, 3},
+    {0xFD53, 3985, 3}, {0xFD54, 3988, 3}, {0xFD55, 3991, 3},
+    {0xFD56, 3994, 3}, {0xFD57, 3997, 3}, {0xFD58, 4000, 3},
+    {0xFD59, 4003, 3}, {0xFD5A, 4006, 3}, {0xFD5B, 4009, 3},
+    {0xFD5C, 4012, 3}, {0xFD5D, 4015, 3}, {0xFD5E, 4018, 3},
+    {0xFD5F, 4021, 3}, {0xFD60, 4024, 3}, {0xFD61, 4027, 3},
+    {0xFD62, 4030, 3}, {0xFD63, 4033, 3}, {0xFD64, 4036, 3},
+    {0xFD65, 4039, 3}, {0xFD66, 4042, 3}, {0xFD67, 4045, 3},
+    {0xFD68, 4048, 3}, {0xFD69, 4051, 3}, {0xFD6A, 4054, 3},
+    {0xFD6B, 4057, 3}, {0xFD6C, 4060, 3}, {0xFD6D, 4063, 3},
+    {0xFD6E, 4066, 3}, {0xFD6F, 4069, 3}, {0xFD70, 4072, 3},
+    {0xFD71, 4075, 3}, {0xFD72, 4078, 3}, {0xFD73, 4081, 3},
+    {0xFD74, 4084, 3}, {0xFD75, 4087, 3}, {0xFD76, 4090, 3},
+    {0xFD77, 4093, 3}, {0xFD78, 4096, 3}, {0xFD79, 4099, 3},
+    {0xFD7A, 4102, 3}, {0xFD7B, 4105, 3}, {0xFD7C, 4108, 3},
+    {0xFD7D, 4111, 3}, {0xFD7E, 4114, 3}, {0xFD7F, 4117, 3},
+    {0xFD80, 4120, 3}, {0xFD81, 4123, 3}, {0xFD82, 4126, 3},
+    {0xFD83, 4129, 3}, {0xFD84, 4132, 3}, {0xFD85, 4135, 3},
+    {0xFD86, 4138, 3}, {0xFD87, 4141, 3}, {0xFD88, 4144, 3},
+    {0xFD89, 4147, 3}, {0xFD8A, 4150, 3}, {0xFD8B, 4153, 3},
+    {0xFD8C, 4156, 3}, {0xFD8D, 4159, 3}, {0xFD8E, 4162, 3},
+    {0xFD8F, 4165, 3}, {0xFD92, 4168, 3}, {0xFD93, 4171, 3},
+    {0xFD94, 4174, 3}, {0xFD95, 4177, 3}, {0xFD96, 4180, 3},
+    {0xFD97, 4183, 3}, {0xFD98, 4186, 3}, {0xFD99, 4189, 3},
+    {0xFD9A, 4192, 3}, {0xFD9B, 4195, 3}, {0xFD9C, 4198, 3},
+    {0xFD9D, 4201, 3}, {0xFD9E, 4204, 3}, {0xFD9F, 4207, 3},
+    {0xFDA0, 4210, 3}, {0xFDA1, 4213, 3}, {0xFDA2, 4216, 3},
+    {0xFDA3, 4219, 3}, {0xFDA4, 4222, 3}, {0xFDA5, 4225, 3},
+    {0xFDA6, 4228, 3}, {0xFDA7, 4231, 3}, {0xFDA8, 4234, 3},
+    {0xFDA9, 4237, 3}, {0xFDAA, 4240, 3}, {0xFDAB, 4243, 3},
+    {0xFDAC, 4246, 3}, {0xFDAD, 4249, 3}, {0xFDAE, 4252, 3},
+    {0xFDAF, 4255, 3}, {0xFDB0, 4258, 3}, {0xFDB1, 4261, 3},
+    {0xFDB2, 4264, 3}, {0xFDB3, 4267, 3}, {0xFDB4, 4270, 3},
+    {0xFDB5, 4273, 3}, {0xFDB6, 4276, 3}, {0xFDB7, 4279, 3},
+    {0xFDB8, 4282, 3}, {0xFDB9, 4285, 3}, {0xFDBA, 4288, 3},
+    {0xFDBB, 4291, 3}, {0xFDBC, 4294, 3}, {0xFDBD, 4297, 3},
+    {0xFDBE, 4300, 3}, {0xFDBF, 4303, 3}, {0xFDC0, 4306, 3},
+    {0xFDC1, 4309, 3}, {0xFDC2, 4312, 3}, {0xFDC3, 4315, 3},
+    {0xFDC4, 4318, 3}, {0xFDC5, 4321, 3}, {0xFDC6, 4324, 3},
+    {0xFDC7, 4327, 3}, {0xFDF0, 4330, 3}, {0xFDF1, 4333, 3},
+    {0xFDF2, 4336, 4}, {0xFDF3, 4340, 4}, {0xFDF4, 4344, 4},
+    {0xFDF5, 4348, 4}, {0xFDF6, 4352, 4}, {0xFDF7, 4356, 4},
+    {0xFDF8, 4360, 4}, {0xFDF9, 4364, 3}, {0xFE33, 4367, 1},
+    {0xFE34, 4368, 1}, {0xFE4D, 4369, 1}, {0xFE4E, 4370, 1},
+    {0xFE4F, 4371, 1}, {0xFE71, 4372, 2}, {0xFE77, 4374, 2},
+    {0xFE79, 4376, 2}, {0xFE7B, 4378, 2}, {0xFE7D, 4380, 2},
+    {0xFE7F, 4382, 2}, {0xFE80, 4384, 1}, {0xFE81, 4385, 2},
+    {0xFE82, 4387, 2}, {0xFE83, 4389, 2}, {0xFE84, 4391, 2},
+    {0xFE85, 4393, 2}, {0xFE86, 4395, 2}, {0xFE87, 4397, 2},
+    {0xFE88, 4399, 2}, {0xFE89, 4401, 2}, {0xFE8A, 4403, 2},
+    {0xFE8B, 4405, 2}, {0xFE8C, 4407, 2}, {0xFE8D, 4409, 1},
+    {0xFE8E, 4410, 1}, {0xFE8F, 4411, 1}, {0xFE90, 4412, 1},
+    {0xFE91, 4413, 1}, {0xFE92, 4414, 1}, {0xFE93, 4415, 1},
+    {0xFE94, 4416, 1}, {0xFE95, 4417, 1}, {0xFE96, 4418, 1},
+    {0xFE97, 4419, 1}, {0xFE98, 4420, 1}, {0xFE99, 4421, 1},
+    {0xFE9A, 4422, 1}, {0xFE9B, 4423, 1}, {0xFE9C, 4424, 1},
+    {0xFE9D, 4425, 1}, {0xFE9E, 4426, 1}, {0xFE9F, 4427, 1},
+    {0xFEA0, 4428, 1}, {0xFEA1, 4429, 1}, {0xFEA2, 4430, 1},
+    {0xFEA3, 4431, 1}, {0xFEA4, 4432, 1}, {0xFEA5, 4433, 1},
+    {0xFEA6, 4434, 1}, {0xFEA7, 4435, 1}, {0xFEA8, 4436, 1},
+    {0xFEA9, 4437, 1}, {0xFEAA, 4438, 1}, {0xFEAB, 4439, 1},
+    {0xFEAC, 4440, 1}, {0xFEAD, 4441, 1}, {0xFEAE, 4442, 1},
+    {0xFEAF, 4443, 1}, {0xFEB0, 4444, 1}, {0xFEB1, 4445, 1},
+    {0xFEB2, 4446, 1}, {0xFEB3, 4447, 1}, {0xFEB4, 4448, 1},
+    {0xFEB5, 4449, 1}, {0xFEB6, 4450, 1}, {0xFEB7, 4451, 1},
+    {0xFEB8, 4452, 1}, {0xFEB9, 4453, 1}, {0xFEBA, 4454, 1},
+    {0xFEBB, 4455, 1}, {0xFEBC, 4456, 1}, {0xFEBD, 4457, 1},
+    {0xFEBE, 4458, 1}, {0xFEBF, 4459, 1}, {0xFEC0, 4460, 1},
+    {0xFEC1, 4461, 1}, {0xFEC2, 4462, 1}, {0xFEC3, 4463, 1},
+    {0xFEC4, 4464, 1}, {0xFEC5, 4465, 1}, {0xFEC6, 4466, 1},
+    {0xFEC7, 4467, 1}, {0xFEC8, 4468, 1}, {0xFEC9, 4469, 1},
+    {0xFECA, 4470, 1}, {0xFECB, 4471, 1}, {0xFECC, 4472, 1},
+    {0xFECD, 4473, 1}, {0xFECE, 4474, 1}, {0xFECF, 4475, 1},
+    {0xFED0, 4476, 1}, {0xFED1, 4477, 1}, {0xFED2, 4478, 1},
+    {0xFED3, 4479, 1}, {0xFED4, 4480, 1}, {0xFED5, 4481, 1},
+    {0xFED6, 4482, 1}, {0xFED7, 4483, 1}, {0xFED8, 4484, 1},
+    {0xFED9, 4485, 1}, {0xFEDA, 4486, 1}, {0xFEDB, 4487, 1},
+    {0xFEDC, 4488, 1}, {0xFEDD, 4489, 1}, {0xFEDE, 4490, 1},
+    {0xFEDF, 4491, 1}, {0xFEE0, 4492, 1}, {0xFEE1, 4493, 1},
+    {0xFEE2, 4494, 1}, {0xFEE3, 4495, 1}, {0xFEE4, 4496, 1},
+    {0xFEE5, 4497, 1}, {0xFEE6, 4498, 1}, {0xFEE7, 4499, 1},
+    {0xFEE8, 4500, 1}, {0xFEE9, 4501, 1}, {0xFEEA, 4502, 1},
+    {0xFEEB, 4503, 1}, {0xFEEC, 4504, 1}, {0xFEED, 4505, 1},
+    {0xFEEE, 4506, 1}, {0xFEEF, 4507, 1}, {0xFEF0, 4508, 1},
+    {0xFEF1, 4509, 1}, {0xFEF2, 4510, 1}, {0xFEF3, 4511, 1},
+    {0xFEF4, 4512, 1}, {0xFEF5, 4513, 3}, {0xFEF6, 4516, 3},
+    {0xFEF7, 4519, 3}, {0xFEF8, 4522, 3}, {0xFEF9, 4525, 3},
+    {0xFEFA, 4528, 3}, {0xFEFB, 4531, 2}, {0xFEFC, 4533, 2},
+    {0xFF10, 4535, 1}, {0xFF11, 4536, 1}, {0xFF12, 4537, 1},
+    {0xFF13, 4538, 1}, {0xFF14, 4539, 1}, {0xFF15, 4540, 1},
+    {0xFF16, 4541, 1}, {0xFF17, 4542, 1}, {0xFF18, 4543, 1},
+    {0xFF19, 4544, 1}, {0xFF21, 4545, 1}, {0xFF22, 4546, 1},
+    {0xFF23, 4547, 1}, {0xFF24, 4548, 1}, {0xFF25, 4549, 1},
+    {0xFF26, 4550, 1}, {0xFF27, 4551, 1}, {0xFF28, 4552, 1},
+    {0xFF29, 4553, 1}, {0xFF2A, 4554, 1}, {0xFF2B, 4555, 1},
+    {0xFF2C, 4556, 1}, {0xFF2D, 4557, 1}, {0xFF2E, 4558, 1},
+    {0xFF2F, 4559, 1}, {0xFF30, 4560, 1}, {0xFF31, 4561, 1},
+    {0xFF32, 4562, 1}, {0xFF33, 4563, 1}, {0xFF34, 4564, 1},
+    {0xFF35, 4565, 1}, {0xFF36, 4566, 1}, {0xFF37, 4567, 1},
+    {0xFF38, 4568, 1}, {0xFF39, 4569, 1}, {0xFF3A, 4570, 1},
+    {0xFF3F, 4571, 1}, {0xFF41, 4572, 1}, {0xFF42, 4573, 1},
+    {0xFF43, 4574, 1}, {0xFF44, 4575, 1}, {0xFF45, 4576, 1},
+    {0xFF46, 4577, 1}, {0xFF47, 4578, 1}, {0xFF48, 4579, 1},
+    {0xFF49, 4580, 1}, {0xFF4A, 4581, 1}, {0xFF4B, 4582, 1},
+    {0xFF4C, 4583, 1}, {0xFF4D, 4584, 1}, {0xFF4E, 4585, 1},
+    {0xFF4F, 4586, 1}, {0xFF50, 4587, 1}, {0xFF51, 4588, 1},
+    {0xFF52, 4589, 1}, {0xFF53, 4590, 1}, {0xFF54, 4591, 1},
+    {0xFF55, 4592, 1}, {0xFF56, 4593, 1}, {0xFF57, 4594, 1},
+    {0xFF58, 4595, 1}, {0xFF59, 4596, 1}, {0xFF5A, 4597, 1},
+    {0xFF66, 4598, 1}, {0xFF67, 4599, 1}, {0xFF68, 4600, 1},
+    {0xFF69, 4601, 1}, {0xFF6A, 4602, 1}, {0xFF6B, 4603, 1},
+    {0xFF6C, 4604, 1}, {0xFF6D, 4605, 1}, {0xFF6E, 4606, 1},
+    {0xFF6F, 4607, 1}, {0xFF70, 4608, 1}, {0xFF71, 4609, 1},
+    {0xFF72, 4610, 1}, {0xFF73, 4611, 1}, {0xFF74, 4612, 1},
+    {0xFF75, 4613, 1}, {0xFF76, 4614, 1}, {0xFF77, 4615, 1},
+    {0xFF78, 4616, 1}, {0xFF79, 4617, 1}, {0xFF7A, 4618, 1},
+    {0xFF7B, 4619, 1}, {0xFF7C, 4620, 1}, {0xFF7D, 4621, 1},
+    {0xFF7E, 4622, 1}, {0xFF7F, 4623, 1}, {0xFF80, 4624, 1},
+    {0xFF81, 4625, 1}, {0xFF82, 4626, 1}, {0xFF83, 4627, 1},
+    {0xFF84, 4628, 1}, {0xFF85, 4629, 1}, {0xFF86, 4630, 1},
+    {0xFF87, 4631, 1}, {0xFF88, 4632, 1}, {0xFF89, 4633, 1},
+    {0xFF8A, 4634, 1}, {0xFF8B, 4635, 1}, {0xFF8C, 4636, 1},
+    {0xFF8D, 4637, 1}, {0xFF8E, 4638, 1}, {0xFF8F, 4639, 1},
+    {0xFF90, 4640, 1}, {0xFF91, 4641, 1}, {0xFF92, 4642, 1},
+    {0xFF93, 4643, 1}, {0xFF94, 4644, 1}, {0xFF95, 4645, 1},
+    {0xFF96, 4646, 1}, {0xFF97, 4647, 1}, {0xFF98, 4648, 1},
+    {0xFF99, 4649, 1}, {0xFF9A, 4650, 1}, {0xFF9B, 4651, 1},
+    {0xFF9C, 4652, 1}, {0xFF9D, 4653, 1}, {0xFF9E, 4654, 1},
+    {0xFF9F, 4655, 1}, {0xFFA0, 4656, 1}, {0xFFA1, 4657, 1},
+    {0xFFA2, 4658, 1}, {0xFFA3, 4659, 1}, {0xFFA4, 4660, 1},
+    {0xFFA5, 4661, 1}, {0xFFA6, 4662, 1}, {0xFFA7, 4663, 1},
+    {0xFFA8, 4664, 1}, {0xFFA9, 4665, 1}, {0xFFAA, 4666, 1},
+    {0xFFAB, 4667, 1}, {0xFFAC, 4668, 1}, {0xFFAD, 4669, 1},
+    {0xFFAE, 4670, 1}, {0xFFAF, 4671, 1}, {0xFFB0, 4672, 1},
+    {0xFFB1, 4673, 1}, {0xFFB2, 4674, 1}, {0xFFB3, 4675, 1},
+    {0xFFB4, 4676, 1}, {0xFFB5, 4677, 1}, {0xFFB6, 4678, 1},
+    {0xFFB7, 4679, 1}, {0xFFB8, 4680, 1}, {0xFFB9, 4681, 1},
+    {0xFFBA, 4682, 1}, {0xFFBB, 4683, 1}, {0xFFBC, 4684, 1},
+    {0xFFBD, 4685, 1}, {0xFFBE, 4686, 1}, {0xFFC2, 4687, 1},
+    {0xFFC3, 4688, 1}, {0xFFC4, 4689, 1}, {0xFFC5, 4690, 1},
+    {0xFFC6, 4691, 1}, {0xFFC7, 4692, 1}, {0xFFCA, 4693, 1},
+    {0xFFCB, 4694, 1}, {0xFFCC, 4695, 1}, {0xFFCD, 4696, 1},
+    {0xFFCE, 4697, 1}, {0xFFCF, 4698, 1}, {0xFFD2, 4699, 1},
+    {0xFFD3, 4700, 1}, {0xFFD4, 4701, 1}, {0xFFD5, 4702, 1},
+    {0xFFD6, 4703, 1}, {0xFFD7, 4704, 1}, {0xFFDA, 4705, 1},
+    {0xFFDB, 4706, 1}, {0xFFDC, 4707, 1}, {0x10781, 4708, 1},
+    {0x10782, 4709, 1}, {0x10783, 4710, 1}, {0x10784, 4711, 1},
+    {0x10785, 4712, 1}, {0x10787, 4713, 1}, {0x10788, 4714, 1},
+    {0x10789, 4715, 1}, {0x1078A, 4716, 1}, {0x1078B, 4717, 1},
+    {0x1078C, 4718, 1}, {0x1078D, 4719, 1}, {0x1078E, 4720, 1},
+    {0x1078F, 4721, 1}, {0x10790, 4722, 1}, {0x10791, 4723, 1},
+    {0x10792, 4724, 1}, {0x10793, 4725, 1}, {0x10794, 4726, 1},
+    {0x10795, 4727, 1}, {0x10796, 4728, 1}, {0x10797, 4729, 1},
+    {0x10798, 4730, 1}, {0x10799, 4731, 1}, {0x1079A, 4732, 1},
+    {0x1079B, 4733, 1}, {0x1079C, 4734, 1}, {0x1079D, 4735, 1},
+    {0x1079E, 4736, 1}, {0x1079F, 4737, 1}, {0x107A0, 4738, 1},
+    {0x107A1, 4739, 1}, {0x107A2, 4740, 1}, {0x107A3, 4741, 1},
+    {0x107A4, 4742, 1}, {0x107A5, 4743, 1}, {0x107A6, 4744, 1},
+    {0x107A7, 4745, 1}, {0x107A8, 4746, 1}, {0x107A9, 4747, 1},
+    {0x107AA, 4748, 1}, {0x107AB, 4749, 1}, {0x107AC, 4750, 1},
+    {0x107AD, 4751, 1}, {0x107AE, 4752, 1}, {0x107AF, 4753, 1},
+    {0x107B0, 4754, 1}, {0x107B2, 4755, 1}, {0x107B3, 4756, 1},
+    {0x107B4, 4757, 1}, {0x107B5, 4758, 1}, {0x107B6, 4759, 1},
+    {0x107B7, 4760, 1}, {0x107B8, 4761, 1}, {0x107B9, 4762, 1},
+    {0x107BA, 4763, 1}, {0x1109A, 4764, 2}, {0x1109C, 4766, 2},
+    {0x110AB, 4768, 2}, {0x1112E, 4770, 2}, {0x1112F, 4772, 2},
+    {0x1134B, 4774, 2}, {0x1134C, 4776, 2}, {0x114BB, 4778, 2},
+    {0x114BC, 4780, 2}, {0x114BE, 4782, 2}, {0x115BA, 4784, 2},
+    {0x115BB, 4786, 2}, {0x11938, 4788, 2}, {0x1D400, 4790, 1},
+    {0x1D401, 4791, 1}, {0x1D402, 4792, 1}, {0x1D403, 4793, 1},
+    {0x1D404, 4794, 1}, {0x1D405, 4795, 1}, {0x1D406, 4796, 1},
+    {0x1D407, 4797, 1}, {0x1D408, 4798, 1}, {0x1D409, 4799, 1},
+    {0x1D40A, 4800, 1}, {0x1D40B, 4801, 1}, {0x1D40C, 4802, 1},
+    {0x1D40D, 4803, 1}, {0x1D40E, 4804, 1}, {0x1D40F, 4805, 1},
+    {0x1D410, 4806, 1}, {0x1D411, 4807, 1}, {0x1D412, 4808, 1},
+    {0x1D413, 4809, 1}, {0x1D414, 4810, 1}, {0x1D415, 4811, 1},
+    {0x1D416, 4812, 1}, {0x1D417, 4813, 1}, {0x1D418, 4814, 1},
+    {0x1D419, 4815, 1}, {0x1D41A, 4816, 1}, {0x1D41B, 4817, 1},
+    {0x1D41C, 4818, 1}, {0x1D41D, 4819, 1}, {0x1D41E, 4820, 1},
+    {0x1D41F, 4821, 1}, {0x1D420, 4822, 1}, {0x1D421, 4823, 1},
+    {0x1D422, 4824, 1}, {0x1D423, 4825, 1}, {0x1D424, 4826, 1},
+    {0x1D425, 4827, 1}, {0x1D426, 4828, 1}, {0x1D427, 4829, 1},
+    {0x1D428, 4830, 1}, {0x1D429, 4831, 1}, {0x1D42A, 4832, 1},
+    {0x1D42B, 4833, 1}, {0x1D42C, 4834, 1}, {0x1D42D, 4835, 1},
+    {0x1D42E, 4836, 1}, {0x1D42F, 4837, 1}, {0x1D430, 4838, 1},
+    {0x1D431, 4839, 1}, {0x1D432, 4840, 1}, {0x1D433, 4841, 1},
+    {0x1D434, 4842, 1}, {0x1D435, 4843, 1}, {0x1D436, 4844, 1},
+    {0x1D437, 4845, 1}, {0x1D438, 4846, 1}, {0x1D439, 4847, 1},
+    {0x1D43A, 4848, 1}, {0x1D43B, 4849, 1}, {0x1D43C, 4850, 1},
+    {0x1D43D, 4851, 1}, {0x1D43E, 4852, 1}, {0x1D43F, 4853, 1},
+    {0x1D440, 4854, 1}, {0x1D441, 4855, 1}, {0x1D442, 4856, 1},
+    {0x1D443, 4857, 1}, {0x1D444, 4858, 1}, {0x1D445, 4859, 1},
+    {0x1D446, 4860, 1}, {0x1D447, 4861, 1}, {0x1D448, 4862, 1},
+    {0x1D449, 4863, 1}, {0x1D44A, 4864, 1}, {0x1D44B, 4865, 1},
+    {0x1D44C, 4866, 1}, {0x1D44D, 4867, 1}, {0x1D44E, 4868, 1},
+    {0x1D44F, 4869, 1}, {0x1D450, 4870, 1}, {0x1D451, 4871, 1},
+    {0x1D452, 4872, 1}, {0x1D453, 4873, 1}, {0x1D454, 4874, 1},
+    {0x1D456, 4875, 1}, {0x1D457, 4876, 1}, {0x1D458, 4877, 1},
+    {0x1D459, 4878, 1}, {0x1D45A, 4879, 1}, {0x1D45B, 4880, 1},
+    {0x1D45C, 4881, 1}, {0x1D45D, 4882, 1}, {0x1D45E, 4883, 1},
+    {0x1D45F, 4884, 1}, {0x1D460, 4885, 1}, {0x1D461, 4886, 1},
+    {0x1D462, 4887, 1}, {0x1D463, 4888, 1}, {0x1D464, 4889, 1},
+    {0x1D465, 4890, 1}, {0x1D466, 4891, 1}, {0x1D467, 4892, 1},
+    {0x1D468, 4893, 1}, {0x1D469, 4894, 1}, {0x1D46A, 4895, 1},
+    {0x1D46B, 4896, 1}, {0x1D46C, 4897, 1}, {0x1D46D, 4898, 1},
+    {0x1D46E, 4899, 1}, {0x1D46F, 4900, 1}, {0x1D470, 4901, 1},
+    {0x1D471, 4902, 1}, {0x1D472, 4903, 1}, {0x1D473, 4904, 1},
+    {0x1D474, 4905, 1}, {0x1D475, 4906, 1}, {0x1D476, 4907, 1},
+    {0x1D477, 4908, 1}, {0x1D478, 4909, 1}, {0x1D479, 4910, 1},
+    {0x1D47A, 4911, 1}, {0x1D47B, 4912, 1}, {0x1D47C, 4913, 1},
+    {0x1D47D, 4914, 1}, {0x1D47E, 4915, 1}, {0x1D47F, 4916, 1},
+    {0x1D480, 4917, 1}, {0x1D481, 4918, 1}, {0x1D482, 4919, 1},
+    {0x1D483, 4920, 1}, {0x1D484, 4921, 1}, {0x1D485, 4922, 1},
+    {0x1D486, 4923, 1}, {0x1D487, 4924, 1}, {0x1D488, 4925, 1},
+    {0x1D489, 4926, 1}, {0x1D48A, 4927, 1}, {0x1D48B, 4928, 1},
+    {0x1D48C, 4929, 1}, {0x1D48D, 4930, 1}, {0x1D48E, 4931, 1},
+    {0x1D48F, 4932, 1}, {0x1D490, 4933, 1}, {0x1D491, 4934, 1},
+    {0x1D492, 4935, 1}, {0x1D493, 4936, 1}, {0x1D494, 4937, 1},
+    {0x1D495, 4938, 1}, {0x1D496, 4939, 1}, {0x1D497, 4940, 1},
+    {0x1D498, 4941, 1}, {0x1D499, 4942, 1}, {0x1D49A, 4943, 1},
+    {0x1D49B, 4944, 1}, {0x1D49C, 4945, 1}, {0x1D49E, 4946, 1},
+    {0x1D49F, 4947, 1}, {0x1D4A2, 4948, 1}, {0x1D4A5, 4949, 1},
+    {0x1D4A6, 4950, 1}, {0x1D4A9, 4951, 1}, {0x1D4AA, 4952, 1},
+    {0x1D4AB, 4953, 1}, {0x1D4AC, 4954, 1}, {0x1D4AE, 4955, 1},
+    {0x1D4AF, 4956, 1}, {0x1D4B0, 4957, 1}, {0x1D4B1, 4958, 1},
+    {0x1D4B2, 4959, 1}, {0x1D4B3, 4960, 1}, {0x1D4B4, 4961, 1},
+    {0x1D4B5, 4962, 1}, {0x1D4B6, 4963, 1}, {0x1D4B7, 4964, 1},
+    {0x1D4B8, 4965, 1}, {0x1D4B9, 4966, 1}, {0x1D4BB, 4967, 1},
+    {0x1D4BD, 4968, 1}, {0x1D4BE, 4969, 1}, {0x1D4BF, 4970, 1},
+    {0x1D4C0, 4971, 1}, {0x1D4C1, 4972, 1}, {0x1D4C2, 4973, 1},
+    {0x1D4C3, 4974, 1}, {0x1D4C5, 4975, 1}, {0x1D4C6, 4976, 1},
+    {0x1D4C7, 4977, 1}, {0x1D4C8, 4978, 1}, {0x1D4C9, 4979, 1},
+    {0x1D4CA, 4980, 1}, {0x1D4CB, 4981, 1}, {0x1D4CC, 4982, 1},
+    {0x1D4CD, 4983, 1}, {0x1D4CE, 4984, 1}, {0x1D4CF, 4985, 1},
+    {0x1D4D0, 4986, 1}, {0x1D4D1, 4987, 1}, {0x1D4D2, 4988, 1},
+    {0x1D4D3, 4989, 1}, {0x1D4D4, 4990, 1}, {0x1D4D5, 4991, 1},
+    {0x1D4D6, 4992, 1}, {0x1D4D7, 4993, 1}, {0x1D4D8, 4994, 1},
+    {0x1D4D9, 4995, 1}, {0x1D4DA, 4996, 1}, {0x1D4DB, 4997, 1},
+    {0x1D4DC, 4998, 1}, {0x1D4DD, 4999, 1}, {0x1D4DE, 5000, 1},
+    {0x1D4DF, 5001, 1}, {0x1D4E0, 5002, 1}, {0x1D4E1, 5003, 1},
+    {0x1D4E2, 5004, 1}, {0x1D4E3, 5005, 1}, {0x1D4E4, 5006, 1},
+    {0x1D4E5, 5007, 1}, {0x1D4E6, 5008, 1}, {0x1D4E7, 5009, 1},
+    {0x1D4E8, 5010, 1}, {0x1D4E9, 5011, 1}, {0x1D4EA, 5012, 1},
+    {0x1D4EB, 5013, 1}, {0x1D4EC, 5014, 1}, {0x1D4ED, 5015, 1},
+    {0x1D4EE, 5016, 1}, {0x1D4EF, 5017, 1}, {0x1D4F0, 5018, 1},
+    {0x1D4F1, 5019, 1}, {0x1D4F2, 5020, 1}, {0x1D4F3, 5021, 1},
+    {0x1D4F4, 5022, 1}, {0x1D4F5, 5023, 1}, {0x1D4F6, 5024, 1},
+    {0x1D4F7, 5025, 1}, {0x1D4F8, 5026, 1}, {0x1D4F9, 5027, 1},
+    {0x1D4FA, 5028, 1}, {0x1D4FB, 5029, 1}, {0x1D4FC, 5030, 1},
+    {0x1D4FD, 5031, 1}, {0x1D4FE, 5032, 1}, {0x1D4FF, 5033, 1},
+    {0x1D500, 5034, 1}, {0x1D501, 5035, 1}, {0x1D502, 5036, 1},
+    {0x1D503, 5037, 1}, {0x1D504, 5038, 1}, {0x1D505, 5039, 1},
+    {0x1D507, 5040, 1}, {0x1D508, 5041, 1}, {0x1D509, 5042, 1},
+    {0x1D50A, 5043, 1}, {0x1D50D, 5044, 1}, {0x1D50E, 5045, 1},
+    {0x1D50F, 5046, 1}, {0x1D510, 5047, 1}, {0x1D511, 5048, 1},
+    {0x1D512, 5049, 1}, {0x1D513, 5050, 1}, {0x1D514, 5051, 1},
+    {0x1D516, 5052, 1}, {0x1D517, 5053, 1}, {0x1D518, 5054, 1},
+    {0x1D519, 5055, 1}, {0x1D51A, 5056, 1}, {0x1D51B, 5057, 1},
+    {0x1D51C, 5058, 1}, {0x1D51E, 5059, 1}, {0x1D51F, 5060, 1},
+    {0x1D520, 5061, 1}, {0x1D521, 5062, 1}, {0x1D522, 5063, 1},
+    {0x1D523, 5064, 1}, {0x1D524, 5065, 1}, {0x1D525, 5066, 1},
+    {0x1D526, 5067, 1}, {0x1D527, 5068, 1}, {0x1D528, 5069, 1},
+    {0x1D529, 5070, 1}, {0x1D52A, 5071, 1}, {0x1D52B, 5072, 1},
+    {0x1D52C, 5073, 1}, {0x1D52D, 5074, 1}, {0x1D52E, 5075, 1},
+    {0x1D52F, 5076, 1}, {0x1D530, 5077, 1}, {0x1D531, 5078, 1},
+    {0x1D532, 5079, 1}, {0x1D533, 5080, 1}, {0x1D534, 5081, 1},
+    {0x1D535, 5082, 1}, {0x1D536, 5083, 1}, {0x1D537, 5084, 1},
+    {0x1D538, 5085, 1}, {0x1D539, 5086, 1}, {0x1D53B, 5087, 1},
+    {0x1D53C, 5088, 1}, {0x1D53D, 5089, 1}, {0x1D53E, 5090, 1},
+    {0x1D540, 5091, 1}, {0x1D541, 5092, 1}, {0x1D542, 5093, 1},
+    {0x1D543, 5094, 1}, {0x1D544, 5095, 1}, {0x1D546, 5096, 1},
+    {0x1D54A, 5097, 1}, {0x1D54B, 5098, 1}, {0x1D54C, 5099, 1},
+    {0x1D54D, 5100, 1}, {0x1D54E, 5101, 1}, {0x1D54F, 5102, 1},
+    {0x1D550, 5103, 1}, {0x1D552, 5104, 1}, {0x1D553, 5105, 1},
+    {0x1D554, 5106, 1}, {0x1D555, 5107, 1}, {0x1D556, 5108, 1},
+    {0x1D557, 5109, 1}, {0x1D558, 5110, 1}, {0x1D559, 5111, 1},
+    {0x1D55A, 5112, 1}, {0x1D55B, 5113, 1}, {0x1D55C, 5114, 1},
+    {0x1D55D, 5115, 1}, {0x1D55E, 5116, 1}, {0x1D55F, 5117, 1},
+    {0x1D560, 5118, 1}, {0x1D561, 5119, 1}, {0x1D562, 5120, 1},
+    {0x1D563, 5121, 1}, {0x1D564, 5122, 1}, {0x1D565, 5123, 1},
+    {0x1D566, 5124, 1}, {0x1D567, 5125, 1}, {0x1D568, 5126, 1},
+    {0x1D569, 5127, 1}, {0x1D56A, 5128, 1}, {0x1D56B, 5129, 1},
+    {0x1D56C, 5130, 1}, {0x1D56D, 5131, 1}, {0x1D56E, 5132, 1},
+    {0x1D56F, 5133, 1}, {0x1D570, 5134, 1}, {0x1D571, 5135, 1},
+    {0x1D572, 5136, 1}, {0x1D573, 5137, 1}, {0x1D574, 5138, 1},
+    {0x1D575, 5139, 1}, {0x1D576, 5140, 1}, {0x1D577, 5141, 1},
+    {0x1D578, 5142, 1}, {0x1D579, 5143, 1}, {0x1D57A, 5144, 1},
+    {0x1D57B, 5145, 1}, {0x1D57C, 5146, 1}, {0x1D57D, 5147, 1},
+    {0x1D57E, 5148, 1}, {0x1D57F, 5149, 1}, {0x1D580, 5150, 1},
+    {0x1D581, 5151, 1}, {0x1D582, 5152, 1}, {0x1D583, 5153, 1},
+    {0x1D584, 5154, 1}, {0x1D585, 5155, 1}, {0x1D586, 5156, 1},
+    {0x1D587, 5157, 1}, {0x1D588, 5158, 1}, {0x1D589, 5159, 1},
+    {0x1D58A, 5160, 1}, {0x1D58B, 5161, 1}, {0x1D58C, 5162, 1},
+    {0x1D58D, 5163, 1}, {0x1D58E, 5164, 1}, {0x1D58F, 5165, 1},
+    {0x1D590, 5166, 1}, {0x1D591, 5167, 1}, {0x1D592, 5168, 1},
+    {0x1D593, 5169, 1}, {0x1D594, 5170, 1}, {0x1D595, 5171, 1},
+    {0x1D596, 5172, 1}, {0x1D597, 5173, 1}, {0x1D598, 5174, 1},
+    {0x1D599, 5175, 1}, {0x1D59A, 5176, 1}, {0x1D59B, 5177, 1},
+    {0x1D59C, 5178, 1}, {0x1D59D, 5179, 1}, {0x1D59E, 5180, 1},
+    {0x1D59F, 5181, 1}, {0x1D5A0, 5182, 1}, {0x1D5A1, 5183, 1},
+    {0x1D5A2, 5184, 1}, {0x1D5A3, 5185, 1}, {0x1D5A4, 5186, 1},
+    {0x1D5A5, 5187, 1}, {0x1D5A6, 5188, 1}, {0x1D5A7, 5189, 1},
+    {0x1D5A8, 5190, 1}, {0x1D5A9, 5191, 1}, {0x1D5AA, 5192, 1},
+    {0x1D5AB, 5193, 1}, {0x1D5AC, 5194, 1}, {0x1D5AD, 5195, 1},
+    {0x1D5AE, 5196, 1}, {0x1D5AF, 5197, 1}, {0x1D5B0, 5198, 1},
+    {0x1D5B1, 5199, 1}, {0x1D5B2, 5200, 1}, {0x1D5B3, 5201, 1},
+    {0x1D5B4, 5202, 1}, {0x1D5B5, 5203, 1}, {0x1D5B6, 5204, 1},
+    {0x1D5B7, 5205, 1}, {0x1D5B8, 5206, 1}, {0x1D5B9, 5207, 1},
+    {0x1D5BA, 5208, 1}, {0x1D5BB, 5209, 1}, {0x1D5BC, 5210, 1},
+    {0x1D5BD, 5211, 1}, {0x1D5BE, 5212, 1}, {0x1D5BF, 5213, 1},
+    {0x1D5C0, 5214, 1}, {0x1D5C1, 5215, 1}, {0x1D5C2, 5216, 1},
+    {0x1D5C3, 5217, 1}, {0x1D5C4, 5218, 1}, {0x1D5C5, 5219, 1},
+    {0x1D5C6, 5220, 1}, {0x1D5C7, 5221, 1}, {0x1D5C8, 5222, 1},
+    {0x1D5C9, 5223, 1}, {0x1D5CA, 5224, 1}, {0x1D5CB, 5225, 1},
+    {0x1D5CC, 5226, 1}, {0x1D5CD, 5227, 1}, {0x1D5CE, 5228, 1},
+    {0x1D5CF, 5229, 1}, {0x1D5D0, 5230, 1}, {0x1D5D1, 5231, 1},
+    {0x1D5D2, 5232, 1}, {0x1D5D3, 5233, 1}, {0x1D5D4, 5234, 1},
+    {0x1D5D5, 5235, 1}, {0x1D5D6, 5236, 1}, {0x1D5D7, 5237, 1},
+    {0x1D5D8, 5238, 1}, {0x1D5D9, 5239, 1}, {0x1D5DA, 5240, 1},
+    {0x1D5DB, 5241, 1}, {0x1D5DC, 5242, 1}, {0x1D5DD, 5243, 1},
+    {0x1D5DE, 5244, 1}, {0x1D5DF, 5245, 1}, {0x1D5E0, 5246, 1},
+    {0x1D5E1, 5247, 1}, {0x1D5E2, 5248, 1}, {0x1D5E3, 5249, 1},
+    {0x1D5E4, 5250, 1}, {0x1D5E5, 5251, 1}, {0x1D5E6, 5252, 1},
+    {0x1D5E7, 5253, 1}, {0x1D5E8, 5254, 1}, {0x1D5E9, 5255, 1},
+    {0x1D5EA, 5256, 1}, {0x1D5EB, 5257, 1}, {0x1D5EC, 5258, 1},
+    {0x1D5ED, 5259, 1}, {0x1D5EE, 5260, 1}, {0x1D5EF, 5261, 1},
+    {0x1D5F0, 5262, 1}, {0x1D5F1, 5263, 1}, {0x1D5F2, 5264, 1},
+    {0x1D5F3, 5265, 1}, {0x1D5F4, 5266, 1}, {0x1D5F5, 5267, 1},
+    {0x1D5F6, 5268, 1}, {0x1D5F7, 5269, 1}, {0x1D5F8, 5270, 1},
+    {0x1D5F9, 5271, 1}, {0x1D5FA, 5272, 1}, {0x1D5FB, 5273, 1},
+    {0x1D5FC, 5274, 1}, {0x1D5FD, 5275, 1}, {0x1D5FE, 5276, 1},
+    {0x1D5FF, 5277, 1}, {0x1D600, 5278, 1}, {0x1D601, 5279, 1},
+    {0x1D602, 5280, 1}, {0x1D603, 5281, 1}, {0x1D604, 5282, 1},
+    {0x1D605, 5283, 1}, {0x1D606, 5284, 1}, {0x1D607, 5285, 1},
+    {0x1D608, 5286, 1}, {0x1D609, 5287, 1}, {0x1D60A, 5288, 1},
+    {0x1D60B, 5289, 1}, {0x1D60C, 5290, 1}, {0x1D60D, 5291, 1},
+    {0x1D60E, 5292, 1}, {0x1D60F, 5293, 1}, {0x1D610, 5294, 1},
+    {0x1D611, 5295, 1}, {0x1D612, 5296, 1}, {0x1D613, 5297, 1},
+    {0x1D614, 5298, 1}, {0x1D615, 5299, 1}, {0x1D616, 5300, 1},
+    {0x1D617, 5301, 1}, {0x1D618, 5302, 1}, {0x1D619, 5303, 1},
+    {0x1D61A, 5304, 1}, {0x1D61B, 5305, 1}, {0x1D61C, 5306, 1},
+    {0x1D61D, 5307, 1}, {0x1D61E, 5308, 1}, {0x1D61F, 5309, 1},
+    {0x1D620, 5310, 1}, {0x1D621, 5311, 1}, {0x1D622, 5312, 1},
+    {0x1D623, 5313, 1}, {0x1D624, 5314, 1}, {0x1D625, 5315, 1},
+    {0x1D626, 5316, 1}, {0x1D627, 5317, 1}, {0x1D628, 5318, 1},
+    {0x1D629, 5319, 1}, {0x1D62A, 5320, 1}, {0x1D62B, 5321, 1},
+    {0x1D62C, 5322, 1}, {0x1D62D, 5323, 1}, {0x1D62E, 5324, 1},
+    {0x1D62F, 5325, 1}, {0x1D630, 5326, 1}, {0x1D631, 5327, 1},
+    {0x1D632, 5328, 1}, {0x1D633, 5329, 1}, {0x1D634, 5330, 1},
+    {0x1D635, 5331, 1}, {0x1D636, 5332, 1}, {0x1D637, 5333, 1},
+    {0x1D638, 5334, 1}, {0x1D639, 5335, 1}, {0x1D63A, 5336, 1},
+    {0x1D63B, 5337, 1}, {0x1D63C, 5338, 1}, {0x1D63D, 5339, 1},
+    {0x1D63E, 5340, 1}, {0x1D63F, 5341, 1}, {0x1D640, 5342, 1},
+    {0x1D641, 5343, 1}, {0x1D642, 5344, 1}, {0x1D643, 5345, 1},
+    {0x1D644, 5346, 1}, {0x1D645, 5347, 1}, {0x1D646, 5348, 1},
+    {0x1D647, 5349, 1}, {0x1D648, 5350, 1}, {0x1D649, 5351, 1},
+    {0x1D64A, 5352, 1}, {0x1D64B, 5353, 1}, {0x1D64C, 5354, 1},
+    {0x1D64D, 5355, 1}, {0x1D64E, 5356, 1}, {0x1D64F, 5357, 1},
+    {0x1D650, 5358, 1}, {0x1D651, 5359, 1}, {0x1D652, 5360, 1},
+    {0x1D653, 5361, 1}, {0x1D654, 5362, 1}, {0x1D655, 5363, 1},
+    {0x1D656, 5364, 1}, {0x1D657, 5365, 1}, {0x1D658, 5366, 1},
+    {0x1D659, 5367, 1}, {0x1D65A, 5368, 1}, {0x1D65B, 5369, 1},
+    {0x1D65C, 5370, 1}, {0x1D65D, 5371, 1}, {0x1D65E, 5372, 1},
+    {0x1D65F, 5373, 1}, {0x1D660, 5374, 1}, {0x1D661, 5375, 1},
+    {0x1D662, 5376, 1}, {0x1D663, 5377, 1}, {0x1D664, 5378, 1},
+    {0x1D665, 5379, 1}, {0x1D666, 5380, 1}, {0x1D667, 5381, 1},
+    {0x1D668, 5382, 1}, {0x1D669, 5383, 1}, {0x1D66A, 5384, 1},
+    {0x1D66B, 5385, 1}, {0x1D66C, 5386, 1}, {0x1D66D, 5387, 1},
+    {0x1D66E, 5388, 1}, {0x1D66F, 5389, 1}, {0x1D670, 5390, 1},
+    {0x1D671, 5391, 1}, {0x1D672, 5392, 1}, {0x1D673, 5393, 1},
+    {0x1D674, 5394, 1}, {0x1D675, 5395, 1}, {0x1D676, 5396, 1},
+    {0x1D677, 5397, 1}, {0x1D678, 5398, 1}, {0x1D679, 5399, 1},
+    {0x1D67A, 5400, 1}, {0x1D67B, 5401, 1}, {0x1D67C, 5402, 1},
+    {0x1D67D, 5403, 1}, {0x1D67E, 5404, 1}, {0x1D67F, 5405, 1},
+    {0x1D680, 5406, 1}, {0x1D681, 5407, 1}, {0x1D682, 5408, 1},
+    {0x1D683, 5409, 1}, {0x1D684, 5410, 1}, {0x1D685, 5411, 1},
+    {0x1D686, 5412, 1}, {0x1D687, 5413, 1}, {0x1D688, 5414, 1},
+    {0x1D689, 5415, 1}, {0x1D68A, 5416, 1}, {0x1D68B, 5417, 1},
+    {0x1D68C, 5418, 1}, {0x1D68D, 5419, 1}, {0x1D68E, 5420, 1},
+    {0x1D68F, 5421, 1}, {0x1D690, 5422, 1}, {0x1D691, 5423, 1},
+    {0x1D692, 5424, 1}, {0x1D693, 5425, 1}, {0x1D694, 5426, 1},
+    {0x1D695, 5427, 1}, {0x1D696, 5428, 1}, {0x1D697, 5429, 1},
+    {0x1D698, 5430, 1}, {0x1D699, 5431, 1}, {0x1D69A, 5432, 1},
+    {0x1D69B, 5433, 1}, {0x1D69C, 5434, 1}, {0x1D69D, 5435, 1},
+    {0x1D69E, 5436, 1}, {0x1D69F, 5437, 1}, {0x1D6A0, 5438, 1},
+    {0x1D6A1, 5439, 1}, {0x1D6A2, 5440, 1}, {0x1D6A3, 5441, 1},
+    {0x1D6A4, 5442, 1}, {0x1D6A5, 5443, 1}, {0x1D6A8, 5444, 1},
+    {0x1D6A9, 5445, 1}, {0x1D6AA, 5446, 1}, {0x1D6AB, 5447, 1},
+    {0x1D6AC, 5448, 1}, {0x1D6AD, 5449, 1}, {0x1D6AE, 5450, 1},
+    {0x1D6AF, 5451, 1}, {0x1D6B0, 5452, 1}, {0x1D6B1, 5453, 1},
+    {0x1D6B2, 5454, 1}, {0x1D6B3, 5455, 1}, {0x1D6B4, 5456, 1},
+    {0x1D6B5, 5457, 1}, {0x1D6B6, 5458, 1}, {0x1D6B7, 5459, 1},
+    {0x1D6B8, 5460, 1}, {0x1D6B9, 5461, 1}, {0x1D6BA, 5462, 1},
+    {0x1D6BB, 5463, 1}, {0x1D6BC, 5464, 1}, {0x1D6BD, 5465, 1},
+    {0x1D6BE, 5466, 1}, {0x1D6BF, 5467, 1}, {0x1D6C0, 5468, 1},
+    {0x1D6C2, 5469, 1}, {0x1D6C3, 5470, 1}, {0x1D6C4, 5471, 1},
+    {0x1D6C5, 5472, 1}, {0x1D6C6, 5473, 1}, {0x1D6C7, 5474, 1},
+    {0x1D6C8, 5475, 1}, {0x1D6C9, 5476, 1}, {0x1D6CA, 5477, 1},
+    {0x1D6CB, 5478, 1}, {0x1D6CC, 5479, 1}, {0x1D6CD, 5480, 1},
+    {0x1D6CE, 5481, 1}, {0x1D6CF, 5482, 1}, {0x1D6D0, 5483, 1},
+    {0x1D6D1, 5484, 1}, {0x1D6D2, 5485, 1}, {0x1D6D3, 5486, 1},
+    {0x1D6D4, 5487, 1}, {0x1D6D5, 5488, 1}, {0x1D6D6, 5489, 1},
+    {0x1D6D7, 5490, 1}, {0x1D6D8, 5491, 1}, {0x1D6D9, 5492, 1},
+    {0x1D6DA, 5493, 1}, {0x1D6DC, 5494, 1}, {0x1D6DD, 5495, 1},
+    {0x1D6DE, 5496, 1}, {0x1D6DF, 5497, 1}, {0x1D6E0, 5498, 1},
+    {0x1D6E1, 5499, 1}, {0x1D6E2, 5500, 1}, {0x1D6E3, 5501, 1},
+    {0x1D6E4, 5502, 1}, {0x1D6E5, 5503, 1}, {0x1D6E6, 5504, 1},
+    {0x1D6E7, 5505, 1}, {0x1D6E8, 5506, 1}, {0x1D6E9, 5507, 1},
+    {0x1D6EA, 5508, 1}, {0x1D6EB, 5509, 1}, {0x1D6EC, 5510, 1},
+    {0x1D6ED, 5511, 1}, {0x1D6EE, 5512, 1}, {0x1D6EF, 5513, 1},
+    {0x1D6F0, 5514, 1}, {0x1D6F1, 5515, 1}, {0x1D6F2, 5516, 1},
+    {0x1D6F3, 5517, 1}, {0x1D6F4, 5518, 1}, {0x1D6F5, 5519, 1},
+    {0x1D6F6, 5520, 1}, {0x1D6F7, 5521, 1}, {0x1D6F8, 5522, 1},
+    {0x1D6F9, 5523, 1}, {0x1D6FA, 5524, 1}, {0x1D6FC, 5525, 1},
+    {0x1D6FD, 5526, 1}, {0x1D6FE, 5527, 1}, {0x1D6FF, 5528, 1},
+    {0x1D700, 5529, 1}, {0x1D701, 5530, 1}, {0x1D702, 5531, 1},
+    {0x1D703, 5532, 1}, {0x1D704, 5533, 1}, {0x1D705, 5534, 1},
+    {0x1D706, 5535, 1}, {0x1D707, 5536, 1}, {0x1D708, 5537, 1},
+    {0x1D709, 5538, 1}, {0x1D70A, 5539, 1}, {0x1D70B, 5540, 1},
+    {0x1D70C, 5541, 1}, {0x1D70D, 5542, 1}, {0x1D70E, 5543, 1},
+    {0x1D70F, 5544, 1}, {0x1D710, 5545, 1}, {0x1D711, 5546, 1},
+    {0x1D712, 5547, 1}, {0x1D713, 5548, 1}, {0x1D714, 5549, 1},
+    {0x1D716, 5550, 1}, {0x1D717, 5551, 1}, {0x1D718, 5552, 1},
+    {0x1D719, 5553, 1}, {0x1D71A, 5554, 1}, {0x1D71B, 5555, 1},
+    {0x1D71C, 5556, 1}, {0x1D71D, 5557, 1}, {0x1D71E, 5558, 1},
+    {0x1D71F, 5559, 1}, {0x1D720, 5560, 1}, {0x1D721, 5561, 1},
+    {0x1D722, 5562, 1}, {0x1D723, 5563, 1}, {0x1D724, 5564, 1},
+    {0x1D725, 5565, 1}, {0x1D726, 5566, 1}, {0x1D727, 5567, 1},
+    {0x1D728, 5568, 1}, {0x1D729, 5569, 1}, {0x1D72A, 5570, 1},
+    {0x1D72B, 5571, 1}, {0x1D72C, 5572, 1}, {0x1D72D, 5573, 1},
+    {0x1D72E, 5574, 1}, {0x1D72F, 5575, 1}, {0x1D730, 5576, 1},
+    {0x1D731, 5577, 1}, {0x1D732, 5578, 1}, {0x1D733, 5579, 1},
+    {0x1D734, 5580, 1}, {0x1D736, 5581, 1}, {0x1D737, 5582, 1},
+    {0x1D738, 5583, 1}, {0x1D739, 5584, 1}, {0x1D73A, 5585, 1},
+    {0x1D73B, 5586, 1}, {0x1D73C, 5587, 1}, {0x1D73D, 5588, 1},
+    {0x1D73E, 5589, 1}, {0x1D73F, 5590, 1}, {0x1D740, 5591, 1},
+    {0x1D741, 5592, 1}, {0x1D742, 5593, 1}, {0x1D743, 5594, 1},
+    {0x1D744, 5595, 1}, {0x1D745, 5596, 1}, {0x1D746, 5597, 1},
+    {0x1D747, 5598, 1}, {0x1D748, 5599, 1}, {0x1D749, 5600, 1},
+    {0x1D74A, 5601, 1}, {0x1D74B, 5602, 1}, {0x1D74C, 5603, 1},
+    {0x1D74D, 5604, 1}, {0x1D74E, 5605, 1}, {0x1D750, 5606, 1},
+    {0x1D751, 5607, 1}, {0x1D752, 5608, 1}, {0x1D753, 5609, 1},
+    {0x1D754, 5610, 1}, {0x1D755, 5611, 1}, {0x1D756, 5612, 1},
+    {0x1D757, 5613, 1}, {0x1D758, 5614, 1}, {0x1D759, 5615, 1},
+    {0x1D75A, 5616, 1}, {0x1D75B, 5617, 1}, {0x1D75C, 5618, 1},
+    {0x1D75D, 5619, 1}, {0x1D75E, 5620, 1}, {0x1D75F, 5621, 1},
+    {0x1D760, 5622, 1}, {0x1D761, 5623, 1}, {0x1D762, 5624, 1},
+    {0x1D763, 5625, 1}, {0x1D764, 5626, 1}, {0x1D765, 5627, 1},
+    {0x1D766, 5628, 1}, {0x1D767, 5629, 1}, {0x1D768, 5630, 1},
+    {0x1D769, 5631, 1}, {0x1D76A, 5632, 1}, {0x1D76B, 5633, 1},
+    {0x1D76C, 5634, 1}, {0x1D76D, 5635, 1}, {0x1D76E, 5636, 1},
+    {0x1D770, 5637, 1}, {0x1D771, 5638, 1}, {0x1D772, 5639, 1},
+    {0x1D773, 5640, 1}, {0x1D774, 5641, 1}, {0x1D775, 5642, 1},
+    {0x1D776, 5643, 1}, {0x1D777, 5644, 1}, {0x1D778, 5645, 1},
+    {0x1D779, 5646, 1}, {0x1D77A, 5647, 1}, {0x1D77B, 5648, 1},
+    {0x1D77C, 5649, 1}, {0x1D77D, 5650, 1}, {0x1D77E, 5651, 1},
+    {0x1D77F, 5652, 1}, {0x1D780, 5653, 1}, {0x1D781, 5654, 1},
+    {0x1D782, 5655, 1}, {0x1D783, 5656, 1}, {0x1D784, 5657, 1},
+    {0x1D785, 5658, 1}, {0x1D786, 5659, 1}, {0x1D787, 5660, 1},
+    {0x1D788, 5661, 1}, {0x1D78A, 5662, 1}, {0x1D78B, 5663, 1},
+    {0x1D78C, 5664, 1}, {0x1D78D, 5665, 1}, {0x1D78E, 5666, 1},
+    {0x1D78F, 5667, 1}, {0x1D790, 5668, 1}, {0x1D791, 5669, 1},
+    {0x1D792, 5670, 1}, {0x1D793, 5671, 1}, {0x1D794, 5672, 1},
+    {0x1D795, 5673, 1}, {0x1D796, 5674, 1}, {0x1D797, 5675, 1},
+    {0x1D798, 5676, 1}, {0x1D799, 5677, 1}, {0x1D79A, 5678, 1},
+    {0x1D79B, 5679, 1}, {0x1D79C, 5680, 1}, {0x1D79D, 5681, 1},
+    {0x1D79E, 5682, 1}, {0x1D79F, 5683, 1}, {0x1D7A0, 5684, 1},
+    {0x1D7A1, 5685, 1}, {0x1D7A2, 5686, 1}, {0x1D7A3, 5687, 1},
+    {0x1D7A4, 5688, 1}, {0x1D7A5, 5689, 1}, {0x1D7A6, 5690, 1},
+    {0x1D7A7, 5691, 1}, {0x1D7A8, 5692, 1}, {0x1D7AA, 5693, 1},
+    {0x1D7AB, 5694, 1}, {0x1D7AC, 5695, 1}, {0x1D7AD, 5696, 1},
+    {0x1D7AE, 5697, 1}, {0x1D7AF, 5698, 1}, {0x1D7B0, 5699, 1},
+    {0x1D7B1, 5700, 1}, {0x1D7B2, 5701, 1}, {0x1D7B3, 5702, 1},
+    {0x1D7B4, 5703, 1}, {0x1D7B5, 5704, 1}, {0x1D7B6, 5705, 1},
+    {0x1D7B7, 5706, 1}, {0x1D7B8, 5707, 1}, {0x1D7B9, 5708, 1},
+    {0x1D7BA, 5709, 1}, {0x1D7BB, 5710, 1}, {0x1D7BC, 5711, 1},
+    {0x1D7BD, 5712, 1}, {0x1D7BE, 5713, 1}, {0x1D7BF, 5714, 1},
+    {0x1D7C0, 5715, 1}, {0x1D7C1, 5716, 1}, {0x1D7C2, 5717, 1},
+    {0x1D7C4, 5718, 1}, {0x1D7C5, 5719, 1}, {0x1D7C6, 5720, 1},
+    {0x1D7C7, 5721, 1}, {0x1D7C8, 5722, 1}, {0x1D7C9, 5723, 1},
+    {0x1D7CA, 5724, 1}, {0x1D7CB, 5725, 1}, {0x1D7CE, 5726, 1},
+    {0x1D7CF, 5727, 1}, {0x1D7D0, 5728, 1}, {0x1D7D1, 5729, 1},
+    {0x1D7D2, 5730, 1}, {0x1D7D3, 5731, 1}, {0x1D7D4, 5732, 1},
+    {0x1D7D5, 5733, 1}, {0x1D7D6, 5734, 1}, {0x1D7D7, 5735, 1},
+    {0x1D7D8, 5736, 1}, {0x1D7D9, 5737, 1}, {0x1D7DA, 5738, 1},
+    {0x1D7DB, 5739, 1}, {0x1D7DC, 5740, 1}, {0x1D7DD, 5741, 1},
+    {0x1D7DE, 5742, 1}, {0x1D7DF, 5743, 1}, {0x1D7E0, 5744, 1},
+    {0x1D7E1, 5745, 1}, {0x1D7E2, 5746, 1}, {0x1D7E3, 5747, 1},
+    {0x1D7E4, 5748, 1}, {0x1D7E5, 5749, 1}, {0x1D7E6, 5750, 1},
+    {0x1D7E7, 5751, 1}, {0x1D7E8, 5752, 1}, {0x1D7E9, 5753, 1},
+    {0x1D7EA, 5754, 1}, {0x1D7EB, 5755, 1}, {0x1D7EC, 5756, 1},
+    {0x1D7ED, 5757, 1}, {0x1D7EE, 5758, 1}, {0x1D7EF, 5759, 1},
+    {0x1D7F0, 5760, 1}, {0x1D7F1, 5761, 1}, {0x1D7F2, 5762, 1},
+    {0x1D7F3, 5763, 1}, {0x1D7F4, 5764, 1}, {0x1D7F5, 5765, 1},
+    {0x1D7F6, 5766, 1}, {0x1D7F7, 5767, 1}, {0x1D7F8, 5768, 1},
+    {0x1D7F9, 5769, 1}, {0x1D7FA, 5770, 1}, {0x1D7FB, 5771, 1},
+    {0x1D7FC, 5772, 1}, {0x1D7FD, 5773, 1}, {0x1D7FE, 5774, 1},
+    {0x1D7FF, 5775, 1}, {0x1EE00, 5776, 1}, {0x1EE01, 5777, 1},
+    {0x1EE02, 5778, 1}, {0x1EE03, 5779, 1}, {0x1EE05, 5780, 1},
+    {0x1EE06, 5781, 1}, {0x1EE07, 5782, 1}, {0x1EE08, 5783, 1},
+    {0x1EE09, 5784, 1}, {0x1EE0A, 5785, 1}, {0x1EE0B, 5786, 1},
+    {0x1EE0C, 5787, 1}, {0x1EE0D, 5788, 1}, {0x1EE0E, 5789, 1},
+    {0x1EE0F, 5790, 1}, {0x1EE10, 5791, 1}, {0x1EE11, 5792, 1},
+    {0x1EE12, 5793, 1}, {0x1EE13, 5794, 1}, {0x1EE14, 5795, 1},
+    {0x1EE15, 5796, 1}, {0x1EE16, 5797, 1}, {0x1EE17, 5798, 1},
+    {0x1EE18, 5799, 1}, {0x1EE19, 5800, 1}, {0x1EE1A, 5801, 1},
+    {0x1EE1B, 5802, 1}, {0x1EE1C, 5803, 1}, {0x1EE1D, 5804, 1},
+    {0x1EE1E, 5805, 1}, {0x1EE1F, 5806, 1}, {0x1EE21, 5807, 1},
+    {0x1EE22, 5808, 1}, {0x1EE24, 5809, 1}, {0x1EE27, 5810, 1},
+    {0x1EE29, 5811, 1}, {0x1EE2A, 5812, 1}, {0x1EE2B, 5813, 1},
+    {0x1EE2C, 5814, 1}, {0x1EE2D, 5815, 1}, {0x1EE2E, 5816, 1},
+    {0x1EE2F, 5817, 1}, {0x1EE30, 5818, 1}, {0x1EE31, 5819, 1},
+    {0x1EE32, 5820, 1}, {0x1EE34, 5821, 1}, {0x1EE35, 5822, 1},
+    {0x1EE36, 5823, 1}, {0x1EE37, 5824, 1}, {0x1EE39, 5825, 1},
+    {0x1EE3B, 5826, 1}, {0x1EE42, 5827, 1}, {0x1EE47, 5828, 1},
+    {0x1EE49, 5829, 1}, {0x1EE4B, 5830, 1}, {0x1EE4D, 5831, 1},
+    {0x1EE4E, 5832, 1}, {0x1EE4F, 5833, 1}, {0x1EE51, 5834, 1},
+    {0x1EE52, 5835, 1}, {0x1EE54, 5836, 1}, {0x1EE57, 5837, 1},
+    {0x1EE59, 5838, 1}, {0x1EE5B, 5839, 1}, {0x1EE5D, 5840, 1},
+    {0x1EE5F, 5841, 1}, {0x1EE61, 5842, 1}, {0x1EE62, 5843, 1},
+    {0x1EE64, 5844, 1}, {0x1EE67, 5845, 1}, {0x1EE68, 5846, 1},
+    {0x1EE69, 5847, 1}, {0x1EE6A, 5848, 1}, {0x1EE6C, 5849, 1},
+    {0x1EE6D, 5850, 1}, {0x1EE6E, 5851, 1}, {0x1EE6F, 5852, 1},
+    {0x1EE70, 5853, 1}, {0x1EE71, 5854, 1}, {0x1EE72, 5855, 1},
+    {0x1EE74, 5856, 1}, {0x1EE75, 5857, 1}, {0x1EE76, 5858, 1},
+    {0x1EE77, 5859, 1}, {0x1EE79, 5860, 1}, {0x1EE7A, 5861, 1},
+    {0x1EE7B, 5862, 1}, {0x1EE7C, 5863, 1}, {0x1EE7E, 5864, 1},
+    {0x1EE80, 5865, 1}, {0x1EE81, 5866, 1}, {0x1EE82, 5867, 1},
+    {0x1EE83, 5868, 1}, {0x1EE84, 5869, 1}, {0x1EE85, 5870, 1},
+    {0x1EE86, 5871, 1}, {0x1EE87, 5872, 1}, {0x1EE88, 5873, 1},
+    {0x1EE89, 5874, 1}, {0x1EE8B, 5875, 1}, {0x1EE8C, 5876, 1},
+    {0x1EE8D, 5877, 1}, {0x1EE8E, 5878, 1}, {0x1EE8F, 5879, 1},
+    {0x1EE90, 5880, 1}, {0x1EE91, 5881, 1}, {0x1EE92, 5882, 1},
+    {0x1EE93, 5883, 1}, {0x1EE94, 5884, 1}, {0x1EE95, 5885, 1},
+    {0x1EE96, 5886, 1}, {0x1EE97, 5887, 1}, {0x1EE98, 5888, 1},
+    {0x1EE99, 5889, 1}, {0x1EE9A, 5890, 1}, {0x1EE9B, 5891, 1},
+    {0x1EEA1, 5892, 1}, {0x1EEA2, 5893, 1}, {0x1EEA3, 5894, 1},
+    {0x1EEA5, 5895, 1}, {0x1EEA6, 5896, 1}, {0x1EEA7, 5897, 1},
+    {0x1EEA8, 5898, 1}, {0x1EEA9, 5899, 1}, {0x1EEAB, 5900, 1},
+    {0x1EEAC, 5901, 1}, {0x1EEAD, 5902, 1}, {0x1EEAE, 5903, 1},
+    {0x1EEAF, 5904, 1}, {0x1EEB0, 5905, 1}, {0x1EEB1, 5906, 1},
+    {0x1EEB2, 5907, 1}, {0x1EEB3, 5908, 1}, {0x1EEB4, 5909, 1},
+    {0x1EEB5, 5910, 1}, {0x1EEB6, 5911, 1}, {0x1EEB7, 5912, 1},
+    {0x1EEB8, 5913, 1}, {0x1EEB9, 5914, 1}, {0x1EEBA, 5915, 1},
+    {0x1EEBB, 5916, 1}, {0x1FBF0, 5917, 1}, {0x1FBF1, 5918, 1},
+    {0x1FBF2, 5919, 1}, {0x1FBF3, 5920, 1}, {0x1FBF4, 5921, 1},
+    {0x1FBF5, 5922, 1}, {0x1FBF6, 5923, 1}, {0x1FBF7, 5924, 1},
+    {0x1FBF8, 5925, 1}, {0x1FBF9, 5926, 1}, {0x2F800, 5927, 1},
+    {0x2F801, 5928, 1}, {0x2F802, 5929, 1}, {0x2F803, 5930, 1},
+    {0x2F804, 5931, 1}, {0x2F805, 5932, 1}, {0x2F806, 5933, 1},
+    {0x2F807, 5934, 1}, {0x2F808, 5935, 1}, {0x2F809, 5936, 1},
+    {0x2F80A, 5937, 1}, {0x2F80B, 5938, 1}, {0x2F80C, 5939, 1},
+    {0x2F80D, 5940, 1}, {0x2F80E, 5941, 1}, {0x2F80F, 5942, 1},
+    {0x2F810, 5943, 1}, {0x2F811, 5944, 1}, {0x2F812, 5945, 1},
+    {0x2F813, 5946, 1}, {0x2F814, 5947, 1}, {0x2F815, 5948, 1},
+    {0x2F816, 5949, 1}, {0x2F817, 5950, 1}, {0x2F818, 5951, 1},
+    {0x2F819, 5952, 1}, {0x2F81A, 5953, 1}, {0x2F81B, 5954, 1},
+    {0x2F81C, 5955, 1}, {0x2F81D, 5956, 1}, {0x2F81E, 5957, 1},
+    {0x2F81F, 5958, 1}, {0x2F820, 5959, 1}, {0x2F821, 5960, 1},
+    {0x2F822, 5961, 1}, {0x2F823, 5962, 1}, {0x2F824, 5963, 1},
+    {0x2F825, 5964, 1}, {0x2F826, 5965, 1}, {0x2F827, 5966, 1},
+    {0x2F828, 5967, 1}, {0x2F829, 5968, 1}, {0x2F82A, 5969, 1},
+    {0x2F82B, 5970, 1}, {0x2F82C, 5971, 1}, {0x2F82D, 5972, 1},
+    {0x2F82E, 5973, 1}, {0x2F82F, 5974, 1}, {0x2F830, 5975, 1},
+    {0x2F831, 5976, 1}, {0x2F832, 5977, 1}, {0x2F833, 5978, 1},
+    {0x2F834, 5979, 1}, {0x2F835, 5980, 1}, {0x2F836, 5981, 1},
+    {0x2F837, 5982, 1}, {0x2F838, 5983, 1}, {0x2F839, 5984, 1},
+    {0x2F83A, 5985, 1}, {0x2F83B, 5986, 1}, {0x2F83C, 5987, 1},
+    {0x2F83D, 5988, 1}, {0x2F83E, 5989, 1}, {0x2F83F, 5990, 1},
+    {0x2F840, 5991, 1}, {0x2F841, 5992, 1}, {0x2F842, 5993, 1},
+    {0x2F843, 5994, 1}, {0x2F844, 5995, 1}, {0x2F845, 5996, 1},
+    {0x2F846, 5997, 1}, {0x2F847, 5998, 1}, {0x2F848, 5999, 1},
+    {0x2F849, 6000, 1}, {0x2F84A, 6001, 1}, {0x2F84B, 6002, 1},
+    {0x2F84C, 6003, 1}, {0x2F84D, 6004, 1}, {0x2F84E, 6005, 1},
+    {0x2F84F, 6006, 1}, {0x2F850, 6007, 1}, {0x2F851, 6008, 1},
+    {0x2F852, 6009, 1}, {0x2F853, 6010, 1}, {0x2F854, 6011, 1},
+    {0x2F855, 6012, 1}, {0x2F856, 6013, 1}, {0x2F857, 6014, 1},
+    {0x2F858, 6015, 1}, {0x2F859, 6016, 1}, {0x2F85A, 6017, 1},
+    {0x2F85B, 6018, 1}, {0x2F85C, 6019, 1}, {0x2F85D, 6020, 1},
+    {0x2F85E, 6021, 1}, {0x2F85F, 6022, 1}, {0x2F860, 6023, 1},
+    {0x2F861, 6024, 1}, {0x2F862, 6025, 1}, {0x2F863, 6026, 1},
+    {0x2F864, 6027, 1}, {0x2F865, 6028, 1}, {0x2F866, 6029, 1},
+    {0x2F867, 6030, 1}, {0x2F868, 6031, 1}, {0x2F869, 6032, 1},
+    {0x2F86A, 6033, 1}, {0x2F86B, 6034, 1}, {0x2F86C, 6035, 1},
+    {0x2F86D, 6036, 1}, {0x2F86E, 6037, 1}, {0x2F86F, 6038, 1},
+    {0x2F870, 6039, 1}, {0x2F871, 6040, 1}, {0x2F872, 6041, 1},
+    {0x2F873, 6042, 1}, {0x2F874, 6043, 1}, {0x2F875, 6044, 1},
+    {0x2F876, 6045, 1}, {0x2F877, 6046, 1}, {0x2F878, 6047, 1},
+    {0x2F879, 6048, 1}, {0x2F87A, 6049, 1}, {0x2F87B, 6050, 1},
+    {0x2F87C, 6051, 1}, {0x2F87D, 6052, 1}, {0x2F87E, 6053, 1},
+    {0x2F87F, 6054, 1}, {0x2F880, 6055, 1}, {0x2F881, 6056, 1},
+    {0x2F882, 6057, 1}, {0x2F883, 6058, 1}, {0x2F884, 6059, 1},
+    {0x2F885, 6060, 1}, {0x2F886, 6061, 1}, {0x2F887, 6062, 1},
+    {0x2F888, 6063, 1}, {0x2F889, 6064, 1}, {0x2F88A, 6065, 1},
+    {0x2F88B, 6066, 1}, {0x2F88C, 6067, 1}, {0x2F88D, 6068, 1},
+    {0x2F88E, 6069, 1}, {0x2F88F, 6070, 1}, {0x2F890, 6071, 1},
+    {0x2F891, 6072, 1}, {0x2F892, 6073, 1}, {0x2F893, 6074, 1},
+    {0x2F894, 6075, 1}, {0x2F895, 6076, 1}, {0x2F896, 6077, 1},
+    {0x2F897, 6078, 1}, {0x2F898, 6079, 1}, {0x2F899, 6080, 1},
+    {0x2F89A, 6081, 1}, {0x2F89B, 6082, 1}, {0x2F89C, 6083, 1},
+    {0x2F89D, 6084, 1}, {0x2F89E, 6085, 1}, {0x2F89F, 6086, 1},
+    {0x2F8A0, 6087, 1}, {0x2F8A1, 6088, 1}, {0x2F8A2, 6089, 1},
+    {0x2F8A3, 6090, 1}, {0x2F8A4, 6091, 1}, {0x2F8A5, 6092, 1},
+    {0x2F8A6, 6093, 1}, {0x2F8A7, 6094, 1}, {0x2F8A8, 6095, 1},
+    {0x2F8A9, 6096, 1}, {0x2F8AA, 6097, 1}, {0x2F8AB, 6098, 1},
+    {0x2F8AC, 6099, 1}, {0x2F8AD, 6100, 1}, {0x2F8AE, 6101, 1},
+    {0x2F8AF, 6102, 1}, {0x2F8B0, 6103, 1}, {0x2F8B1, 6104, 1},
+    {0x2F8B2, 6105, 1}, {0x2F8B3, 6106, 1}, {0x2F8B4, 6107, 1},
+    {0x2F8B5, 6108, 1}, {0x2F8B6, 6109, 1}, {0x2F8B7, 6110, 1},
+    {0x2F8B8, 6111, 1}, {0x2F8B9, 6112, 1}, {0x2F8BA, 6113, 1},
+    {0x2F8BB, 6114, 1}, {0x2F8BC, 6115, 1}, {0x2F8BD, 6116, 1},
+    {0x2F8BE, 6117, 1}, {0x2F8BF, 6118, 1}, {0x2F8C0, 6119, 1},
+    {0x2F8C1, 6120, 1}, {0x2F8C2, 6121, 1}, {0x2F8C3, 6122, 1},
+    {0x2F8C4, 6123, 1}, {0x2F8C5, 6124, 1}, {0x2F8C6, 6125, 1},
+    {0x2F8C7, 6126, 1}, {0x2F8C8, 6127, 1}, {0x2F8C9, 6128, 1},
+    {0x2F8CA, 6129, 1}, {0x2F8CB, 6130, 1}, {0x2F8CC, 6131, 1},
+    {0x2F8CD, 6132, 1}, {0x2F8CE, 6133, 1}, {0x2F8CF, 6134, 1},
+    {0x2F8D0, 6135, 1}, {0x2F8D1, 6136, 1}, {0x2F8D2, 6137, 1},
+    {0x2F8D3, 6138, 1}, {0x2F8D4, 6139, 1}, {0x2F8D5, 6140, 1},
+    {0x2F8D6, 6141, 1}, {0x2F8D7, 6142, 1}, {0x2F8D8, 6143, 1},
+    {0x2F8D9, 6144, 1}, {0x2F8DA, 6145, 1}, {0x2F8DB, 6146, 1},
+    {0x2F8DC, 6147, 1}, {0x2F8DD, 6148, 1}, {0x2F8DE, 6149, 1},
+    {0x2F8DF, 6150, 1}, {0x2F8E0, 6151, 1}, {0x2F8E1, 6152, 1},
+    {0x2F8E2, 6153, 1}, {0x2F8E3, 6154, 1}, {0x2F8E4, 6155, 1},
+    {0x2F8E5, 6156, 1}, {0x2F8E6, 6157, 1}, {0x2F8E7, 6158, 1},
+    {0x2F8E8, 6159, 1}, {0x2F8E9, 6160, 1}, {0x2F8EA, 6161, 1},
+    {0x2F8EB, 6162, 1}, {0x2F8EC, 6163, 1}, {0x2F8ED, 6164, 1},
+    {0x2F8EE, 6165, 1}, {0x2F8EF, 6166, 1}, {0x2F8F0, 6167, 1},
+    {0x2F8F1, 6168, 1}, {0x2F8F2, 6169, 1}, {0x2F8F3, 6170, 1},
+    {0x2F8F4, 6171, 1}, {0x2F8F5, 6172, 1}, {0x2F8F6, 6173, 1},
+    {0x2F8F7, 6174, 1}, {0x2F8F8, 6175, 1}, {0x2F8F9, 6176, 1},
+    {0x2F8FA, 6177, 1}, {0x2F8FB, 6178, 1}, {0x2F8FC, 6179, 1},
+    {0x2F8FD, 6180, 1}, {0x2F8FE, 6181, 1}, {0x2F8FF, 6182, 1},
+    {0x2F900, 6183, 1}, {0x2F901, 6184, 1}, {0x2F902, 6185, 1},
+    {0x2F903, 6186, 1}, {0x2F904, 6187, 1}, {0x2F905, 6188, 1},
+    {0x2F906, 6189, 1}, {0x2F907, 6190, 1}, {0x2F908, 6191, 1},
+    {0x2F909, 6192, 1}, {0x2F90A, 6193, 1}, {0x2F90B, 6194, 1},
+    {0x2F90C, 6195, 1}, {0x2F90D, 6196, 1}, {0x2F90E, 6197, 1},
+    {0x2F90F, 6198, 1}, {0x2F910, 6199, 1}, {0x2F911, 6200, 1},
+    {0x2F912, 6201, 1}, {0x2F913, 6202, 1}, {0x2F914, 6203, 1},
+    {0x2F915, 6204, 1}, {0x2F916, 6205, 1}, {0x2F917, 6206, 1},
+    {0x2F918, 6207, 1}, {0x2F919, 6208, 1}, {0x2F91A, 6209, 1},
+    {0x2F91B, 6210, 1}, {0x2F91C, 6211, 1}, {0x2F91D, 6212, 1},
+    {0x2F91E, 6213, 1}, {0x2F91F, 6214, 1}, {0x2F920, 6215, 1},
+    {0x2F921, 6216, 1}, {0x2F922, 6217, 1}, {0x2F923, 6218, 1},
+    {0x2F924, 6219, 1}, {0x2F925, 6220, 1}, {0x2F926, 6221, 1},
+    {0x2F927, 6222, 1}, {0x2F928, 6223, 1}, {0x2F929, 6224, 1},
+    {0x2F92A, 6225, 1}, {0x2F92B, 6226, 1}, {0x2F92C, 6227, 1},
+    {0x2F92D, 6228, 1}, {0x2F92E, 6229, 1}, {0x2F92F, 6230, 1},
+    {0x2F930, 6231, 1}, {0x2F931, 6232, 1}, {0x2F932, 6233, 1},
+    {0x2F933, 6234, 1}, {0x2F934, 6235, 1}, {0x2F935, 6236, 1},
+    {0x2F936, 6237, 1}, {0x2F937, 6238, 1}, {0x2F938, 6239, 1},
+    {0x2F939, 6240, 1}, {0x2F93A, 6241, 1}, {0x2F93B, 6242, 1},
+    {0x2F93C, 6243, 1}, {0x2F93D, 6244, 1}, {0x2F93E, 6245, 1},
+    {0x2F93F, 6246, 1}, {0x2F940, 6247, 1}, {0x2F941, 6248, 1},
+    {0x2F942, 6249, 1}, {0x2F943, 6250, 1}, {0x2F944, 6251, 1},
+    {0x2F945, 6252, 1}, {0x2F946, 6253, 1}, {0x2F947, 6254, 1},
+    {0x2F948, 6255, 1}, {0x2F949, 6256, 1}, {0x2F94A, 6257, 1},
+    {0x2F94B, 6258, 1}, {0x2F94C, 6259, 1}, {0x2F94D, 6260, 1},
+    {0x2F94E, 6261, 1}, {0x2F94F, 6262, 1}, {0x2F950, 6263, 1},
+    {0x2F951, 6264, 1}, {0x2F952, 6265, 1}, {0x2F953, 6266, 1},
+    {0x2F954, 6267, 1}, {0x2F955, 6268, 1}, {0x2F956, 6269, 1},
+    {0x2F957, 6270, 1}, {0x2F958, 6271, 1}, {0x2F959, 6272, 1},
+    {0x2F95A, 6273, 1}, {0x2F95B, 6274, 1}, {0x2F95C, 6275, 1},
+    {0x2F95D, 6276, 1}, {0x2F95E, 6277, 1}, {0x2F95F, 6278, 1},
+    {0x2F960, 6279, 1}, {0x2F961, 6280, 1}, {0x2F962, 6281, 1},
+    {0x2F963, 6282, 1}, {0x2F964, 6283, 1}, {0x2F965, 6284, 1},
+    {0x2F966, 6285, 1}, {0x2F967, 6286, 1}, {0x2F968, 6287, 1},
+    {0x2F969, 6288, 1}, {0x2F96A, 6289, 1}, {0x2F96B, 6290, 1},
+    {0x2F96C, 6291, 1}, {0x2F96D, 6292, 1}, {0x2F96E, 6293, 1},
+    {0x2F96F, 6294, 1}, {0x2F970, 6295, 1}, {0x2F971, 6296, 1},
+    {0x2F972, 6297, 1}, {0x2F973, 6298, 1}, {0x2F974, 6299, 1},
+    {0x2F975, 6300, 1}, {0x2F976, 6301, 1}, {0x2F977, 6302, 1},
+    {0x2F978, 6303, 1}, {0x2F979, 6304, 1}, {0x2F97A, 6305, 1},
+    {0x2F97B, 6306, 1}, {0x2F97C, 6307, 1}, {0x2F97D, 6308, 1},
+    {0x2F97E, 6309, 1}, {0x2F97F, 6310, 1}, {0x2F980, 6311, 1},
+    {0x2F981, 6312, 1}, {0x2F982, 6313, 1}, {0x2F983, 6314, 1},
+    {0x2F984, 6315, 1}, {0x2F985, 6316, 1}, {0x2F986, 6317, 1},
+    {0x2F987, 6318, 1}, {0x2F988, 6319, 1}, {0x2F989, 6320, 1},
+    {0x2F98A, 6321, 1}, {0x2F98B, 6322, 1}, {0x2F98C, 6323, 1},
+    {0x2F98D, 6324, 1}, {0x2F98E, 6325, 1}, {0x2F98F, 6326, 1},
+    {0x2F990, 6327, 1}, {0x2F991, 6328, 1}, {0x2F992, 6329, 1},
+    {0x2F993, 6330, 1}, {0x2F994, 6331, 1}, {0x2F995, 6332, 1},
+    {0x2F996, 6333, 1}, {0x2F997, 6334, 1}, {0x2F998, 6335, 1},
+    {0x2F999, 6336, 1}, {0x2F99A, 6337, 1}, {0x2F99B, 6338, 1},
+    {0x2F99C, 6339, 1}, {0x2F99D, 6340, 1}, {0x2F99E, 6341, 1},
+    {0x2F99F, 6342, 1}, {0x2F9A0, 6343, 1}, {0x2F9A1, 6344, 1},
+    {0x2F9A2, 6345, 1}, {0x2F9A3, 6346, 1}, {0x2F9A4, 6347, 1},
+    {0x2F9A5, 6348, 1}, {0x2F9A6, 6349, 1}, {0x2F9A7, 6350, 1},
+    {0x2F9A8, 6351, 1}, {0x2F9A9, 6352, 1}, {0x2F9AA, 6353, 1},
+    {0x2F9AB, 6354, 1}, {0x2F9AC, 6355, 1}, {0x2F9AD, 6356, 1},
+    {0x2F9AE, 6357, 1}, {0x2F9AF, 6358, 1}, {0x2F9B0, 6359, 1},
+    {0x2F9B1, 6360, 1}, {0x2F9B2, 6361, 1}, {0x2F9B3, 6362, 1},
+    {0x2F9B4, 6363, 1}, {0x2F9B5, 6364, 1}, {0x2F9B6, 6365, 1},
+    {0x2F9B7, 6366, 1}, {0x2F9B8, 6367, 1}, {0x2F9B9, 6368, 1},
+    {0x2F9BA, 6369, 1}, {0x2F9BB, 6370, 1}, {0x2F9BC, 6371, 1},
+    {0x2F9BD, 6372, 1}, {0x2F9BE, 6373, 1}, {0x2F9BF, 6374, 1},
+    {0x2F9C0, 6375, 1}, {0x2F9C1, 6376, 1}, {0x2F9C2, 6377, 1},
+    {0x2F9C3, 6378, 1}, {0x2F9C4, 6379, 1}, {0x2F9C5, 6380, 1},
+    {0x2F9C6, 6381, 1}, {0x2F9C7, 6382, 1}, {0x2F9C8, 6383, 1},
+    {0x2F9C9, 6384, 1}, {0x2F9CA, 6385, 1}, {0x2F9CB, 6386, 1},
+    {0x2F9CC, 6387, 1}, {0x2F9CD, 6388, 1}, {0x2F9CE, 6389, 1},
+    {0x2F9CF, 6390, 1}, {0x2F9D0, 6391, 1}, {0x2F9D1, 6392, 1},
+    {0x2F9D2, 6393, 1}, {0x2F9D3, 6394, 1}, {0x2F9D4, 6395, 1},
+    {0x2F9D5, 6396, 1}, {0x2F9D6, 6397, 1}, {0x2F9D7, 6398, 1},
+    {0x2F9D8, 6399, 1}, {0x2F9D9, 6400, 1}, {0x2F9DA, 6401, 1},
+    {0x2F9DB, 6402, 1}, {0x2F9DC, 6403, 1}, {0x2F9DD, 6404, 1},
+    {0x2F9DE, 6405, 1}, {0x2F9DF, 6406, 1}, {0x2F9E0, 6407, 1},
+    {0x2F9E1, 6408, 1}, {0x2F9E2, 6409, 1}, {0x2F9E3, 6410, 1},
+    {0x2F9E4, 6411, 1}, {0x2F9E5, 6412, 1}, {0x2F9E6, 6413, 1},
+    {0x2F9E7, 6414, 1}, {0x2F9E8, 6415, 1}, {0x2F9E9, 6416, 1},
+    {0x2F9EA, 6417, 1}, {0x2F9EB, 6418, 1}, {0x2F9EC, 6419, 1},
+    {0x2F9ED, 6420, 1}, {0x2F9EE, 6421, 1}, {0x2F9EF, 6422, 1},
+    {0x2F9F0, 6423, 1}, {0x2F9F1, 6424, 1}, {0x2F9F2, 6425, 1},
+    {0x2F9F3, 6426, 1}, {0x2F9F4, 6427, 1}, {0x2F9F5, 6428, 1},
+    {0x2F9F6, 6429, 1}, {0x2F9F7, 6430, 1}, {0x2F9F8, 6431, 1},
+    {0x2F9F9, 6432, 1}, {0x2F9FA, 6433, 1}, {0x2F9FB, 6434, 1},
+    {0x2F9FC, 6435, 1}, {0x2F9FD, 6436, 1}, {0x2F9FE, 6437, 1},
+    {0x2F9FF, 6438, 1}, {0x2FA00, 6439, 1}, {0x2FA01, 6440, 1},
+    {0x2FA02, 6441, 1}, {0x2FA03, 6442, 1}, {0x2FA04, 6443, 1},
+    {0x2FA05, 6444, 1}, {0x2FA06, 6445, 1}, {0x2FA07, 6446, 1},
+    {0x2FA08, 6447, 1}, {0x2FA09, 6448, 1}, {0x2FA0A, 6449, 1},
+    {0x2FA0B, 6450, 1}, {0x2FA0C, 6451, 1}, {0x2FA0D, 6452, 1},
+    {0x2FA0E, 6453, 1}, {0x2FA0F, 6454, 1}, {0x2FA10, 6455, 1},
+    {0x2FA11, 6456, 1}, {0x2FA12, 6457, 1}, {0x2FA13, 6458, 1},
+    {0x2FA14, 6459, 1}, {0x2FA15, 6460, 1}, {0x2FA16, 6461, 1},
+    {0x2FA17, 6462, 1}, {0x2FA18, 6463, 1}, {0x2FA19, 6464, 1},
+    {0x2FA1A, 6465, 1}, {0x2FA1B, 6466, 1}, {0x2FA1C, 6467, 1},
+    {0x2FA1D, 6468, 1},
+};
+
+constexpr uint32_t kDecompositionData[] = {
+    0x61, 0x3BC, 0x6F, 0x41, 0x300, 0x41, 0x301, 0x41,
+    0x302, 0x41, 0x303, 0x41, 0x308, 0x41, 0x30A, 0x43,
+    0x327, 0x45, 0x300, 0x45, 0x301, 0x45, 0x302, 0x45,
+    0x308, 0x49, 0x300, 0x49, 0x301, 0x49, 0x302, 0x49,
+    0x308, 0x4E, 0x303, 0x4F, 0x300, 0x4F, 0x301, 0x4F,
+    0x302, 0x4F, 0x303, 0x4F, 0x308, 0x55, 0x300, 0x55,
+    0x301, 0x55, 0x302, 0x55, 0x308, 0x59, 0x301, 0x61,
+    0x300, 0x61, 0x301, 0x61, 0x302, 0x61, 0x303, 0x61,
+    0x308, 0x61, 0x30A, 0x63, 0x327, 0x65, 0x300, 0x65,
+    0x301, 0x65, 0x302, 0x65, 0x308, 0x69, 0x300, 0x69,
+    0x301, 0x69, 0x302, 0x69, 0x308, 0x6E, 0x303, 0x6F,
+    0x300, 0x6F, 0x301, 0x6F, 0x302, 0x6F, 0x303, 0x6F,
+    0x308, 0x75, 0x300, 0x75, 0x301, 0x75, 0x302, 0x75,
+    0x308, 0x79, 0x301, 0x79, 0x308, 0x41, 0x304, 0x61,
+    0x304, 0x41, 0x306, 0x61, 0x306, 0x41, 0x328, 0x61,
+    0x328, 0x43, 0x301, 0x63, 0x301, 0x43, 0x302, 0x63,
+    0x302, 0x43, 0x307, 0x63, 0x307, 0x43, 0x30C, 0x63,
+    0x30C, 0x44, 0x30C, 0x64, 0x30C, 0x45, 0x304, 0x65,
+    0x304, 0x45, 0x306, 0x65, 0x306, 0x45, 0x307, 0x65,
+    0x307, 0x45, 0x328, 0x65, 0x328, 0x45, 0x30C, 0x65,
+    0x30C, 0x47, 0x302, 0x67, 0x302, 0x47, 0x306, 0x67,
+    0x306, 0x47, 0x307, 0x67, 0x307, 0x47, 0x327, 0x67,
+    0x327, 0x48, 0x302, 0x68, 0x302, 0x49, 0x303, 0x69,
+    0x303, 0x49, 0x304, 0x69, 0x304, 0x49, 0x306, 0x69,
+    0x306, 0x49, 0x328, 0x69, 0x328, 0x49, 0x307, 0x49,
+    0x4A, 0x69, 0x6A, 0x4A, 0x302, 0x6A, 0x302, 0x4B,
+    0x327, 0x6B, 0x327, 0x4C, 0x301, 0x6C, 0x301, 0x4C,
+    0x327, 0x6C, 0x327, 0x4C, 0x30C, 0x6C, 0x30C, 0x4C,
+    0xB7, 0x6C, 0xB7, 0x4E, 0x301, 0x6E, 0x301, 0x4E,
+    0x327, 0x6E, 0x327, 0x4E, 0x30C, 0x6E, 0x30C, 0x2BC,
+    0x6E, 0x4F, 0x304, 0x6F, 0x304, 0x4F, 0x306, 0x6F,
+    0x306, 0x4F, 0x30B, 0x6F, 0x30B, 0x52, 0x301, 0x72,
+    0x301, 0x52, 0x327, 0x72, 0x327, 0x52, 0x30C, 0x72,
+    0x30C, 0x53, 0x301, 0x73, 0x301, 0x53, 0x302, 0x73,
+    0x302, 0x53, 0x327, 0x73, 0x327, 0x53, 0x30C, 0x73,
+    0x30C, 0x54, 0x327, 0x74, 0x327, 0x54, 0x30C, 0x74,
+    0x30C, 0x55, 0x303, 0x75, 0x303, 0x55, 0x304, 0x75,
+    0x304, 0x55, 0x306, 0x75, 0x306, 0x55, 0x30A, 0x75,
+    0x30A, 0x55, 0x30B, 0x75, 0x30B, 0x55, 0x328, 0x75,
+    0x328, 0x57, 0x302, 0x77, 0x302, 0x59, 0x302, 0x79,
+    0x302, 0x59, 0x308, 0x5A, 0x301, 0x7A, 0x301, 0x5A,
+    0x307, 0x7A, 0x307, 0x5A, 0x30C, 0x7A, 0x30C, 0x73,
+    0x4F, 0x31B, 0x6F, 0x31B, 0x55, 0x31B, 0x75, 0x31B,
+    0x44, 0x5A, 0x30C, 0x44, 0x7A, 0x30C, 0x64, 0x7A,
+    0x30C, 0x4C, 0x4A, 0x4C, 0x6A, 0x6C, 0x6A, 0x4E,
+    0x4A, 0x4E, 0x6A, 0x6E, 0x6A, 0x41, 0x30C, 0x61,
+    0x30C, 0x49, 0x30C, 0x69, 0x30C, 0x4F, 0x30C, 0x6F,
+    0x30C, 0x55, 0x30C, 0x75, 0x30C, 0x55, 0x308, 0x304,
+    0x75, 0x308, 0x304, 0x55, 0x308, 0x301, 0x75, 0x308,
+    0x301, 0x55, 0x308, 0x30C, 0x75, 0x308, 0x30C, 0x55,
+    0x308, 0x300, 0x75, 0x308, 0x300, 0x41, 0x308, 0x304,
+    0x61, 0x308, 0x304, 0x41, 0x307, 0x304, 0x61, 0x307,
+    0x304, 0xC6, 0x304, 0xE6, 0x304, 0x47, 0x30C, 0x67,
+    0x30C, 0x4B, 0x30C, 0x6B, 0x30C, 0x4F, 0x328, 0x6F,
+    0x328, 0x4F, 0x328, 0x304, 0x6F, 0x328, 0x304, 0x1B7,
+    0x30C, 0x292, 0x30C, 0x6A, 0x30C, 0x44, 0x5A, 0x44,
+    0x7A, 0x64, 0x7A, 0x47, 0x301, 0x67, 0x301, 0x4E,
+    0x300, 0x6E, 0x300, 0x41, 0x30A, 0x301, 0x61, 0x30A,
+    0x301, 0xC6, 0x301, 0xE6, 0x301, 0xD8, 0x301, 0xF8,
+    0x301, 0x41, 0x30F, 0x61, 0x30F, 0x41, 0x311, 0x61,
+    0x311, 0x45, 0x30F, 0x65, 0x30F, 0x45, 0x311, 0x65,
+    0x311, 0x49, 0x30F, 0x69, 0x30F, 0x49, 0x311, 0x69,
+    0x311, 0x4F, 0x30F, 0x6F, 0x30F, 0x4F, 0x311, 0x6F,
+    0x311, 0x52, 0x30F, 0x72, 0x30F, 0x52, 0x311, 0x72,
+    0x311, 0x55, 0x30F, 0x75, 0x30F, 0x55, 0x311, 0x75,
+    0x311, 0x53, 0x326, 0x73, 0x326, 0x54, 0x326, 0x74,
+    0x326, 0x48, 0x30C, 0x68, 0x30C, 0x41, 0x307, 0x61,
+    0x307, 0x45, 0x327, 0x65, 0x327, 0x4F, 0x308, 0x304,
+    0x6F, 0x308, 0x304, 0x4F, 0x303, 0x304, 0x6F, 0x303,
+    0x304, 0x4F, 0x307, 0x6F, 0x307, 0x4F, 0x307, 0x304,
+    0x6F, 0x307, 0x304, 0x59, 0x304, 0x79, 0x304, 0x68,
+    0x266, 0x6A, 0x72, 0x279, 0x27B, 0x281, 0x77, 0x79,
+    0x263, 0x6C, 0x73, 0x78, 0x295, 0x300, 0x301, 0x313,
+    0x308, 0x301, 0x2B9, 0x391, 0x301, 0xB7, 0x395, 0x301,
+    0x397, 0x301, 0x399, 0x301, 0x39F, 0x301, 0x3A5, 0x301,
+    0x3A9, 0x301, 0x3B9, 0x308, 0x301, 0x399, 0x308, 0x3A5,
+    0x308, 0x3B1, 0x301, 0x3B5, 0x301, 0x3B7, 0x301, 0x3B9,
+    0x301, 0x3C5, 0x308, 0x301, 0x3B9, 0x308, 0x3C5, 0x308,
+    0x3BF, 0x301, 0x3C5, 0x301, 0x3C9, 0x301, 0x3B2, 0x3B8,
+    0x3A5, 0x3A5, 0x301, 0x3A5, 0x308, 0x3C6, 0x3C0, 0x3BA,
+    0x3C1, 0x3C2, 0x398, 0x3B5, 0x3A3, 0x415, 0x300, 0x415,
+    0x308, 0x413, 0x301, 0x406, 0x308, 0x41A, 0x301, 0x418,
+    0x300, 0x423, 0x306, 0x418, 0x306, 0x438, 0x306, 0x435,
+    0x300, 0x435, 0x308, 0x433, 0x301, 0x456, 0x308, 0x43A,
+    0x301, 0x438, 0x300, 0x443, 0x306, 0x474, 0x30F, 0x475,
+    0x30F, 0x416, 0x306, 0x436, 0x306, 0x410, 0x306, 0x430,
+    0x306, 0x410, 0x308, 0x430, 0x308, 0x415, 0x306, 0x435,
+    0x306, 0x4D8, 0x308, 0x4D9, 0x308, 0x416, 0x308, 0x436,
+    0x308, 0x417, 0x308, 0x437, 0x308, 0x418, 0x304, 0x438,
+    0x304, 0x418, 0x308, 0x438, 0x308, 0x41E, 0x308, 0x43E,
+    0x308, 0x4E8, 0x308, 0x4E9, 0x308, 0x42D, 0x308, 0x44D,
+    0x308, 0x423, 0x304, 0x443, 0x304, 0x423, 0x308, 0x443,
+    0x308, 0x423, 0x30B, 0x443, 0x30B, 0x427, 0x308, 0x447,
+    0x308, 0x42B, 0x308, 0x44B, 0x308, 0x565, 0x582, 0x627,
+    0x653, 0x627, 0x654, 0x648, 0x654, 0x627, 0x655, 0x64A,
+    0x654, 0x627, 0x674, 0x648, 0x674, 0x6C7, 0x674, 0x64A,
+    0x674, 0x6D5, 0x654, 0x6C1, 0x654, 0x6D2, 0x654, 0x928,
+    0x93C, 0x930, 0x93C, 0x933, 0x93C, 0x915, 0x93C, 0x916,
+    0x93C, 0x917, 0x93C, 0x91C, 0x93C, 0x921, 0x93C, 0x922,
+    0x93C, 0x92B, 0x93C, 0x92F, 0x93C, 0x9C7, 0x9BE, 0x9C7,
+    0x9D7, 0x9A1, 0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC, 0xA32,
+    0xA3C, 0xA38, 0xA3C, 0xA16, 0xA3C, 0xA17, 0xA3C, 0xA1C,
+    0xA3C, 0xA2B, 0xA3C, 0xB47, 0xB56, 0xB47, 0xB3E, 0xB47,
+    0xB57, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xB92, 0xBD7, 0xBC6,
+    0xBBE, 0xBC7, 0xBBE, 0xBC6, 0xBD7, 0xC46, 0xC56, 0xCBF,
+    0xCD5, 0xCC6, 0xCD5, 0xCC6, 0xCD6, 0xCC6, 0xCC2, 0xCC6,
+    0xCC2, 0xCD5, 0xD46, 0xD3E, 0xD47, 0xD3E, 0xD46, 0xD57,
+    0xDD9, 0xDCA, 0xDD9, 0xDCF, 0xDD9, 0xDCF, 0xDCA, 0xDD9,
+    0xDDF, 0xE4D, 0xE32, 0xECD, 0xEB2, 0xEAB, 0xE99, 0xEAB,
+    0xEA1, 0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51, 0xFB7, 0xF56,
+    0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71, 0xF72, 0xF71,
+    0xF74, 0xFB2, 0xF80, 0xFB2, 0xF71, 0xF80, 0xFB3, 0xF80,
+    0xFB3, 0xF71, 0xF80, 0xF71, 0xF80, 0xF92, 0xFB7, 0xF9C,
+    0xFB7, 0xFA1, 0xFB7, 0xFA6, 0xFB7, 0xFAB, 0xFB7, 0xF90,
+    0xFB5, 0x1025, 0x102E, 0x10DC, 0x1B05, 0x1B35, 0x1B07, 0x1B35,
+    0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35,
+    0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35,
+    0x1B42, 0x1B35, 0x41, 0xC6, 0x42, 0x44, 0x45, 0x18E,
+    0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+    0x4F, 0x222, 0x50, 0x52, 0x54, 0x55, 0x57, 0x61,
+    0x250, 0x251, 0x1D02, 0x62, 0x64, 0x65, 0x259, 0x25B,
+    0x25C, 0x67, 0x6B, 0x6D, 0x14B, 0x6F, 0x254, 0x1D16,
+    0x1D17, 0x70, 0x74, 0x75, 0x1D1D, 0x26F, 0x76, 0x1D25,
+    0x3B2, 0x3B3, 0x3B4, 0x3C6, 0x3C7, 0x69, 0x72, 0x75,
+    0x76, 0x3B2, 0x3B3, 0x3C1, 0x3C6, 0x3C7, 0x43D, 0x252,
+    0x63, 0x255, 0xF0, 0x25C, 0x66, 0x25F, 0x261, 0x265,
+    0x268, 0x269, 0x26A, 0x1D7B, 0x29D, 0x26D, 0x1D85, 0x29F,
+    0x271, 0x270, 0x272, 0x273, 0x274, 0x275, 0x278, 0x282,
+    0x283, 0x1AB, 0x289, 0x28A, 0x1D1C, 0x28B, 0x28C, 0x7A,
+    0x290, 0x291, 0x292, 0x3B8, 0x41, 0x325, 0x61, 0x325,
+    0x42, 0x307, 0x62, 0x307, 0x42, 0x323, 0x62, 0x323,
+    0x42, 0x331, 0x62, 0x331, 0x43, 0x327, 0x301, 0x63,
+    0x327, 0x301, 0x44, 0x307, 0x64, 0x307, 0x44, 0x323,
+    0x64, 0x323, 0x44, 0x331, 0x64, 0x331, 0x44, 0x327,
+    0x64, 0x327, 0x44, 0x32D, 0x64, 0x32D, 0x45, 0x304,
+    0x300, 0x65, 0x304, 0x300, 0x45, 0x304, 0x301, 0x65,
+    0x304, 0x301, 0x45, 0x32D, 0x65, 0x32D, 0x45, 0x330,
+    0x65, 0x330, 0x45, 0x327, 0x306, 0x65, 0x327, 0x306,
+    0x46, 0x307, 0x66, 0x307, 0x47, 0x304, 0x67, 0x304,
+    0x48, 0x307, 0x68, 0x307, 0x48, 0x323, 0x68, 0x323,
+    0x48, 0x308, 0x68, 0x308, 0x48, 0x327, 0x68, 0x327,
+    0x48, 0x32E, 0x68, 0x32E, 0x49, 0x330, 0x69, 0x330,
+    0x49, 0x308, 0x301, 0x69, 0x308, 0x301, 0x4B, 0x301,
+    0x6B, 0x301, 0x4B, 0x323, 0x6B, 0x323, 0x4B, 0x331,
+    0x6B, 0x331, 0x4C, 0x323, 0x6C, 0x323, 0x4C, 0x323,
+    0x304, 0x6C, 0x323, 0x304, 0x4C, 0x331, 0x6C, 0x331,
+    0x4C, 0x32D, 0x6C, 0x32D, 0x4D, 0x301, 0x6D, 0x301,
+    0x4D, 0x307, 0x6D, 0x307, 0x4D, 0x323, 0x6D, 0x323,
+    0x4E, 0x307, 0x6E, 0x307, 0x4E, 0x323, 0x6E, 0x323,
+    0x4E, 0x331, 0x6E, 0x331, 0x4E, 0x32D, 0x6E, 0x32D,
+    0x4F, 0x303, 0x301, 0x6F, 0x303, 0x301, 0x4F, 0x303,
+    0x308, 0x6F, 0x303, 0x308, 0x4F, 0x304, 0x300, 0x6F,
+    0x304, 0x300, 0x4F, 0x304, 0x301, 0x6F, 0x304, 0x301,
+    0x50, 0x301, 0x70, 0x301, 0x50, 0x307, 0x70, 0x307,
+    0x52, 0x307, 0x72, 0x307, 0x52, 0x323, 0x72, 0x323,
+    0x52, 0x323, 0x304, 0x72, 0x323, 0x304, 0x52, 0x331,
+    0x72, 0x331, 0x53, 0x307, 0x73, 0x307, 0x53, 0x323,
+    0x73, 0x323, 0x53, 0x301, 0x307, 0x73, 0x301, 0x307,
+    0x53, 0x30C, 0x307, 0x73, 0x30C, 0x307, 0x53, 0x323,
+    0x307, 0x73, 0x323, 0x307, 0x54, 0x307, 0x74, 0x307,
+    0x54, 0x323, 0x74, 0x323, 0x54, 0x331, 0x74, 0x331,
+    0x54, 0x32D, 0x74, 0x32D, 0x55, 0x324, 0x75, 0x324,
+    0x55, 0x330, 0x75, 0x330, 0x55, 0x32D, 0x75, 0x32D,
+    0x55, 0x303, 0x301, 0x75, 0x303, 0x301, 0x55, 0x304,
+    0x308, 0x75, 0x304, 0x308, 0x56, 0x303, 0x76, 0x303,
+    0x56, 0x323, 0x76, 0x323, 0x57, 0x300, 0x77, 0x300,
+    0x57, 0x301, 0x77, 0x301, 0x57, 0x308, 0x77, 0x308,
+    0x57, 0x307, 0x77, 0x307, 0x57, 0x323, 0x77, 0x323,
+    0x58, 0x307, 0x78, 0x307, 0x58, 0x308, 0x78, 0x308,
+    0x59, 0x307, 0x79, 0x307, 0x5A, 0x302, 0x7A, 0x302,
+    0x5A, 0x323, 0x7A, 0x323, 0x5A, 0x331, 0x7A, 0x331,
+    0x68, 0x331, 0x74, 0x308, 0x77, 0x30A, 0x79, 0x30A,
+    0x61, 0x2BE, 0x73, 0x307, 0x41, 0x323, 0x61, 0x323,
+    0x41, 0x309, 0x61, 0x309, 0x41, 0x302, 0x301, 0x61,
+    0x302, 0x301, 0x41, 0x302, 0x300, 0x61, 0x302, 0x300,
+    0x41, 0x302, 0x309, 0x61, 0x302, 0x309, 0x41, 0x302,
+    0x303, 0x61, 0x302, 0x303, 0x41, 0x323, 0x302, 0x61,
+    0x323, 0x302, 0x41, 0x306, 0x301, 0x61, 0x306, 0x301,
+    0x41, 0x306, 0x300, 0x61, 0x306, 0x300, 0x41, 0x306,
+    0x309, 0x61, 0x306, 0x309, 0x41, 0x306, 0x303, 0x61,
+    0x306, 0x303, 0x41, 0x323, 0x306, 0x61, 0x323, 0x306,
+    0x45, 0x323, 0x65, 0x323, 0x45, 0x309, 0x65, 0x309,
+    0x45, 0x303, 0x65, 0x303, 0x45, 0x302, 0x301, 0x65,
+    0x302, 0x301, 0x45, 0x302, 0x300, 0x65, 0x302, 0x300,
+    0x45, 0x302, 0x309, 0x65, 0x302, 0x309, 0x45, 0x302,
+    0x303, 0x65, 0x302, 0x303, 0x45, 0x323, 0x302, 0x65,
+    0x323, 0x302, 0x49, 0x309, 0x69, 0x309, 0x49, 0x323,
+    0x69, 0x323, 0x4F, 0x323, 0x6F, 0x323, 0x4F, 0x309,
+    0x6F, 0x309, 0x4F, 0x302, 0x301, 0x6F, 0x302, 0x301,
+    0x4F, 0x302, 0x300, 0x6F, 0x302, 0x300, 0x4F, 0x302,
+    0x309, 0x6F, 0x302, 0x309, 0x4F, 0x302, 0x303, 0x6F,
+    0x302, 0x303, 0x4F, 0x323, 0x302, 0x6F, 0x323, 0x302,
+    0x4F, 0x31B, 0x301, 0x6F, 0x31B, 0x301, 0x4F, 0x31B,
+    0x300, 0x6F, 0x31B, 0x300, 0x4F, 0x31B, 0x309, 0x6F,
+    0x31B, 0x309, 0x4F, 0x31B, 0x303, 0x6F, 0x31B, 0x303,
+    0x4F, 0x31B, 0x323, 0x6F, 0x31B, 0x323, 0x55, 0x323,
+    0x75, 0x323, 0x55, 0x309, 0x75, 0x309, 0x55, 0x31B,
+    0x301, 0x75, 0x31B, 0x301, 0x55, 0x31B, 0x300, 0x75,
+    0x31B, 0x300, 0x55, 0x31B, 0x309, 0x75, 0x31B, 0x309,
+    0x55, 0x31B, 0x303, 0x75, 0x31B, 0x303, 0x55, 0x31B,
+    0x323, 0x75, 0x31B, 0x323, 0x59, 0x300, 0x79, 0x300,
+    0x59, 0x323, 0x79, 0x323, 0x59, 0x309, 0x79, 0x309,
+    0x59, 0x303, 0x79, 0x303, 0x3B1, 0x313, 0x3B1, 0x314,
+    0x3B1, 0x313, 0x300, 0x3B1, 0x314, 0x300, 0x3B1, 0x313,
+    0x301, 0x3B1, 0x314, 0x301, 0x3B1, 0x313, 0x342, 0x3B1,
+    0x314, 0x342, 0x391, 0x313, 0x391, 0x314, 0x391, 0x313,
+    0x300, 0x391, 0x314, 0x300, 0x391, 0x313, 0x301, 0x391,
+    0x314, 0x301, 0x391, 0x313, 0x342, 0x391, 0x314, 0x342,
+    0x3B5, 0x313, 0x3B5, 0x314, 0x3B5, 0x313, 0x300, 0x3B5,
+    0x314, 0x300, 0x3B5, 0x313, 0x301, 0x3B5, 0x314, 0x301,
+    0x395, 0x313, 0x395, 0x314, 0x395, 0x313, 0x300, 0x395,
+    0x314, 0x300, 0x395, 0x313, 0x301, 0x395, 0x314, 0x301,
+    0x3B7, 0x313, 0x3B7, 0x314, 0x3B7, 0x313, 0x300, 0x3B7,
+    0x314, 0x300, 0x3B7, 0x313, 0x301, 0x3B7, 0x314, 0x301,
+    0x3B7, 0x313, 0x342, 0x3B7, 0x314, 0x342, 0x397, 0x313,
+    0x397, 0x314, 0x397, 0x313, 0x300, 0x397, 0x314, 0x300,
+    0x397, 0x313, 0x301, 0x397, 0x314, 0x301, 0x397, 0x313,
+    0x342, 0x397, 0x314, 0x342, 0x3B9, 0x313, 0x3B9, 0x314,
+    0x3B9, 0x313, 0x300, 0x3B9, 0x314, 0x300, 0x3B9, 0x313,
+    0x301, 0x3B9, 0x314, 0x301, 0x3B9, 0x313, 0x342, 0x3B9,
+    0x314, 0x342, 0x399, 0x313, 0x399, 0x314, 0x399, 0x313,
+    0x300, 0x399, 0x314, 0x300, 0x399, 0x313, 0x301, 0x399,
+    0x314, 0x301, 0x399, 0x313, 0x342, 0x399, 0x314, 0x342,
+    0x3BF, 0x313, 0x3BF, 0x314, 0x3BF, 0x313, 0x300, 0x3BF,
+    0x314, 0x300, 0x3BF, 0x313, 0x301, 0x3BF, 0x314, 0x301,
+    0x39F, 0x313, 0x39F, 0x314, 0x39F, 0x313, 0x300, 0x39F,
+    0x314, 0x300, 0x39F, 0x313, 0x301, 0x39F, 0x314, 0x301,
+    0x3C5, 0x313, 0x3C5, 0x314, 0x3C5, 0x313, 0x300, 0x3C5,
+    0x314, 0x300, 0x3C5, 0x313, 0x301, 0x3C5, 0x314, 0x301,
+    0x3C5, 0x313, 0x342, 0x3C5, 0x314, 0x342, 0x3A5, 0x314,
+    0x3A5, 0x314, 0x300, 0x3A5, 0x314, 0x301, 0x3A5, 0x314,
+    0x342, 0x3C9, 0x313, 0x3C9, 0x314, 0x3C9, 0x313, 0x300,
+    0x3C9, 0x314, 0x300, 0x3C9, 0x313, 0x301, 0x3C9, 0x314,
+    0x301, 0x3C9, 0x313, 0x342, 0x3C9, 0x314, 0x342, 0x3A9,
+    0x313, 0x3A9, 0x314, 0x3A9, 0x313, 0x300, 0x3A9, 0x314,
+    0x300, 0x3A9, 0x313, 0x301, 0x3A9, 0x314, 0x301, 0x3A9,
+    0x313, 0x342, 0x3A9, 0x314, 0x342, 0x3B1, 0x300, 0x3B1,
+    0x301, 0x3B5, 0x300, 0x3B5, 0x301, 0x3B7, 0x300, 0x3B7,
+    0x301, 0x3B9, 0x300, 0x3B9, 0x301, 0x3BF, 0x300, 0x3BF,
+    0x301, 0x3C5, 0x300, 0x3C5, 0x301, 0x3C9, 0x300, 0x3C9,
+    0x301, 0x3B1, 0x313, 0x345, 0x3B1, 0x314, 0x345, 0x3B1,
+    0x313, 0x300, 0x345, 0x3B1, 0x314, 0x300, 0x345, 0x3B1,
+    0x313, 0x301, 0x345, 0x3B1, 0x314, 0x301, 0x345, 0x3B1,
+    0x313, 0x342, 0x345, 0x3B1, 0x314, 0x342, 0x345, 0x391,
+    0x313, 0x345, 0x391, 0x314, 0x345, 0x391, 0x313, 0x300,
+    0x345, 0x391, 0x314, 0x300, 0x345, 0x391, 0x313, 0x301,
+    0x345, 0x391, 0x314, 0x301, 0x345, 0x391, 0x313, 0x342,
+    0x345, 0x391, 0x314, 0x342, 0x345, 0x3B7, 0x313, 0x345,
+    0x3B7, 0x314, 0x345, 0x3B7, 0x313, 0x300, 0x345, 0x3B7,
+    0x314, 0x300, 0x345, 0x3B7, 0x313, 0x301, 0x345, 0x3B7,
+    0x314, 0x301, 0x345, 0x3B7, 0x313, 0x342, 0x345, 0x3B7,
+    0x314, 0x342, 0x345, 0x397, 0x313, 0x345, 0x397, 0x314,
+    0x345, 0x397, 0x313, 0x300, 0x345, 0x397, 0x314, 0x300,
+    0x345, 0x397, 0x313, 0x301, 0x345, 0x397, 0x314, 0x301,
+    0x345, 0x397, 0x313, 0x342, 0x345, 0x397, 0x314, 0x342,
+    0x345, 0x3C9, 0x313, 0x345, 0x3C9, 0x314, 0x345, 0x3C9,
+    0x313, 0x300, 0x345, 0x3C9, 0x314, 0x300, 0x345, 0x3C9,
+    0x313, 0x301, 0x345, 0x3C9, 0x314, 0x301, 0x345, 0x3C9,
+    0x313, 0x342, 0x345, 0x3C9, 0x314, 0x342, 0x345, 0x3A9,
+    0x313, 0x345, 0x3A9, 0x314, 0x345, 0x3A9, 0x313, 0x300,
+    0x345, 0x3A9, 0x314, 0x300, 0x345, 0x3A9, 0x313, 0x301,
+    0x345, 0x3A9, 0x314, 0x301, 0x345, 0x3A9, 0x313, 0x342,
+    0x345, 0x3A9, 0x314, 0x342, 0x345, 0x3B1, 0x306, 0x3B1,
+    0x304, 0x3B1, 0x300, 0x345, 0x3B1, 0x345, 0x3B1, 0x301,
+    0x345, 0x3B1, 0x342, 0x3B1, 0x342, 0x345, 0x391, 0x306,
+    0x391, 0x304, 0x391, 0x300, 0x391, 0x301, 0x391, 0x345,
+    0x3B9, 0x3B7, 0x300, 0x345, 0x3B7, 0x345, 0x3B7, 0x301,
+    0x345, 0x3B7, 0x342, 0x3B7, 0x342, 0x345, 0x395, 0x300,
+    0x395, 0x301, 0x397, 0x300, 0x397, 0x301, 0x397, 0x345,
+    0x3B9, 0x306, 0x3B9, 0x304, 0x3B9, 0x308, 0x300, 0x3B9,
+    0x308, 0x301, 0x3B9, 0x342, 0x3B9, 0x308, 0x342, 0x399,
+    0x306, 0x399, 0x304, 0x399, 0x300, 0x399, 0x301, 0x3C5,
+    0x306, 0x3C5, 0x304, 0x3C5, 0x308, 0x300, 0x3C5, 0x308,
+    0x301, 0x3C1, 0x313, 0x3C1, 0x314, 0x3C5, 0x342, 0x3C5,
+    0x308, 0x342, 0x3A5, 0x306, 0x3A5, 0x304, 0x3A5, 0x300,
+    0x3A5, 0x301, 0x3A1, 0x314, 0x3C9, 0x300, 0x345, 0x3C9,
+    0x345, 0x3C9, 0x301, 0x345, 0x3C9, 0x342, 0x3C9, 0x342,
+    0x345, 0x39F, 0x300, 0x39F, 0x301, 0x3A9, 0x300, 0x3A9,
+    0x301, 0x3A9, 0x345, 0x69, 0x6E, 0x61, 0x65, 0x6F,
+    0x78, 0x259, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
+    0x73, 0x74, 0x43, 0x190, 0x67, 0x48, 0x48, 0x48,
+    0x68, 0x127, 0x49, 0x49, 0x4C, 0x6C, 0x4E, 0x50,
+    0x51, 0x52, 0x52, 0x52, 0x5A, 0x3A9, 0x5A, 0x4B,
+    0x41, 0x30A, 0x42, 0x43, 0x65, 0x45, 0x46, 0x4D,
+    0x6F, 0x5D0, 0x5D1, 0x5D2, 0x5D3, 0x69, 0x3C0, 0x3B3,
+    0x393, 0x3A0, 0x44, 0x64, 0x65, 0x69, 0x6A, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x56, 0x56,
+    0x56, 0x49, 0x56, 0x49, 0x49, 0x56, 0x49, 0x49,
+    0x49, 0x49, 0x58, 0x58, 0x58, 0x49, 0x58, 0x49,
+    0x49, 0x4C, 0x43, 0x44, 0x4D, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x76, 0x69,
+    0x76, 0x69, 0x69, 0x76, 0x69, 0x69, 0x69, 0x69,
+    0x78, 0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x6C,
+    0x63, 0x64, 0x6D, 0x6A, 0x56, 0x2D61, 0x5341, 0x5344,
+    0x5345, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099, 0x3051,
+    0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059,
+    0x3099, 0x305B, 0x3099, 0x305D, 0x3099, 0x305F, 0x3099, 0x3061,
+    0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306F,
+    0x3099, 0x306F, 0x309A, 0x3072, 0x3099, 0x3072, 0x309A, 0x3075,
+    0x3099, 0x3075, 0x309A, 0x3078, 0x3099, 0x3078, 0x309A, 0x307B,
+    0x3099, 0x307B, 0x309A, 0x3046, 0x3099, 0x309D, 0x3099, 0x3088,
+    0x308A, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1,
+    0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7, 0x3099, 0x30B9,
+    0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1,
+    0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF,
+    0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5,
+    0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB,
+    0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099, 0x30F0,
+    0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099, 0x30B3,
+    0x30C8, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103,
+    0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5,
+    0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B,
+    0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161,
+    0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169,
+    0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171,
+    0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11C7,
+    0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD,
+    0x11DF, 0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129,
+    0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140,
+    0x1147, 0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159, 0x1184,
+    0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1, 0x44A,
+    0x44C, 0xA76F, 0x43, 0x46, 0x51, 0x126, 0x153, 0xA727,
+    0xAB37, 0x26B, 0xAB52, 0x28D, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8,
+    0x6ED1, 0x4E32, 0x53E5, 0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587,
+    0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F,
+    0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82,
+    0x5375, 0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD,
+    0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC,
+    0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7,
+    0x8001, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C,
+    0x797F, 0x7DA0, 0x83C9, 0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04,
+    0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62,
+    0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B,
+    0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF,
+    0x6A02, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317,
+    0x78FB, 0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3,
+    0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE,
+    0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7,
+    0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5,
+    0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6,
+    0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149,
+    0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A,
+    0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5,
+    0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA,
+    0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748,
+    0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA,
+    0x5BEE, 0x5C3F, 0x6599, 0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C,
+    0x9F8D, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C,
+    0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x516D, 0x622E, 0x9678,
+    0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387,
+    0x9686, 0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5,
+    0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F,
+    0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F,
+    0x6797, 0x6DCB, 0x81E8, 0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099,
+    0x8B58, 0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6,
+    0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3,
+    0x5140, 0x55C0, 0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C,
+    0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8,
+    0x9038, 0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7,
+    0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606,
+    0x5668, 0x5840, 0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E,
+    0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22,
+    0x716E, 0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948, 0x7950,
+    0x7956, 0x795D, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4,
+    0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8279, 0x8457,
+    0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038,
+    0x96E3, 0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5,
+    0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555,
+    0x5599, 0x55E2, 0x585A, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28,
+    0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E,
+    0x6160, 0x61F2, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x6674,
+    0x6717, 0x671B, 0x6756, 0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB,
+    0x6F22, 0x701E, 0x716E, 0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471,
+    0x7506, 0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A,
+    0x7740, 0x78CC, 0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E,
+    0x8005, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF,
+    0x8AF8, 0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08,
+    0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB,
+    0x97FF, 0x980B, 0x983B, 0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5,
+    0x3B9D, 0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E,
+    0x66, 0x66, 0x66, 0x69, 0x66, 0x6C, 0x66, 0x66,
+    0x69, 0x66, 0x66, 0x6C, 0x73, 0x74, 0x73, 0x74,
+    0x574, 0x576, 0x574, 0x565, 0x574, 0x56B, 0x57E, 0x576,
+    0x574, 0x56D, 0x5D9, 0x5B4, 0x5F2, 0x5B7, 0x5E2, 0x5D0,
+    0x5D3, 0x5D4, 0x5DB, 0x5DC, 0x5DD, 0x5E8, 0x5EA, 0x5E9,
+    0x5C1, 0x5E9, 0x5C2, 0x5E9, 0x5BC, 0x5C1, 0x5E9, 0x5BC,
+    0x5C2, 0x5D0, 0x5B7, 0x5D0, 0x5B8, 0x5D0, 0x5BC, 0x5D1,
+    0x5BC, 0x5D2, 0x5BC, 0x5D3, 0x5BC, 0x5D4, 0x5BC, 0x5D5,
+    0x5BC, 0x5D6, 0x5BC, 0x5D8, 0x5BC, 0x5D9, 0x5BC, 0x5DA,
+    0x5BC, 0x5DB, 0x5BC, 0x5DC, 0x5BC, 0x5DE, 0x5BC, 0x5E0,
+    0x5BC, 0x5E1, 0x5BC, 0x5E3, 0x5BC, 0x5E4, 0x5BC, 0x5E6,
+    0x5BC, 0x5E7, 0x5BC, 0x5E8, 0x5BC, 0x5E9, 0x5BC, 0x5EA,
+    0x5BC, 0x5D5, 0x5B9, 0x5D1, 0x5BF, 0x5DB, 0x5BF, 0x5E4,
+    0x5BF, 0x5D0, 0x5DC, 0x671, 0x671, 0x67B, 0x67B, 0x67B,
+    0x67B, 0x67E, 0x67E, 0x67E, 0x67E, 0x680, 0x680, 0x680,
+    0x680, 0x67A, 0x67A, 0x67A, 0x67A, 0x67F, 0x67F, 0x67F,
+    0x67F, 0x679, 0x679, 0x679, 0x679, 0x6A4, 0x6A4, 0x6A4,
+    0x6A4, 0x6A6, 0x6A6, 0x6A6, 0x6A6, 0x684, 0x684, 0x684,
+    0x684, 0x683, 0x683, 0x683, 0x683, 0x686, 0x686, 0x686,
+    0x686, 0x687, 0x687, 0x687, 0x687, 0x68D, 0x68D, 0x68C,
+    0x68C, 0x68E, 0x68E, 0x688, 0x688, 0x698, 0x698, 0x691,
+    0x691, 0x6A9, 0x6A9, 0x6A9, 0x6A9, 0x6AF, 0x6AF, 0x6AF,
+    0x6AF, 0x6B3, 0x6B3, 0x6B3, 0x6B3, 0x6B1, 0x6B1, 0x6B1,
+    0x6B1, 0x6BA, 0x6BA, 0x6BB, 0x6BB, 0x6BB, 0x6BB, 0x6D5,
+    0x654, 0x6D5, 0x654, 0x6C1, 0x6C1, 0x6C1, 0x6C1, 0x6BE,
+    0x6BE, 0x6BE, 0x6BE, 0x6D2, 0x6D2, 0x6D2, 0x654, 0x6D2,
+    0x654, 0x6AD, 0x6AD, 0x6AD, 0x6AD, 0x6C7, 0x6C7, 0x6C6,
+    0x6C6, 0x6C8, 0x6C8, 0x6C7, 0x674, 0x6CB, 0x6CB, 0x6C5,
+    0x6C5, 0x6C9, 0x6C9, 0x6D0, 0x6D0, 0x6D0, 0x6D0, 0x649,
+    0x649, 0x64A, 0x654, 0x627, 0x64A, 0x654, 0x627, 0x64A,
+    0x654, 0x6D5, 0x64A, 0x654, 0x6D5, 0x64A, 0x654, 0x648,
+    0x64A, 0x654, 0x648, 0x64A, 0x654, 0x6C7, 0x64A, 0x654,
+    0x6C7, 0x64A, 0x654, 0x6C6, 0x64A, 0x654, 0x6C6, 0x64A,
+    0x654, 0x6C8, 0x64A, 0x654, 0x6C8, 0x64A, 0x654, 0x6D0,
+    0x64A, 0x654, 0x6D0, 0x64A, 0x654, 0x6D0, 0x64A, 0x654,
+    0x649, 0x64A, 0x654, 0x649, 0x64A, 0x654, 0x649, 0x6CC,
+    0x6CC, 0x6CC, 0x6CC, 0x64A, 0x654, 0x62C, 0x64A, 0x654,
+    0x62D, 0x64A, 0x654, 0x645, 0x64A, 0x654, 0x649, 0x64A,
+    0x654, 0x64A, 0x628, 0x62C, 0x628, 0x62D, 0x628, 0x62E,
+    0x628, 0x645, 0x628, 0x649, 0x628, 0x64A, 0x62A, 0x62C,
+    0x62A, 0x62D, 0x62A, 0x62E, 0x62A, 0x645, 0x62A, 0x649,
+    0x62A, 0x64A, 0x62B, 0x62C, 0x62B, 0x645, 0x62B, 0x649,
+    0x62B, 0x64A, 0x62C, 0x62D, 0x62C, 0x645, 0x62D, 0x62C,
+    0x62D, 0x645, 0x62E, 0x62C, 0x62E, 0x62D, 0x62E, 0x645,
+    0x633, 0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x633, 0x645,
+    0x635, 0x62D, 0x635, 0x645, 0x636, 0x62C, 0x636, 0x62D,
+    0x636, 0x62E, 0x636, 0x645, 0x637, 0x62D, 0x637, 0x645,
+    0x638, 0x645, 0x639, 0x62C, 0x639, 0x645, 0x63A, 0x62C,
+    0x63A, 0x645, 0x641, 0x62C, 0x641, 0x62D, 0x641, 0x62E,
+    0x641, 0x645, 0x641, 0x649, 0x641, 0x64A, 0x642, 0x62D,
+    0x642, 0x645, 0x642, 0x649, 0x642, 0x64A, 0x643, 0x627,
+    0x643, 0x62C, 0x643, 0x62D, 0x643, 0x62E, 0x643, 0x644,
+    0x643, 0x645, 0x643, 0x649, 0x643, 0x64A, 0x644, 0x62C,
+    0x644, 0x62D, 0x644, 0x62E, 0x644, 0x645, 0x644, 0x649,
+    0x644, 0x64A, 0x645, 0x62C, 0x645, 0x62D, 0x645, 0x62E,
+    0x645, 0x645, 0x645, 0x649, 0x645, 0x64A, 0x646, 0x62C,
+    0x646, 0x62D, 0x646, 0x62E, 0x646, 0x645, 0x646, 0x649,
+    0x646, 0x64A, 0x647, 0x62C, 0x647, 0x645, 0x647, 0x649,
+    0x647, 0x64A, 0x64A, 0x62C, 0x64A, 0x62D, 0x64A, 0x62E,
+    0x64A, 0x645, 0x64A, 0x649, 0x64A, 0x64A, 0x630, 0x670,
+    0x631, 0x670, 0x649, 0x670, 0x64A, 0x654, 0x631, 0x64A,
+    0x654, 0x632, 0x64A, 0x654, 0x645, 0x64A, 0x654, 0x646,
+    0x64A, 0x654, 0x649, 0x64A, 0x654, 0x64A, 0x628, 0x631,
+    0x628, 0x632, 0x628, 0x645, 0x628, 0x646, 0x628, 0x649,
+    0x628, 0x64A, 0x62A, 0x631, 0x62A, 0x632, 0x62A, 0x645,
+    0x62A, 0x646, 0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x631,
+    0x62B, 0x632, 0x62B, 0x645, 0x62B, 0x646, 0x62B, 0x649,
+    0x62B, 0x64A, 0x641, 0x649, 0x641, 0x64A, 0x642, 0x649,
+    0x642, 0x64A, 0x643, 0x627, 0x643, 0x644, 0x643, 0x645,
+    0x643, 0x649, 0x643, 0x64A, 0x644, 0x645, 0x644, 0x649,
+    0x644, 0x64A, 0x645, 0x627, 0x645, 0x645, 0x646, 0x631,
+    0x646, 0x632, 0x646, 0x645, 0x646, 0x646, 0x646, 0x649,
+    0x646, 0x64A, 0x649, 0x670, 0x64A, 0x631, 0x64A, 0x632,
+    0x64A, 0x645, 0x64A, 0x646, 0x64A, 0x649, 0x64A, 0x64A,
+    0x64A, 0x654, 0x62C, 0x64A, 0x654, 0x62D, 0x64A, 0x654,
+    0x62E, 0x64A, 0x654, 0x645, 0x64A, 0x654, 0x647, 0x628,
+    0x62C, 0x628, 0x62D, 0x628, 0x62E, 0x628, 0x645, 0x628,
+    0x647, 0x62A, 0x62C, 0x62A, 0x62D, 0x62A, 0x62E, 0x62A,
+    0x645, 0x62A, 0x647, 0x62B, 0x645, 0x62C, 0x62D, 0x62C,
+    0x645, 0x62D, 0x62C, 0x62D, 0x645, 0x62E, 0x62C, 0x62E,
+    0x645, 0x633, 0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x633,
+    0x645, 0x635, 0x62D, 0x635, 0x62E, 0x635, 0x645, 0x636,
+    0x62C, 0x636, 0x62D, 0x636, 0x62E, 0x636, 0x645, 0x637,
+    0x62D, 0x638, 0x645, 0x639, 0x62C, 0x639, 0x645, 0x63A,
+    0x62C, 0x63A, 0x645, 0x641, 0x62C, 0x641, 0x62D, 0x641,
+    0x62E, 0x641, 0x645, 0x642, 0x62D, 0x642, 0x645, 0x643,
+    0x62C, 0x643, 0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643,
+    0x645, 0x644, 0x62C, 0x644, 0x62D, 0x644, 0x62E, 0x644,
+    0x645, 0x644, 0x647, 0x645, 0x62C, 0x645, 0x62D, 0x645,
+    0x62E, 0x645, 0x645, 0x646, 0x62C, 0x646, 0x62D, 0x646,
+    0x62E, 0x646, 0x645, 0x646, 0x647, 0x647, 0x62C, 0x647,
+    0x645, 0x647, 0x670, 0x64A, 0x62C, 0x64A, 0x62D, 0x64A,
+    0x62E, 0x64A, 0x645, 0x64A, 0x647, 0x64A, 0x654, 0x645,
+    0x64A, 0x654, 0x647, 0x628, 0x645, 0x628, 0x647, 0x62A,
+    0x645, 0x62A, 0x647, 0x62B, 0x645, 0x62B, 0x647, 0x633,
+    0x645, 0x633, 0x647, 0x634, 0x645, 0x634, 0x647, 0x643,
+    0x644, 0x643, 0x645, 0x644, 0x645, 0x646, 0x645, 0x646,
+    0x647, 0x64A, 0x645, 0x64A, 0x647, 0x640, 0x64E, 0x651,
+    0x640, 0x64F, 0x651, 0x640, 0x650, 0x651, 0x637, 0x649,
+    0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649,
+    0x63A, 0x64A, 0x633, 0x649, 0x633, 0x64A, 0x634, 0x649,
+    0x634, 0x64A, 0x62D, 0x649, 0x62D, 0x64A, 0x62C, 0x649,
+    0x62C, 0x64A, 0x62E, 0x649, 0x62E, 0x64A, 0x635, 0x649,
+    0x635, 0x64A, 0x636, 0x649, 0x636, 0x64A, 0x634, 0x62C,
+    0x634, 0x62D, 0x634, 0x62E, 0x634, 0x645, 0x634, 0x631,
+    0x633, 0x631, 0x635, 0x631, 0x636, 0x631, 0x637, 0x649,
+    0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649,
+    0x63A, 0x64A, 0x633, 0x649, 0x633, 0x64A, 0x634, 0x649,
+    0x634, 0x64A, 0x62D, 0x649, 0x62D, 0x64A, 0x62C, 0x649,
+    0x62C, 0x64A, 0x62E, 0x649, 0x62E, 0x64A, 0x635, 0x649,
+    0x635, 0x64A, 0x636, 0x649, 0x636, 0x64A, 0x634, 0x62C,
+    0x634, 0x62D, 0x634, 0x62E, 0x634, 0x645, 0x634, 0x631,
+    0x633, 0x631, 0x635, 0x631, 0x636, 0x631, 0x634, 0x62C,
+    0x634, 0x62D, 0x634, 0x62E, 0x634, 0x645, 0x633, 0x647,
+    0x634, 0x647, 0x637, 0x645, 0x633, 0x62C, 0x633, 0x62D,
+    0x633, 0x62E, 0x634, 0x62C, 0x634, 0x62D, 0x634, 0x62E,
+    0x637, 0x645, 0x638, 0x645, 0x627, 0x64B, 0x627, 0x64B,
+    0x62A, 0x62C, 0x645, 0x62A, 0x62D, 0x62C, 0x62A, 0x62D,
+    0x62C, 0x62A, 0x62D, 0x645, 0x62A, 0x62E, 0x645, 0x62A,
+    0x645, 0x62C, 0x62A, 0x645, 0x62D, 0x62A, 0x645, 0x62E,
+    0x62C, 0x645, 0x62D, 0x62C, 0x645, 0x62D, 0x62D, 0x645,
+    0x64A, 0x62D, 0x645, 0x649, 0x633, 0x62D, 0x62C, 0x633,
+    0x62C, 0x62D, 0x633, 0x62C, 0x649, 0x633, 0x645, 0x62D,
+    0x633, 0x645, 0x62D, 0x633, 0x645, 0x62C, 0x633, 0x645,
+    0x645, 0x633, 0x645, 0x645, 0x635, 0x62D, 0x62D, 0x635,
+    0x62D, 0x62D, 0x635, 0x645, 0x645, 0x634, 0x62D, 0x645,
+    0x634, 0x62D, 0x645, 0x634, 0x62C, 0x64A, 0x634, 0x645,
+    0x62E, 0x634, 0x645, 0x62E, 0x634, 0x645, 0x645, 0x634,
+    0x645, 0x645, 0x636, 0x62D, 0x649, 0x636, 0x62E, 0x645,
+    0x636, 0x62E, 0x645, 0x637, 0x645, 0x62D, 0x637, 0x645,
+    0x62D, 0x637, 0x645, 0x645, 0x637, 0x645, 0x64A, 0x639,
+    0x62C, 0x645, 0x639, 0x645, 0x645, 0x639, 0x645, 0x645,
+    0x639, 0x645, 0x649, 0x63A, 0x645, 0x645, 0x63A, 0x645,
+    0x64A, 0x63A, 0x645, 0x649, 0x641, 0x62E, 0x645, 0x641,
+    0x62E, 0x645, 0x642, 0x645, 0x62D, 0x642, 0x645, 0x645,
+    0x644, 0x62D, 0x645, 0x644, 0x62D, 0x64A, 0x644, 0x62D,
+    0x649, 0x644, 0x62C, 0x62C, 0x644, 0x62C, 0x62C, 0x644,
+    0x62E, 0x645, 0x644, 0x62E, 0x645, 0x644, 0x645, 0x62D,
+    0x644, 0x645, 0x62D, 0x645, 0x62D, 0x62C, 0x645, 0x62D,
+    0x645, 0x645, 0x62D, 0x64A, 0x645, 0x62C, 0x62D, 0x645,
+    0x62C, 0x645, 0x645, 0x62E, 0x62C, 0x645, 0x62E, 0x645,
+    0x645, 0x62C, 0x62E, 0x647, 0x645, 0x62C, 0x647, 0x645,
+    0x645, 0x646, 0x62D, 0x645, 0x646, 0x62D, 0x649, 0x646,
+    0x62C, 0x645, 0x646, 0x62C, 0x645, 0x646, 0x62C, 0x649,
+    0x646, 0x645, 0x64A, 0x646, 0x645, 0x649, 0x64A, 0x645,
+    0x645, 0x64A, 0x645, 0x645, 0x628, 0x62E, 0x64A, 0x62A,
+    0x62C, 0x64A, 0x62A, 0x62C, 0x649, 0x62A, 0x62E, 0x64A,
+    0x62A, 0x62E, 0x649, 0x62A, 0x645, 0x64A, 0x62A, 0x645,
+    0x649, 0x62C, 0x645, 0x64A, 0x62C, 0x62D, 0x649, 0x62C,
+    0x645, 0x649, 0x633, 0x62E, 0x649, 0x635, 0x62D, 0x64A,
+    0x634, 0x62D, 0x64A, 0x636, 0x62D, 0x64A, 0x644, 0x62C,
+    0x64A, 0x644, 0x645, 0x64A, 0x64A, 0x62D, 0x64A, 0x64A,
+    0x62C, 0x64A, 0x64A, 0x645, 0x64A, 0x645, 0x645, 0x64A,
+    0x642, 0x645, 0x64A, 0x646, 0x62D, 0x64A, 0x642, 0x645,
+    0x62D, 0x644, 0x62D, 0x645, 0x639, 0x645, 0x64A, 0x643,
+    0x645, 0x64A, 0x646, 0x62C, 0x62D, 0x645, 0x62E, 0x64A,
+    0x644, 0x62C, 0x645, 0x643, 0x645, 0x645, 0x644, 0x62C,
+    0x645, 0x646, 0x62C, 0x62D, 0x62C, 0x62D, 0x64A, 0x62D,
+    0x62C, 0x64A, 0x645, 0x62C, 0x64A, 0x641, 0x645, 0x64A,
+    0x628, 0x62D, 0x64A, 0x643, 0x645, 0x645, 0x639, 0x62C,
+    0x645, 0x635, 0x645, 0x645, 0x633, 0x62E, 0x64A, 0x646,
+    0x62C, 0x64A, 0x635, 0x644, 0x6D2, 0x642, 0x644, 0x6D2,
+    0x627, 0x644, 0x644, 0x647, 0x627, 0x643, 0x628, 0x631,
+    0x645, 0x62D, 0x645, 0x62F, 0x635, 0x644, 0x639, 0x645,
+    0x631, 0x633, 0x648, 0x644, 0x639, 0x644, 0x64A, 0x647,
+    0x648, 0x633, 0x644, 0x645, 0x635, 0x644, 0x649, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x640, 0x64B, 0x640, 0x64E,
+    0x640, 0x64F, 0x640, 0x650, 0x640, 0x651, 0x640, 0x652,
+    0x621, 0x627, 0x653, 0x627, 0x653, 0x627, 0x654, 0x627,
+    0x654, 0x648, 0x654, 0x648, 0x654, 0x627, 0x655, 0x627,
+    0x655, 0x64A, 0x654, 0x64A, 0x654, 0x64A, 0x654, 0x64A,
+    0x654, 0x627, 0x627, 0x628, 0x628, 0x628, 0x628, 0x629,
+    0x629, 0x62A, 0x62A, 0x62A, 0x62A, 0x62B, 0x62B, 0x62B,
+    0x62B, 0x62C, 0x62C, 0x62C, 0x62C, 0x62D, 0x62D, 0x62D,
+    0x62D, 0x62E, 0x62E, 0x62E, 0x62E, 0x62F, 0x62F, 0x630,
+    0x630, 0x631, 0x631, 0x632, 0x632, 0x633, 0x633, 0x633,
+    0x633, 0x634, 0x634, 0x634, 0x634, 0x635, 0x635, 0x635,
+    0x635, 0x636, 0x636, 0x636, 0x636, 0x637, 0x637, 0x637,
+    0x637, 0x638, 0x638, 0x638, 0x638, 0x639, 0x639, 0x639,
+    0x639, 0x63A, 0x63A, 0x63A, 0x63A, 0x641, 0x641, 0x641,
+    0x641, 0x642, 0x642, 0x642, 0x642, 0x643, 0x643, 0x643,
+    0x643, 0x644, 0x644, 0x644, 0x644, 0x645, 0x645, 0x645,
+    0x645, 0x646, 0x646, 0x646, 0x646, 0x647, 0x647, 0x647,
+    0x647, 0x648, 0x648, 0x649, 0x649, 0x64A, 0x64A, 0x64A,
+    0x64A, 0x644, 0x627, 0x653, 0x644, 0x627, 0x653, 0x644,
+    0x627, 0x654, 0x644, 0x627, 0x654, 0x644, 0x627, 0x655,
+    0x644, 0x627, 0x655, 0x644, 0x627, 0x644, 0x627, 0x30,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x5F, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x30F2, 0x30A1,
+    0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3,
+    0x30FC, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD,
+    0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD,
+    0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC,
+    0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE,
+    0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9,
+    0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x3099, 0x309A,
+    0x1160, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103,
+    0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5,
+    0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B,
+    0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161,
+    0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169,
+    0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171,
+    0x1172, 0x1173, 0x1174, 0x1175, 0x2D0, 0x2D1, 0xE6, 0x299,
+    0x253, 0x2A3, 0xAB66, 0x2A5, 0x2A4, 0x256, 0x257, 0x1D91,
+    0x258, 0x25E, 0x2A9, 0x264, 0x262, 0x260, 0x29B, 0x127,
+    0x29C, 0x267, 0x284, 0x2AA, 0x2AB, 0x26C, 0x1DF04, 0xA78E,
+    0x26E, 0x1DF05, 0x28E, 0x1DF06, 0xF8, 0x276, 0x277, 0x71,
+    0x27A, 0x1DF08, 0x27D, 0x27E, 0x280, 0x2A8, 0x2A6, 0xAB67,
+    0x2A7, 0x288, 0x2C71, 0x28F, 0x2A1, 0x2A2, 0x298, 0x1C0,
+    0x1C1, 0x1C2, 0x1DF0A, 0x1DF1E, 0x11099, 0x110BA, 0x1109B, 0x110BA,
+    0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E,
+    0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD,
+    0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A,
+    0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+    0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x41, 0x43, 0x44, 0x47, 0x4A, 0x4B, 0x4E,
+    0x4F, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x66,
+    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+    0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42,
+    0x44, 0x45, 0x46, 0x47, 0x4A, 0x4B, 0x4C, 0x4D,
+    0x4E, 0x4F, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x44,
+    0x45, 0x46, 0x47, 0x49, 0x4A, 0x4B, 0x4C, 0x4D,
+    0x4F, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+    0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A,
+    0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+    0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A,
+    0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+    0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A,
+    0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x131, 0x237, 0x391, 0x392, 0x393, 0x394,
+    0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C,
+    0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4,
+    0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x3B1, 0x3B2, 0x3B3,
+    0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB,
+    0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3,
+    0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x3B5, 0x3B8,
+    0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x391, 0x392, 0x393, 0x394,
+    0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C,
+    0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4,
+    0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x3B1, 0x3B2, 0x3B3,
+    0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB,
+    0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3,
+    0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x3B5, 0x3B8,
+    0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x391, 0x392, 0x393, 0x394,
+    0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C,
+    0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4,
+    0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x3B1, 0x3B2, 0x3B3,
+    0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB,
+    0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3,
+    0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x3B5, 0x3B8,
+    0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x391, 0x392, 0x393, 0x394,
+    0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C,
+    0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4,
+    0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x3B1, 0x3B2, 0x3B3,
+    0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB,
+    0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3,
+    0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x3B5, 0x3B8,
+    0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x391, 0x392, 0x393, 0x394,
+    0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C,
+    0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4,
+    0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x3B1, 0x3B2, 0x3B3,
+    0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB,
+    0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3,
+    0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x3B5, 0x3B8,
+    0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x3DC, 0x3DD, 0x30, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x627, 0x628, 0x62C, 0x62F, 0x648, 0x632, 0x62D, 0x637,
+    0x64A, 0x643, 0x644, 0x645, 0x646, 0x633, 0x639, 0x641,
+    0x635, 0x642, 0x631, 0x634, 0x62A, 0x62B, 0x62E, 0x630,
+    0x636, 0x638, 0x63A, 0x66E, 0x6BA, 0x6A1, 0x66F, 0x628,
+    0x62C, 0x647, 0x62D, 0x64A, 0x643, 0x644, 0x645, 0x646,
+    0x633, 0x639, 0x641, 0x635, 0x642, 0x634, 0x62A, 0x62B,
+    0x62E, 0x636, 0x63A, 0x62C, 0x62D, 0x64A, 0x644, 0x646,
+    0x633, 0x639, 0x635, 0x642, 0x634, 0x62E, 0x636, 0x63A,
+    0x6BA, 0x66F, 0x628, 0x62C, 0x647, 0x62D, 0x637, 0x64A,
+    0x643, 0x645, 0x646, 0x633, 0x639, 0x641, 0x635, 0x642,
+    0x634, 0x62A, 0x62B, 0x62E, 0x636, 0x638, 0x63A, 0x66E,
+    0x6A1, 0x627, 0x628, 0x62C, 0x62F, 0x647, 0x648, 0x632,
+    0x62D, 0x637, 0x64A, 0x644, 0x645, 0x646, 0x633, 0x639,
+    0x641, 0x635, 0x642, 0x631, 0x634, 0x62A, 0x62B, 0x62E,
+    0x630, 0x636, 0x638, 0x63A, 0x628, 0x62C, 0x62F, 0x648,
+    0x632, 0x62D, 0x637, 0x64A, 0x644, 0x645, 0x646, 0x633,
+    0x639, 0x641, 0x635, 0x642, 0x631, 0x634, 0x62A, 0x62B,
+    0x62E, 0x630, 0x636, 0x638, 0x63A, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x4E3D,
+    0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE, 0x4FBB, 0x5002, 0x507A,
+    0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154, 0x5164,
+    0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D, 0x2054B, 0x5197, 0x51A4,
+    0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5, 0x5203, 0x34DF, 0x523B,
+    0x5246, 0x5272, 0x5277, 0x3515, 0x52C7, 0x52C9, 0x52E4, 0x52FA,
+    0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A, 0x5373, 0x537D,
+    0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF, 0x20B63,
+    0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468, 0x54A2,
+    0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55AB,
+    0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674, 0x5207,
+    0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831, 0x58AC,
+    0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922, 0x5962, 0x216A8,
+    0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE, 0x36FC,
+    0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7, 0x5BF3,
+    0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781, 0x5C60, 0x5C6E,
+    0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B, 0x5D7C,
+    0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69, 0x3862,
+    0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA, 0x2A392, 0x5EFE,
+    0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22, 0x38C7, 0x232B8, 0x261DA,
+    0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9, 0x6081,
+    0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148, 0x614C, 0x614E,
+    0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF, 0x61DE, 0x61F2,
+    0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350, 0x22B0C,
+    0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1, 0x6422, 0x63C5,
+    0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C, 0x654F,
+    0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691, 0x3B08,
+    0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9, 0x6717,
+    0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA, 0x6785,
+    0x6852, 0x6885, 0x2346D, 0x688E, 0x681F, 0x6914, 0x3B9D, 0x6942,
+    0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21, 0x238A7,
+    0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA, 0x6BBB, 0x23A8D, 0x21D0B,
+    0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E,
+    0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34, 0x6E2F,
+    0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E, 0x23F5E,
+    0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96, 0x704A, 0x707D,
+    0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C, 0x243AB, 0x7228,
+    0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814, 0x737A,
+    0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C, 0x7471,
+    0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E, 0x24C92, 0x7570,
+    0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008, 0x76F4,
+    0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x771F, 0x774A,
+    0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x788C, 0x78CC,
+    0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5, 0x798F, 0x79EB, 0x412F,
+    0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE, 0x4202,
+    0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2, 0x42A0, 0x7CE8,
+    0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45,
+    0x4334, 0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E, 0x7F95,
+    0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8, 0x8070, 0x2335F,
+    0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5, 0x267A7, 0x267B5,
+    0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B,
+    0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C, 0x82E5,
+    0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457, 0x8353,
+    0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B, 0x84F1,
+    0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561, 0x26FB1,
+    0x270D2, 0x456B, 0x8650, 0x865C, 0x8667, 0x8669, 0x86A9, 0x8688,
+    0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7, 0x87E1,
+    0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7, 0x88DE, 0x4635,
+    0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0, 0x8AED,
+    0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x27F2F,
+    0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38, 0x285D2,
+    0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238, 0x92D7,
+    0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995, 0x95B7,
+    0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A, 0x4A6E,
+    0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496, 0x980B, 0x980B, 0x9829,
+    0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE,
+    0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67, 0x2A0CE,
+    0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB, 0x4D56, 0x9EF9, 0x9EFE,
+    0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+};
+
+constexpr Composition kCompositions[] = {
+    {0x3C, 0x338, 0x226E}, {0x3D, 0x338, 0x2260},
+    {0x3E, 0x338, 0x226F}, {0x41, 0x300, 0xC0},
+    {0x41, 0x301, 0xC1}, {0x41, 0x302, 0xC2},
+    {0x41, 0x303, 0xC3}, {0x41, 0x304, 0x100},
+    {0x41, 0x306, 0x102}, {0x41, 0x307, 0x226},
+    {0x41, 0x308, 0xC4}, {0x41, 0x309, 0x1EA2},
+    {0x41, 0x30A, 0xC5}, {0x41, 0x30C, 0x1CD},
+    {0x41, 0x30F, 0x200}, {0x41, 0x311, 0x202},
+    {0x41, 0x323, 0x1EA0}, {0x41, 0x325, 0x1E00},
+    {0x41, 0x328, 0x104}, {0x42, 0x307, 0x1E02},
+    {0x42, 0x323, 0x1E04}, {0x42, 0x331, 0x1E06},
+    {0x43, 0x301, 0x106}, {0x43, 0x302, 0x108},
+    {0x43, 0x307, 0x10A}, {0x43, 0x30C, 0x10C},
+    {0x43, 0x327, 0xC7}, {0x44, 0x307, 0x1E0A},
+    {0x44, 0x30C, 0x10E}, {0x44, 0x323, 0x1E0C},
+    {0x44, 0x327, 0x1E10}, {0x44, 0x32D, 0x1E12},
+    {0x44, 0x331, 0x1E0E}, {0x45, 0x300, 0xC8},
+    {0x45, 0x301, 0xC9}, {0x45, 0x302, 0xCA},
+    {0x45, 0x303, 0x1EBC}, {0x45, 0x304, 0x112},
+    {0x45, 0x306, 0x114}, {0x45, 0x307, 0x116},
+    {0x45, 0x308, 0xCB}, {0x45, 0x309, 0x1EBA},
+    {0x45, 0x30C, 0x11A}, {0x45, 0x30F, 0x204},
+    {0x45, 0x311, 0x206}, {0x45, 0x323, 0x1EB8},
+    {0x45, 0x327, 0x228}, {0x45, 0x328, 0x118},
+    {0x45, 0x32D, 0x1E18}, {0x45, 0x330, 0x1E1A},
+    {0x46, 0x307, 0x1E1E}, {0x47, 0x301, 0x1F4},
+    {0x47, 0x302, 0x11C}, {0x47, 0x304, 0x1E20},
+    {0x47, 0x306, 0x11E}, {0x47, 0x307, 0x120},
+    {0x47, 0x30C, 0x1E6}, {0x47, 0x327, 0x122},
+    {0x48, 0x302, 0x124}, {0x48, 0x307, 0x1E22},
+    {0x48, 0x308, 0x1E26}, {0x48, 0x30C, 0x21E},
+    {0x48, 0x323, 0x1E24}, {0x48, 0x327, 0x1E28},
+    {0x48, 0x32E, 0x1E2A}, {0x49, 0x300, 0xCC},
+    {0x49, 0x301, 0xCD}, {0x49, 0x302, 0xCE},
+    {0x49, 0x303, 0x128}, {0x49, 0x304, 0x12A},
+    {0x49, 0x306, 0x12C}, {0x49, 0x307, 0x130},
+    {0x49, 0x308, 0xCF}, {0x49, 0x309, 0x1EC8},
+    {0x49, 0x30C, 0x1CF}, {0x49, 0x30F, 0x208},
+    {0x49, 0x311, 0x20A}, {0x49, 0x323, 0x1ECA},
+    {0x49, 0x328, 0x12E}, {0x49, 0x330, 0x1E2C},
+    {0x4A, 0x302, 0x134}, {0x4B, 0x301, 0x1E30},
+    {0x4B, 0x30C, 0x1E8}, {0x4B, 0x323, 0x1E32},
+    {0x4B, 0x327, 0x136}, {0x4B, 0x331, 0x1E34},
+    {0x4C, 0x301, 0x139}, {0x4C, 0x30C, 0x13D},
+    {0x4C, 0x323, 0x1E36}, {0x4C, 0x327, 0x13B},
+    {0x4C, 0x32D, 0x1E3C}, {0x4C, 0x331, 0x1E3A},
+    {0x4D, 0x301, 0x1E3E}, {0x4D, 0x307, 0x1E40},
+    {0x4D, 0x323, 0x1E42}, {0x4E, 0x300, 0x1F8},
+    {0x4E, 0x301, 0x143}, {0x4E, 0x303, 0xD1},
+    {0x4E, 0x307, 0x1E44}, {0x4E, 0x30C, 0x147},
+    {0x4E, 0x323, 0x1E46}, {0x4E, 0x327, 0x145},
+    {0x4E, 0x32D, 0x1E4A}, {0x4E, 0x331, 0x1E48},
+    {0x4F, 0x300, 0xD2}, {0x4F, 0x301, 0xD3},
+    {0x4F, 0x302, 0xD4}, {0x4F, 0x303, 0xD5},
+    {0x4F, 0x304, 0x14C}, {0x4F, 0x306, 0x14E},
+    {0x4F, 0x307, 0x22E}, {0x4F, 0x308, 0xD6},
+    {0x4F, 0x309, 0x1ECE}, {0x4F, 0x30B, 0x150},
+    {0x4F, 0x30C, 0x1D1}, {0x4F, 0x30F, 0x20C},
+    {0x4F, 0x311, 0x20E}, {0x4F, 0x31B, 0x1A0},
+    {0x4F, 0x323, 0x1ECC}, {0x4F, 0x328, 0x1EA},
+    {0x50, 0x301, 0x1E54}, {0x50, 0x307, 0x1E56},
+    {0x52, 0x301, 0x154}, {0x52, 0x307, 0x1E58},
+    {0x52, 0x30C, 0x158}, {0x52, 0x30F, 0x210},
+    {0x52, 0x311, 0x212}, {0x52, 0x323, 0x1E5A},
+    {0x52, 0x327, 0x156}, {0x52, 0x331, 0x1E5E},
+    {0x53, 0x301, 0x15A}, {0x53, 0x302, 0x15C},
+    {0x53, 0x307, 0x1E60}, {0x53, 0x30C, 0x160},
+    {0x53, 0x323, 0x1E62}, {0x53, 0x326, 0x218},
+    {0x53, 0x327, 0x15E}, {0x54, 0x307, 0x1E6A},
+    {0x54, 0x30C, 0x164}, {0x54, 0x323, 0x1E6C},
+    {0x54, 0x326, 0x21A}, {0x54, 0x327, 0x162},
+    {0x54, 0x32D, 0x1E70}, {0x54, 0x331, 0x1E6E},
+    {0x55, 0x300, 0xD9}, {0x55, 0x301, 0xDA},
+    {0x55, 0x302, 0xDB}, {0x55, 0x303, 0x168},
+    {0x55, 0x304, 0x16A}, {0x55, 0x306, 0x16C},
+    {0x55, 0x308, 0xDC}, {0x55, 0x309, 0x1EE6},
+    {0x55, 0x30A, 0x16E}, {0x55, 0x30B, 0x170},
+    {0x55, 0x30C, 0x1D3}, {0x55, 0x30F, 0x214},
+    {0x55, 0x311, 0x216}, {0x55, 0x31B, 0x1AF},
+    {0x55, 0x323, 0x1EE4}, {0x55, 0x324, 0x1E72},
+    {0x55, 0x328, 0x172}, {0x55, 0x32D, 0x1E76},
+    {0x55, 0x330, 0x1E74}, {0x56, 0x303, 0x1E7C},
+    {0x56, 0x323, 0x1E7E}, {0x57, 0x300, 0x1E80},
+    {0x57, 0x301, 0x1E82}, {0x57, 0x302, 0x174},
+    {0x57, 0x307, 0x1E86}, {0x57, 0x308, 0x1E84},
+    {0x57, 0x323, 0x1E88}, {0x58, 0x307, 0x1E8A},
+    {0x58, 0x308, 0x1E8C}, {0x59, 0x300, 0x1EF2},
+    {0x59, 0x301, 0xDD}, {0x59, 0x302, 0x176},
+    {0x59, 0x303, 0x1EF8}, {0x59, 0x304, 0x232},
+    {0x59, 0x307, 0x1E8E}, {0x59, 0x308, 0x178},
+    {0x59, 0x309, 0x1EF6}, {0x59, 0x323, 0x1EF4},
+    {0x5A, 0x301, 0x179}, {0x5A, 0x302, 0x1E90},
+    {0x5A, 0x307, 0x17B}, {0x5A, 0x30C, 0x17D},
+    {0x5A, 0x323, 0x1E92}, {0x5A, 0x331, 0x1E94},
+    {0x61, 0x300, 0xE0}, {0x61, 0x301, 0xE1},
+    {0x61, 0x302, 0xE2}, {0x61, 0x303, 0xE3},
+    {0x61, 0x304, 0x101}, {0x61, 0x306, 0x103},
+    {0x61, 0x307, 0x227}, {0x61, 0x308, 0xE4},
+    {0x61, 0x309, 0x1EA3}, {0x61, 0x30A, 0xE5},
+    {0x61, 0x30C, 0x1CE}, {0x61, 0x30F, 0x201},
+    {0x61, 0x311, 0x203}, {0x61, 0x323, 0x1EA1},
+    {0x61, 0x325, 0x1E01}, {0x61, 0x328, 0x105},
+    {0x62, 0x307, 0x1E03}, {0x62, 0x323, 0x1E05},
+    {0x62, 0x331, 0x1E07}, {0x63, 0x301, 0x107},
+    {0x63, 0x302, 0x109}, {0x63, 0x307, 0x10B},
+    {0x63, 0x30C, 0x10D}, {0x63, 0x327, 0xE7},
+    {0x64, 0x307, 0x1E0B}, {0x64, 0x30C, 0x10F},
+    {0x64, 0x323, 0x1E0D}, {0x64, 0x327, 0x1E11},
+    {0x64, 0x32D, 0x1E13}, {0x64, 0x331, 0x1E0F},
+    {0x65, 0x300, 0xE8}, {0x65, 0x301, 0xE9},
+    {0x65, 0x302, 0xEA}, {0x65, 0x303, 0x1EBD},
+    {0x65, 0x304, 0x113}, {0x65, 0x306, 0x115},
+    {0x65, 0x307, 0x117}, {0x65, 0x308, 0xEB},
+    {0x65, 0x309, 0x1EBB}, {0x65, 0x30C, 0x11B},
+    {0x65, 0x30F, 0x205}, {0x65, 0x311, 0x207},
+    {0x65, 0x323, 0x1EB9}, {0x65, 0x327, 0x229},
+    {0x65, 0x328, 0x119}, {0x65, 0x32D, 0x1E19},
+    {0x65, 0x330, 0x1E1B}, {0x66, 0x307, 0x1E1F},
+    {0x67, 0x301, 0x1F5}, {0x67, 0x302, 0x11D},
+    {0x67, 0x304, 0x1E21}, {0x67, 0x306, 0x11F},
+    {0x67, 0x307, 0x121}, {0x67, 0x30C, 0x1E7},
+    {0x67, 0x327, 0x123}, {0x68, 0x302, 0x125},
+    {0x68, 0x307, 0x1E23}, {0x68, 0x308, 0x1E27},
+    {0x68, 0x30C, 0x21F}, {0x68, 0x323, 0x1E25},
+    {0x68, 0x327, 0x1E29}, {0x68, 0x32E, 0x1E2B},
+    {0x68, 0x331, 0x1E96}, {0x69, 0x300, 0xEC},
+    {0x69, 0x301, 0xED}, {0x69, 0x302, 0xEE},
+    {0x69, 0x303, 0x129}, {0x69, 0x304, 0x12B},
+    {0x69, 0x306, 0x12D}, {0x69, 0x308, 0xEF},
+    {0x69, 0x309, 0x1EC9}, {0x69, 0x30C, 0x1D0},
+    {0x69, 0x30F, 0x209}, {0x69, 0x311, 0x20B},
+    {0x69, 0x323, 0x1ECB}, {0x69, 0x328, 0x12F},
+    {0x69, 0x330, 0x1E2D}, {0x6A, 0x302, 0x135},
+    {0x6A, 0x30C, 0x1F0}, {0x6B, 0x301, 0x1E31},
+    {0x6B, 0x30C, 0x1E9}, {0x6B, 0x323, 0x1E33},
+    {0x6B, 0x327, 0x137}, {0x6B, 0x331, 0x1E35},
+    {0x6C, 0x301, 0x13A}, {0x6C, 0x30C, 0x13E},
+    {0x6C, 0x323, 0x1E37}, {0x6C, 0x327, 0x13C},
+    {0x6C, 0x32D, 0x1E3D}, {0x6C, 0x331, 0x1E3B},
+    {0x6D, 0x301, 0x1E3F}, {0x6D, 0x307, 0x1E41},
+    {0x6D, 0x323, 0x1E43}, {0x6E, 0x300, 0x1F9},
+    {0x6E, 0x301, 0x144}, {0x6E, 0x303, 0xF1},
+    {0x6E, 0x307, 0x1E45}, {0x6E, 0x30C, 0x148},
+    {0x6E, 0x323, 0x1E47}, {0x6E, 0x327, 0x146},
+    {0x6E, 0x32D, 0x1E4B}, {0x6E, 0x331, 0x1E49},
+    {0x6F, 0x300, 0xF2}, {0x6F, 0x301, 0xF3},
+    {0x6F, 0x302, 0xF4}, {0x6F, 0x303, 0xF5},
+    {0x6F, 0x304, 0x14D}, {0x6F, 0x306, 0x14F},
+    {0x6F, 0x307, 0x22F}, {0x6F, 0x308, 0xF6},
+    {0x6F, 0x309, 0x1ECF}, {0x6F, 0x30B, 0x151},
+    {0x6F, 0x30C, 0x1D2}, {0x6F, 0x30F, 0x20D},
+    {0x6F, 0x311, 0x20F}, {0x6F, 0x31B, 0x1A1},
+    {0x6F, 0x323, 0x1ECD}, {0x6F, 0x328, 0x1EB},
+    {0x70, 0x301, 0x1E55}, {0x70, 0x307, 0x1E57},
+    {0x72, 0x301, 0x155}, {0x72, 0x307, 0x1E59},
+    {0x72, 0x30C, 0x159}, {0x72, 0x30F, 0x211},
+    {0x72, 0x311, 0x213}, {0x72, 0x323, 0x1E5B},
+    {0x72, 0x327, 0x157}, {0x72, 0x331, 0x1E5F},
+    {0x73, 0x301, 0x15B}, {0x73, 0x302, 0x15D},
+    {0x73, 0x307, 0x1E61}, {0x73, 0x30C, 0x161},
+    {0x73, 0x323, 0x1E63}, {0x73, 0x326, 0x219},
+    {0x73, 0x327, 0x15F}, {0x74, 0x307, 0x1E6B},
+    {0x74, 0x308, 0x1E97}, {0x74, 0x30C, 0x165},
+    {0x74, 0x323, 0x1E6D}, {0x74, 0x326, 0x21B},
+    {0x74, 0x327, 0x163}, {0x74, 0x32D, 0x1E71},
+    {0x74, 0x331, 0x1E6F}, {0x75, 0x300, 0xF9},
+    {0x75, 0x301, 0xFA}, {0x75, 0x302, 0xFB},
+    {0x75, 0x303, 0x169}, {0x75, 0x304, 0x16B},
+    {0x75, 0x306, 0x16D}, {0x75, 0x308, 0xFC},
+    {0x75, 0x309, 0x1EE7}, {0x75, 0x30A, 0x16F},
+    {0x75, 0x30B, 0x171}, {0x75, 0x30C, 0x1D4},
+    {0x75, 0x30F, 0x215}, {0x75, 0x311, 0x217},
+    {0x75, 0x31B, 0x1B0}, {0x75, 0x323, 0x1EE5},
+    {0x75, 0x324, 0x1E73}, {0x75, 0x328, 0x173},
+    {0x75, 0x32D, 0x1E77}, {0x75, 0x330, 0x1E75},
+    {0x76, 0x303, 0x1E7D}, {0x76, 0x323, 0x1E7F},
+    {0x77, 0x300, 0x1E81}, {0x77, 0x301, 0x1E83},
+    {0x77, 0x302, 0x175}, {0x77, 0x307, 0x1E87},
+    {0x77, 0x308, 0x1E85}, {0x77, 0x30A, 0x1E98},
+    {0x77, 0x323, 0x1E89}, {0x78, 0x307, 0x1E8B},
+    {0x78, 0x308, 0x1E8D}, {0x79, 0x300, 0x1EF3},
+    {0x79, 0x301, 0xFD}, {0x79, 0x302, 0x177},
+    {0x79, 0x303, 0x1EF9}, {0x79, 0x304, 0x233},
+    {0x79, 0x307, 0x1E8F}, {0x79, 0x308, 0xFF},
+    {0x79, 0x309, 0x1EF7}, {0x79, 0x30A, 0x1E99},
+    {0x79, 0x323, 0x1EF5}, {0x7A, 0x301, 0x17A},
+    {0x7A, 0x302, 0x1E91}, {0x7A, 0x307, 0x17C},
+    {0x7A, 0x30C, 0x17E}, {0x7A, 0x323, 0x1E93},
+    {0x7A, 0x331, 0x1E95}, {0xA8, 0x300, 0x1FED},
+    {0xA8, 0x301, 0x385}, {0xA8, 0x342, 0x1FC1},
+    {0xC2, 0x300, 0x1EA6}, {0xC2, 0x301, 0x1EA4},
+    {0xC2, 0x303, 0x1EAA}, {0xC2, 0x309, 0x1EA8},
+    {0xC4, 0x304, 0x1DE}, {0xC5, 0x301, 0x1FA},
+    {0xC6, 0x301, 0x1FC}, {0xC6, 0x304, 0x1E2},
+    {0xC7, 0x301, 0x1E08}, {0xCA, 0x300, 0x1EC0},
+    {0xCA, 0x301, 0x1EBE}, {0xCA, 0x303, 0x1EC4},
+    {0xCA, 0x309, 0x1EC2}, {0xCF, 0x301, 0x1E2E},
+    {0xD4, 0x300, 0x1ED2}, {0xD4, 0x301, 0x1ED0},
+    {0xD4, 0x303, 0x1ED6}, {0xD4, 0x309, 0x1ED4},
+    {0xD5, 0x301, 0x1E4C}, {0xD5, 0x304, 0x22C},
+    {0xD5, 0x308, 0x1E4E}, {0xD6, 0x304, 0x22A},
+    {0xD8, 0x301, 0x1FE}, {0xDC, 0x300, 0x1DB},
+    {0xDC, 0x301, 0x1D7}, {0xDC, 0x304, 0x1D5},
+    {0xDC, 0x30C, 0x1D9}, {0xE2, 0x300, 0x1EA7},
+    {0xE2, 0x301, 0x1EA5}, {0xE2, 0x303, 0x1EAB},
+    {0xE2, 0x309, 0x1EA9}, {0xE4, 0x304, 0x1DF},
+    {0xE5, 0x301, 0x1FB}, {0xE6, 0x301, 0x1FD},
+    {0xE6, 0x304, 0x1E3}, {0xE7, 0x301, 0x1E09},
+    {0xEA, 0x300, 0x1EC1}, {0xEA, 0x301, 0x1EBF},
+    {0xEA, 0x303, 0x1EC5}, {0xEA, 0x309, 0x1EC3},
+    {0xEF, 0x301, 0x1E2F}, {0xF4, 0x300, 0x1ED3},
+    {0xF4, 0x301, 0x1ED1}, {0xF4, 0x303, 0x1ED7},
+    {0xF4, 0x309, 0x1ED5}, {0xF5, 0x301, 0x1E4D},
+    {0xF5, 0x304, 0x22D}, {0xF5, 0x308, 0x1E4F},
+    {0xF6, 0x304, 0x22B}, {0xF8, 0x301, 0x1FF},
+    {0xFC, 0x300, 0x1DC}, {0xFC, 0x301, 0x1D8},
+    {0xFC, 0x304, 0x1D6}, {0xFC, 0x30C, 0x1DA},
+    {0x102, 0x300, 0x1EB0}, {0x102, 0x301, 0x1EAE},
+    {0x102, 0x303, 0x1EB4}, {0x102, 0x309, 0x1EB2},
+    {0x103, 0x300, 0x1EB1}, {0x103, 0x301, 0x1EAF},
+    {0x103, 0x303, 0x1EB5}, {0x103, 0x309, 0x1EB3},
+    {0x112, 0x300, 0x1E14}, {0x112, 0x301, 0x1E16},
+    {0x113, 0x300, 0x1E15}, {0x113, 0x301, 0x1E17},
+    {0x14C, 0x300, 0x1E50}, {0x14C, 0x301, 0x1E52},
+    {0x14D, 0x300, 0x1E51}, {0x14D, 0x301, 0x1E53},
+    {0x15A, 0x307, 0x1E64}, {0x15B, 0x307, 0x1E65},
+    {0x160, 0x307, 0x1E66}, {0x161, 0x307, 0x1E67},
+    {0x168, 0x301, 0x1E78}, {0x169, 0x301, 0x1E79},
+    {0x16A, 0x308, 0x1E7A}, {0x16B, 0x308, 0x1E7B},
+    {0x17F, 0x307, 0x1E9B}, {0x1A0, 0x300, 0x1EDC},
+    {0x1A0, 0x301, 0x1EDA}, {0x1A0, 0x303, 0x1EE0},
+    {0x1A0, 0x309, 0x1EDE}, {0x1A0, 0x323, 0x1EE2},
+    {0x1A1, 0x300, 0x1EDD}, {0x1A1, 0x301, 0x1EDB},
+    {0x1A1, 0x303, 0x1EE1}, {0x1A1, 0x309, 0x1EDF},
+    {0x1A1, 0x323, 0x1EE3}, {0x1AF, 0x300, 0x1EEA},
+    {0x1AF, 0x301, 0x1EE8}, {0x1AF, 0x303, 0x1EEE},
+    {0x1AF, 0x309, 0x1EEC}, {0x1AF, 0x323, 0x1EF0},
+    {0x1B0, 0x300, 0x1EEB}, {0x1B0, 0x301, 0x1EE9},
+    {0x1B0, 0x303, 0x1EEF}, {0x1B0, 0x309, 0x1EED},
+    {0x1B0, 0x323, 0x1EF1}, {0x1B7, 0x30C, 0x1EE},
+    {0x1EA, 0x304, 0x1EC}, {0x1EB, 0x304, 0x1ED},
+    {0x226, 0x304, 0x1E0}, {0x227, 0x304, 0x1E1},
+    {0x228, 0x306, 0x1E1C}, {0x229, 0x306, 0x1E1D},
+    {0x22E, 0x304, 0x230}, {0x22F, 0x304, 0x231},
+    {0x292, 0x30C, 0x1EF}, {0x391, 0x300, 0x1FBA},
+    {0x391, 0x301, 0x386}, {0x391, 0x304, 0x1FB9},
+    {0x391, 0x306, 0x1FB8}, {0x391, 0x313, 0x1F08},
+    {0x391, 0x314, 0x1F09}, {0x391, 0x345, 0x1FBC},
+    {0x395, 0x300, 0x1FC8}, {0x395, 0x301, 0x388},
+    {0x395, 0x313, 0x1F18}, {0x395, 0x314, 0x1F19},
+    {0x397, 0x300, 0x1FCA}, {0x397, 0x301, 0x389},
+    {0x397, 0x313, 0x1F28}, {0x397, 0x314, 0x1F29},
+    {0x397, 0x345, 0x1FCC}, {0x399, 0x300, 0x1FDA},
+    {0x399, 0x301, 0x38A}, {0x399, 0x304, 0x1FD9},
+    {0x399, 0x306, 0x1FD8}, {0x399, 0x308, 0x3AA},
+    {0x399, 0x313, 0x1F38}, {0x399, 0x314, 0x1F39},
+    {0x39F, 0x300, 0x1FF8}, {0x39F, 0x301, 0x38C},
+    {0x39F, 0x313, 0x1F48}, {0x39F, 0x314, 0x1F49},
+    {0x3A1, 0x314, 0x1FEC}, {0x3A5, 0x300, 0x1FEA},
+    {0x3A5, 0x301, 0x38E}, {0x3A5, 0x304, 0x1FE9},
+    {0x3A5, 0x306, 0x1FE8}, {0x3A5, 0x308, 0x3AB},
+    {0x3A5, 0x314, 0x1F59}, {0x3A9, 0x300, 0x1FFA},
+    {0x3A9, 0x301, 0x38F}, {0x3A9, 0x313, 0x1F68},
+    {0x3A9, 0x314, 0x1F69}, {0x3A9, 0x345, 0x1FFC},
+    {0x3AC, 0x345, 0x1FB4}, {0x3AE, 0x345, 0x1FC4},
+    {0x3B1, 0x300, 0x1F70}, {0x3B1, 0x301, 0x3AC},
+    {0x3B1, 0x304, 0x1FB1}, {0x3B1, 0x306, 0x1FB0},
+    {0x3B1, 0x313, 0x1F00}, {0x3B1, 0x314, 0x1F01},
+    {0x3B1, 0x342, 0x1FB6}, {0x3B1, 0x345, 0x1FB3},
+    {0x3B5, 0x300, 0x1F72}, {0x3B5, 0x301, 0x3AD},
+    {0x3B5, 0x313, 0x1F10}, {0x3B5, 0x314, 0x1F11},
+    {0x3B7, 0x300, 0x1F74}, {0x3B7, 0x301, 0x3AE},
+    {0x3B7, 0x313, 0x1F20}, {0x3B7, 0x314, 0x1F21},
+    {0x3B7, 0x342, 0x1FC6}, {0x3B7, 0x345, 0x1FC3},
+    {0x3B9, 0x300, 0x1F76}, {0x3B9, 0x301, 0x3AF},
+    {0x3B9, 0x304, 0x1FD1}, {0x3B9, 0x306, 0x1FD0},
+    {0x3B9, 0x308, 0x3CA}, {0x3B9, 0x313, 0x1F30},
+    {0x3B9, 0x314, 0x1F31}, {0x3B9, 0x342, 0x1FD6},
+    {0x3BF, 0x300, 0x1F78}, {0x3BF, 0x301, 0x3CC},
+    {0x3BF, 0x313, 0x1F40}, {0x3BF, 0x314, 0x1F41},
+    {0x3C1, 0x313, 0x1FE4}, {0x3C1, 0x314, 0x1FE5},
+    {0x3C5, 0x300, 0x1F7A}, {0x3C5, 0x301, 0x3CD},
+    {0x3C5, 0x304, 0x1FE1}, {0x3C5, 0x306, 0x1FE0},
+    {0x3C5, 0x308, 0x3CB}, {0x3C5, 0x313, 0x1F50},
+    {0x3C5, 0x314, 0x1F51}, {0x3C5, 0x342, 0x1FE6},
+    {0x3C9, 0x300, 0x1F7C}, {0x3C9, 0x301, 0x3CE},
+    {0x3C9, 0x313, 0x1F60}, {0x3C9, 0x314, 0x1F61},
+    {0x3C9, 0x342, 0x1FF6}, {0x3C9, 0x345, 0x1FF3},
+    {0x3CA, 0x300, 0x1FD2}, {0x3CA, 0x301, 0x390},
+    {0x3CA, 0x342, 0x1FD7}, {0x3CB, 0x300, 0x1FE2},
+    {0x3CB, 0x301, 0x3B0}, {0x3CB, 0x342, 0x1FE7},
+    {0x3CE, 0x345, 0x1FF4}, {0x3D2, 0x301, 0x3D3},
+    {0x3D2, 0x308, 0x3D4}, {0x406, 0x308, 0x407},
+    {0x410, 0x306, 0x4D0}, {0x410, 0x308, 0x4D2},
+    {0x413, 0x301, 0x403}, {0x415, 0x300, 0x400},
+    {0x415, 0x306, 0x4D6}, {0x415, 0x308, 0x401},
+    {0x416, 0x306, 0x4C1}, {0x416, 0x308, 0x4DC},
+    {0x417, 0x308, 0x4DE}, {0x418, 0x300, 0x40D},
+    {0x418, 0x304, 0x4E2}, {0x418, 0x306, 0x419},
+    {0x418, 0x308, 0x4E4}, {0x41A, 0x301, 0x40C},
+    {0x41E, 0x308, 0x4E6}, {0x423, 0x304, 0x4EE},
+    {0x423, 0x306, 0x40E}, {0x423, 0x308, 0x4F0},
+    {0x423, 0x30B, 0x4F2}, {0x427, 0x308, 0x4F4},
+    {0x42B, 0x308, 0x4F8}, {0x42D, 0x308, 0x4EC},
+    {0x430, 0x306, 0x4D1}, {0x430, 0x308, 0x4D3},
+    {0x433, 0x301, 0x453}, {0x435, 0x300, 0x450},
+    {0x435, 0x306, 0x4D7}, {0x435, 0x308, 0x451},
+    {0x436, 0x306, 0x4C2}, {0x436, 0x308, 0x4DD},
+    {0x437, 0x308, 0x4DF}, {0x438, 0x300, 0x45D},
+    {0x438, 0x304, 0x4E3}, {0x438, 0x306, 0x439},
+    {0x438, 0x308, 0x4E5}, {0x43A, 0x301, 0x45C},
+    {0x43E, 0x308, 0x4E7}, {0x443, 0x304, 0x4EF},
+    {0x443, 0x306, 0x45E}, {0x443, 0x308, 0x4F1},
+    {0x443, 0x30B, 0x4F3}, {0x447, 0x308, 0x4F5},
+    {0x44B, 0x308, 0x4F9}, {0x44D, 0x308, 0x4ED},
+    {0x456, 0x308, 0x457}, {0x474, 0x30F, 0x476},
+    {0x475, 0x30F, 0x477}, {0x4D8, 0x308, 0x4DA},
+    {0x4D9, 0x308, 0x4DB}, {0x4E8, 0x308, 0x4EA},
+    {0x4E9, 0x308, 0x4EB}, {0x627, 0x653, 0x622},
+    {0x627, 0x654, 0x623}, {0x627, 0x655, 0x625},
+    {0x648, 0x654, 0x624}, {0x64A, 0x654, 0x626},
+    {0x6C1, 0x654, 0x6C2}, {0x6D2, 0x654, 0x6D3},
+    {0x6D5, 0x654, 0x6C0}, {0x928, 0x93C, 0x929},
+    {0x930, 0x93C, 0x931}, {0x933, 0x93C, 0x934},
+    {0x9C7, 0x9BE, 0x9CB}, {0x9C7, 0x9D7, 0x9CC},
+    {0xB47, 0xB3E, 0xB4B}, {0xB47, 0xB56, 0xB48},
+    {0xB47, 0xB57, 0xB4C}, {0xB92, 0xBD7, 0xB94},
+    {0xBC6, 0xBBE, 0xBCA}, {0xBC6, 0xBD7, 0xBCC},
+    {0xBC7, 0xBBE, 0xBCB}, {0xC46, 0xC56, 0xC48},
+    {0xCBF, 0xCD5, 0xCC0}, {0xCC6, 0xCC2, 0xCCA},
+    {0xCC6, 0xCD5, 0xCC7}, {0xCC6, 0xCD6, 0xCC8},
+    {0xCCA, 0xCD5, 0xCCB}, {0xD46, 0xD3E, 0xD4A},
+    {0xD46, 0xD57, 0xD4C}, {0xD47, 0xD3E, 0xD4B},
+    {0xDD9, 0xDCA, 0xDDA}, {0xDD9, 0xDCF, 0xDDC},
+    {0xDD9, 0xDDF, 0xDDE}, {0xDDC, 0xDCA, 0xDDD},
+    {0x1025, 0x102E, 0x1026}, {0x1B05, 0x1B35, 0x1B06},
+    {0x1B07, 0x1B35, 0x1B08}, {0x1B09, 0x1B35, 0x1B0A},
+    {0x1B0B, 0x1B35, 0x1B0C}, {0x1B0D, 0x1B35, 0x1B0E},
+    {0x1B11, 0x1B35, 0x1B12}, {0x1B3A, 0x1B35, 0x1B3B},
+    {0x1B3C, 0x1B35, 0x1B3D}, {0x1B3E, 0x1B35, 0x1B40},
+    {0x1B3F, 0x1B35, 0x1B41}, {0x1B42, 0x1B35, 0x1B43},
+    {0x1E36, 0x304, 0x1E38}, {0x1E37, 0x304, 0x1E39},
+    {0x1E5A, 0x304, 0x1E5C}, {0x1E5B, 0x304, 0x1E5D},
+    {0x1E62, 0x307, 0x1E68}, {0x1E63, 0x307, 0x1E69},
+    {0x1EA0, 0x302, 0x1EAC}, {0x1EA0, 0x306, 0x1EB6},
+    {0x1EA1, 0x302, 0x1EAD}, {0x1EA1, 0x306, 0x1EB7},
+    {0x1EB8, 0x302, 0x1EC6}, {0x1EB9, 0x302, 0x1EC7},
+    {0x1ECC, 0x302, 0x1ED8}, {0x1ECD, 0x302, 0x1ED9},
+    {0x1F00, 0x300, 0x1F02}, {0x1F00, 0x301, 0x1F04},
+    {0x1F00, 0x342, 0x1F06}, {0x1F00, 0x345, 0x1F80},
+    {0x1F01, 0x300, 0x1F03}, {0x1F01, 0x301, 0x1F05},
+    {0x1F01, 0x342, 0x1F07}, {0x1F01, 0x345, 0x1F81},
+    {0x1F02, 0x345, 0x1F82}, {0x1F03, 0x345, 0x1F83},
+    {0x1F04, 0x345, 0x1F84}, {0x1F05, 0x345, 0x1F85},
+    {0x1F06, 0x345, 0x1F86}, {0x1F07, 0x345, 0x1F87},
+    {0x1F08, 0x300, 0x1F0A}, {0x1F08, 0x301, 0x1F0C},
+    {0x1F08, 0x342, 0x1F0E}, {0x1F08, 0x345, 0x1F88},
+    {0x1F09, 0x300, 0x1F0B}, {0x1F09, 0x301, 0x1F0D},
+    {0x1F09, 0x342, 0x1F0F}, {0x1F09, 0x345, 0x1F89},
+    {0x1F0A, 0x345, 0x1F8A}, {0x1F0B, 0x345, 0x1F8B},
+    {0x1F0C, 0x345, 0x1F8C}, {0x1F0D, 0x345, 0x1F8D},
+    {0x1F0E, 0x345, 0x1F8E}, {0x1F0F, 0x345, 0x1F8F},
+    {0x1F10, 0x300, 0x1F12}, {0x1F10, 0x301, 0x1F14},
+    {0x1F11, 0x300, 0x1F13}, {0x1F11, 0x301, 0x1F15},
+    {0x1F18, 0x300, 0x1F1A}, {0x1F18, 0x301, 0x1F1C},
+    {0x1F19, 0x300, 0x1F1B}, {0x1F19, 0x301, 0x1F1D},
+    {0x1F20, 0x300, 0x1F22}, {0x1F20, 0x301, 0x1F24},
+    {0x1F20, 0x342, 0x1F26}, {0x1F20, 0x345, 0x1F90},
+    {0x1F21, 0x300, 0x1F23}, {0x1F21, 0x301, 0x1F25},
+    {0x1F21, 0x342, 0x1F27}, {0x1F21, 0x345, 0x1F91},
+    {0x1F22, 0x345, 0x1F92}, {0x1F23, 0x345, 0x1F93},
+    {0x1F24, 0x345, 0x1F94}, {0x1F25, 0x345, 0x1F95},
+    {0x1F26, 0x345, 0x1F96}, {0x1F27, 0x345, 0x1F97},
+    {0x1F28, 0x300, 0x1F2A}, {0x1F28, 0x301, 0x1F2C},
+    {0x1F28, 0x342, 0x1F2E}, {0x1F28, 0x345, 0x1F98},
+    {0x1F29, 0x300, 0x1F2B}, {0x1F29, 0x301, 0x1F2D},
+    {0x1F29, 0x342, 0x1F2F}, {0x1F29, 0x345, 0x1F99},
+    {0x1F2A, 0x345, 0x1F9A}, {0x1F2B, 0x345, 0x1F9B},
+    {0x1F2C, 0x345, 0x1F9C}, {0x1F2D, 0x345, 0x1F9D},
+    {0x1F2E, 0x345, 0x1F9E}, {0x1F2F, 0x345, 0x1F9F},
+    {0x1F30, 0x300, 0x1F32}, {0x1F30, 0x301, 0x1F34},
+    {0x1F30, 0x342, 0x1F36}, {0x1F31, 0x300, 0x1F33},
+    {0x1F31, 0x301, 0x1F35}, {0x1F31, 0x342, 0x1F37},
+    {0x1F38, 0x300, 0x1F3A}, {0x1F38, 0x301, 0x1F3C},
+    {0x1F38, 0x342, 0x1F3E}, {0x1F39, 0x300, 0x1F3B},
+    {0x1F39, 0x301, 0x1F3D}, {0x1F39, 0x342, 0x1F3F},
+    {0x1F40, 0x300, 0x1F42}, {0x1F40, 0x301, 0x1F44},
+    {0x1F41, 0x300, 0x1F43}, {0x1F41, 0x301, 0x1F45},
+    {0x1F48, 0x300, 0x1F4A}, {0x1F48, 0x301, 0x1F4C},
+    {0x1F49, 0x300, 0x1F4B}, {0x1F49, 0x301, 0x1F4D},
+    {0x1F50, 0x300, 0x1F52}, {0x1F50, 0x301, 0x1F54},
+    {0x1F50, 0x342, 0x1F56}, {0x1F51, 0x300, 0x1F53},
+    {0x1F51, 0x301, 0x1F55}, {0x1F51, 0x342, 0x1F57},
+    {0x1F59, 0x300, 0x1F5B}, {0x1F59, 0x301, 0x1F5D},
+    {0x1F59, 0x342, 0x1F5F}, {0x1F60, 0x300, 0x1F62},
+    {0x1F60, 0x301, 0x1F64}, {0x1F60, 0x342, 0x1F66},
+    {0x1F60, 0x345, 0x1FA0}, {0x1F61, 0x300, 0x1F63},
+    {0x1F61, 0x301, 0x1F65}, {0x1F61, 0x342, 0x1F67},
+    {0x1F61, 0x345, 0x1FA1}, {0x1F62, 0x345, 0x1FA2},
+    {0x1F63, 0x345, 0x1FA3}, {0x1F64, 0x345, 0x1FA4},
+    {0x1F65, 0x345, 0x1FA5}, {0x1F66, 0x345, 0x1FA6},
+    {0x1F67, 0x345, 0x1FA7}, {0x1F68, 0x300, 0x1F6A},
+    {0x1F68, 0x301, 0x1F6C}, {0x1F68, 0x342, 0x1F6E},
+    {0x1F68, 0x345, 0x1FA8}, {0x1F69, 0x300, 0x1F6B},
+    {0x1F69, 0x301, 0x1F6D}, {0x1F69, 0x342, 0x1F6F},
+    {0x1F69, 0x345, 0x1FA9}, {0x1F6A, 0x345, 0x1FAA},
+    {0x1F6B, 0x345, 0x1FAB}, {0x1F6C, 0x345, 0x1FAC},
+    {0x1F6D, 0x345, 0x1FAD}, {0x1F6E, 0x345, 0x1FAE},
+    {0x1F6F, 0x345, 0x1FAF}, {0x1F70, 0x345, 0x1FB2},
+    {0x1F74, 0x345, 0x1FC2}, {0x1F7C, 0x345, 0x1FF2},
+    {0x1FB6, 0x345, 0x1FB7}, {0x1FBF, 0x300, 0x1FCD},
+    {0x1FBF, 0x301, 0x1FCE}, {0x1FBF, 0x342, 0x1FCF},
+    {0x1FC6, 0x345, 0x1FC7}, {0x1FF6, 0x345, 0x1FF7},
+    {0x1FFE, 0x300, 0x1FDD}, {0x1FFE, 0x301, 0x1FDE},
+    {0x1FFE, 0x342, 0x1FDF}, {0x2190, 0x338, 0x219A},
+    {0x2192, 0x338, 0x219B}, {0x2194, 0x338, 0x21AE},
+    {0x21D0, 0x338, 0x21CD}, {0x21D2, 0x338, 0x21CF},
+    {0x21D4, 0x338, 0x21CE}, {0x2203, 0x338, 0x2204},
+    {0x2208, 0x338, 0x2209}, {0x220B, 0x338, 0x220C},
+    {0x2223, 0x338, 0x2224}, {0x2225, 0x338, 0x2226},
+    {0x223C, 0x338, 0x2241}, {0x2243, 0x338, 0x2244},
+    {0x2245, 0x338, 0x2247}, {0x2248, 0x338, 0x2249},
+    {0x224D, 0x338, 0x226D}, {0x2261, 0x338, 0x2262},
+    {0x2264, 0x338, 0x2270}, {0x2265, 0x338, 0x2271},
+    {0x2272, 0x338, 0x2274}, {0x2273, 0x338, 0x2275},
+    {0x2276, 0x338, 0x2278}, {0x2277, 0x338, 0x2279},
+    {0x227A, 0x338, 0x2280}, {0x227B, 0x338, 0x2281},
+    {0x227C, 0x338, 0x22E0}, {0x227D, 0x338, 0x22E1},
+    {0x2282, 0x338, 0x2284}, {0x2283, 0x338, 0x2285},
+    {0x2286, 0x338, 0x2288}, {0x2287, 0x338, 0x2289},
+    {0x2291, 0x338, 0x22E2}, {0x2292, 0x338, 0x22E3},
+    {0x22A2, 0x338, 0x22AC}, {0x22A8, 0x338, 0x22AD},
+    {0x22A9, 0x338, 0x22AE}, {0x22AB, 0x338, 0x22AF},
+    {0x22B2, 0x338, 0x22EA}, {0x22B3, 0x338, 0x22EB},
+    {0x22B4, 0x338, 0x22EC}, {0x22B5, 0x338, 0x22ED},
+    {0x3046, 0x3099, 0x3094}, {0x304B, 0x3099, 0x304C},
+    {0x304D, 0x3099, 0x304E}, {0x304F, 0x3099, 0x3050},
+    {0x3051, 0x3099, 0x3052}, {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058},
+    {0x3059, 0x3099, 0x305A}, {0x305B, 0x3099, 0x305C},
+    {0x305D, 0x3099, 0x305E}, {0x305F, 0x3099, 0x3060},
+    {0x3061, 0x3099, 0x3062}, {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067}, {0x3068, 0x3099, 0x3069},
+    {0x306F, 0x3099, 0x3070}, {0x306F, 0x309A, 0x3071},
+    {0x3072, 0x3099, 0x3073}, {0x3072, 0x309A, 0x3074},
+    {0x3075, 0x3099, 0x3076}, {0x3075, 0x309A, 0x3077},
+    {0x3078, 0x3099, 0x3079}, {0x3078, 0x309A, 0x307A},
+    {0x307B, 0x3099, 0x307C}, {0x307B, 0x309A, 0x307D},
+    {0x309D, 0x3099, 0x309E}, {0x30A6, 0x3099, 0x30F4},
+    {0x30AB, 0x3099, 0x30AC}, {0x30AD, 0x3099, 0x30AE},
+    {0x30AF, 0x3099, 0x30B0}, {0x30B1, 0x3099, 0x30B2},
+    {0x30B3, 0x3099, 0x30B4}, {0x30B5, 0x3099, 0x30B6},
+    {0x30B7, 0x3099, 0x30B8}, {0x30B9, 0x3099, 0x30BA},
+    {0x30BB, 0x3099, 0x30BC}, {0x30BD, 0x3099, 0x30BE},
+    {0x30BF, 0x3099, 0x30C0}, {0x30C1, 0x3099, 0x30C2},
+    {0x30C4, 0x3099, 0x30C5}, {0x30C6, 0x3099, 0x30C7},
+    {0x30C8, 0x3099, 0x30C9}, {0x30CF, 0x3099, 0x30D0},
+    {0x30CF, 0x309A, 0x30D1}, {0x30D2, 0x3099, 0x30D3},
+    {0x30D2, 0x309A, 0x30D4}, {0x30D5, 0x3099, 0x30D6},
+    {0x30D5, 0x309A, 0x30D7}, {0x30D8, 0x3099, 0x30D9},
+    {0x30D8, 0x309A, 0x30DA}, {0x30DB, 0x3099, 0x30DC},
+    {0x30DB, 0x309A, 0x30DD}, {0x30EF, 0x3099, 0x30F7},
+    {0x30F0, 0x3099, 0x30F8}, {0x30F1, 0x3099, 0x30F9},
+    {0x30F2, 0x3099, 0x30FA}, {0x30FD, 0x3099, 0x30FE},
+    {0x11099, 0x110BA, 0x1109A}, {0x1109B, 0x110BA, 0x1109C},
+    {0x110A5, 0x110BA, 0x110AB}, {0x11131, 0x11127, 0x1112E},
+    {0x11132, 0x11127, 0x1112F}, {0x11347, 0x1133E, 0x1134B},
+    {0x11347, 0x11357, 0x1134C}, {0x114B9, 0x114B0, 0x114BC},
+    {0x114B9, 0x114BA, 0x114BB}, {0x114B9, 0x114BD, 0x114BE},
+    {0x115B8, 0x115AF, 0x115BA}, {0x115B9, 0x115AF, 0x115BB},
+    {0x11935, 0x11930, 0x11938},
+};
+
+}  // namespace unicode_tables
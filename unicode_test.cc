@@ -0,0 +1,88 @@
+#include "unicode.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "gtest/gtest.h"
+
+TEST(Unicode, DecodeUtf8) {
+  char32_t c;
+  EXPECT_EQ(DecodeUtf8("a", &c), 1u);
+  EXPECT_EQ(c, U'a');
+  EXPECT_EQ(DecodeUtf8("é!", &c), 2u);
+  EXPECT_EQ(c, U'é');
+  EXPECT_EQ(DecodeUtf8("変", &c), 3u);
+  EXPECT_EQ(c, U'変');
+  EXPECT_EQ(DecodeUtf8("😀", &c), 4u);
+  EXPECT_EQ(c, U'\U0001F600');
+
+  for (const char* invalid :
+       {"", "\x80", "\xFF", "\xC3", "\xC3(", "\xC0\xAF", "\xE0\x80\xAF",
+        "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xF8\x88\x80\x80\x80"}) {
+    EXPECT_EQ(DecodeUtf8(invalid, &c), 0u) << invalid;
+  }
+}
+
+TEST(Unicode, EncodeUtf8) {
+  for (char32_t c : {U'a', U'é', U'変', U'\U0001F600'}) {
+    std::string encoded;
+    EncodeUtf8(c, &encoded);
+    char32_t decoded;
+    EXPECT_EQ(DecodeUtf8(encoded, &decoded), encoded.size());
+    EXPECT_EQ(decoded, c);
+  }
+}
+
+TEST(Unicode, XidProperties) {
+  for (char32_t c : {U'a', U'Z', U'_', U'é', U'π', U'変',
+                     U'가', U'\U00020000'}) {
+    EXPECT_TRUE(IsXidStart(c)) << static_cast<uint32_t>(c);
+    EXPECT_TRUE(IsXidContinue(c)) << static_cast<uint32_t>(c);
+  }
+
+  // Digits and combining marks only continue identifiers.
+  for (char32_t c : {U'0', U'\u0301', U'٠', U'‿'}) {
+    EXPECT_FALSE(IsXidStart(c)) << static_cast<uint32_t>(c);
+    EXPECT_TRUE(IsXidContinue(c)) << static_cast<uint32_t>(c);
+  }
+
+  for (char32_t c : {U' ', U'+', U'$', U'\u00A0', U'²', U'→',
+                     U'\U0001F600'}) {
+    EXPECT_FALSE(IsXidStart(c)) << static_cast<uint32_t>(c);
+    EXPECT_FALSE(IsXidContinue(c)) << static_cast<uint32_t>(c);
+  }
+}
+
+TEST(Unicode, IsAscii) {
+  EXPECT_TRUE(IsAscii(""));
+  EXPECT_TRUE(IsAscii("abc_123"));
+  EXPECT_FALSE(IsAscii("naïve"));
+}
+
+TEST(Unicode, NormalizeNfkc) {
+  // ASCII and text already in NFKC are unchanged.
+  EXPECT_EQ(NormalizeNfkc("abc_123"), "abc_123");
+  EXPECT_EQ(NormalizeNfkc("naïve"), "naïve");
+  EXPECT_EQ(NormalizeNfkc("変数"), "変数");
+
+  // Compatibility characters.
+  EXPECT_EQ(NormalizeNfkc("\uFB01le"), "file");
+  EXPECT_EQ(NormalizeNfkc("\u210C"), "H");
+  EXPECT_EQ(NormalizeNfkc("\uFF58"), "x");
+  EXPECT_EQ(NormalizeNfkc("\u00B5"), "\u03BC");
+
+  // Canonical composition, after reordering combining marks.
+  EXPECT_EQ(NormalizeNfkc("e\u0301"), "\u00E9");
+  EXPECT_EQ(NormalizeNfkc("A\u030A"), "\u00C5");
+  EXPECT_EQ(NormalizeNfkc("\u212B"), "\u00C5");
+  EXPECT_EQ(NormalizeNfkc("a\u0323\u0302"), "\u1EAD");
+  EXPECT_EQ(NormalizeNfkc("a\u0302\u0323"), "\u1EAD");
+  EXPECT_EQ(NormalizeNfkc("q\u0307\u0323"), "q\u0323\u0307");
+
+  // Hangul syllables.
+  EXPECT_EQ(NormalizeNfkc("\u1100\u1161"), "\uAC00");
+  EXPECT_EQ(NormalizeNfkc("\u1100\u1161\u11A8"), "\uAC01");
+  EXPECT_EQ(NormalizeNfkc("\uAC00\u11A8"), "\uAC01");
+
+  EXPECT_THROW(NormalizeNfkc("ab\xFF"), std::runtime_error);
+}